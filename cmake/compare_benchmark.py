@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+########################################################################################################################
+
+# Compares two Google Benchmark JSON outputs (see '--benchmark_out') and fails if the contender is slower than the
+# baseline, in cpu time, by more than a given threshold.
+#
+# When the outputs have aggregates (see '--benchmark_repetitions'), the medians are compared. Otherwise, the
+# iterations themselves are compared.
+#
+# usage: compare_benchmark.py <baseline.json> <contender.json> [--threshold=0.10]
+
+########################################################################################################################
+
+import argparse
+import json
+import os
+import sys
+
+TIME_UNIT_IN_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path, encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    has_aggregates = any(benchmark.get("run_type") == "aggregate" for benchmark in benchmarks)
+
+    result = {}
+    for benchmark in benchmarks:
+        if has_aggregates and benchmark.get("aggregate_name") != "median":
+            continue
+        name = benchmark["run_name"] if has_aggregates else benchmark["name"]
+        result[name] = benchmark["cpu_time"] * TIME_UNIT_IN_NS[benchmark["time_unit"]]
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares two Google Benchmark JSON outputs.")
+    parser.add_argument("baseline", help="baseline JSON output")
+    parser.add_argument("contender", help="contender JSON output")
+    parser.add_argument("--threshold", type=float, default=0.10, help="maximum relative slowdown tolerated")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.baseline):
+        print(f"No baseline at '{args.baseline}': record it first with the '<name>_baseline' target.")
+        return 1
+
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+
+    width = max(map(len, baseline.keys() | contender.keys()), default=0)
+    print(f"{'benchmark':<{width}}  {'baseline (ns)':>14}  {'contender (ns)':>14}  {'change':>8}")
+
+    regressions = []
+    for name in sorted(baseline.keys() | contender.keys()):
+        if name not in baseline or name not in contender:
+            status = "only in baseline" if name in baseline else "only in contender"
+            print(f"{name:<{width}}  {status}")
+            continue
+
+        change = (contender[name] - baseline[name]) / baseline[name] if baseline[name] > 0 else 0.0
+        marker = "  <-- regression" if change > args.threshold else ""
+        print(f"{name:<{width}}  {baseline[name]:>14.3f}  {contender[name]:>14.3f}  {change:>+8.1%}{marker}")
+
+        if change > args.threshold:
+            regressions.append(name)
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than the baseline by more than {args.threshold:.0%}.")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -14,6 +14,26 @@ get_filename_component(ROBOCIN_PROJECT_PATH "${CMAKE_CURRENT_LIST_DIR}/.." ABSOL
 
 ########################################################################################################################
 
+# build the C++20 module interface units given to 'robocin_cpp_library' (requires CMake 3.28)
+option(ROBOCIN_CPP_MODULES "Build the C++20 module interface units of the libraries" OFF)
+
+if (ROBOCIN_CPP_MODULES AND CMAKE_VERSION VERSION_LESS 3.28)
+  message(FATAL_ERROR "ROBOCIN_CPP_MODULES requires CMake 3.28 or newer, found ${CMAKE_VERSION}")
+endif ()
+
+# the compilers whose module dependencies CMake can scan; older ones (e.g. GCC 12's '-fmodules-ts') can't build the
+# interface units, hence the configuration fails instead of the build
+if (ROBOCIN_CPP_MODULES)
+  if ((CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 14)
+      OR (CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 16)
+      OR (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 19.34))
+    message(FATAL_ERROR "ROBOCIN_CPP_MODULES requires GCC 14, Clang 16 or MSVC 19.34 or newer, "
+                        "found ${CMAKE_CXX_COMPILER_ID} ${CMAKE_CXX_COMPILER_VERSION}")
+  endif ()
+endif ()
+
+########################################################################################################################
+
 # add cpp library
 # named parameters:
 #  NAME: name of the library
@@ -23,13 +43,14 @@ get_filename_component(ROBOCIN_PROJECT_PATH "${CMAKE_CURRENT_LIST_DIR}/.." ABSOL
 #  DEPS: dependencies
 #  MACROS: macros
 #  CONFIGS: CMake configurable files
+#  MODULES: C++20 module interface units, built only when ROBOCIN_CPP_MODULES is ON
 function(robocin_cpp_library)
   cmake_parse_arguments(
-          ARG                                    # prefix of output variables
-          ""                                     # list of names of the boolean arguments
-          "NAME"                                 # list of names of mono-valued arguments
-          "HDRS;SRCS;RSRCS;DEPS;MACROS;CONFIGS"  # list of names of multi-valued arguments
-          ${ARGN}                                # arguments of the function to parse (ARGN contains all the arguments after the function name)
+          ARG                                            # prefix of output variables
+          ""                                             # list of names of the boolean arguments
+          "NAME"                                         # list of names of mono-valued arguments
+          "HDRS;SRCS;RSRCS;DEPS;MACROS;CONFIGS;MODULES"  # list of names of multi-valued arguments
+          ${ARGN}                                        # arguments of the function to parse (ARGN contains all the arguments after the function name)
   )
 
   # if there isn't at least one header file, then the library is not created
@@ -70,6 +91,12 @@ function(robocin_cpp_library)
     target_compile_definitions(${ARG_NAME} ${ARG_MACROS})
   endif ()
 
+  # module interface units are compiled with the include directories above, hence their importers see the same
+  # configured headers (e.g. 'epsilon.h') as the library itself
+  if (ARG_MODULES AND ROBOCIN_CPP_MODULES)
+    target_sources(${ARG_NAME} PUBLIC FILE_SET CXX_MODULES BASE_DIRS ${CMAKE_CURRENT_SOURCE_DIR} FILES ${ARG_MODULES})
+  endif ()
+
 endfunction(robocin_cpp_library)
 
 ########################################################################################################################
@@ -121,9 +148,33 @@ endfunction(robocin_cpp_test)
 
 ########################################################################################################################
 
+# arguments used to run benchmarks when recording or comparing against a baseline
+set(ROBOCIN_BENCHMARK_ARGS
+    "--benchmark_repetitions=5;--benchmark_report_aggregates_only=true;--benchmark_min_time=0.1"
+    CACHE STRING "arguments used to run benchmarks when recording or comparing against a baseline")
+
+# maximum relative slowdown tolerated by the benchmark comparison before it fails
+set(ROBOCIN_BENCHMARK_THRESHOLD "0.10" CACHE STRING "maximum relative slowdown tolerated by the benchmark comparison")
+
+# directory of the JSON baselines, which are machine-specific and hence not versioned (e.g. CI artifacts)
+set(ROBOCIN_BENCHMARK_BASELINE_DIR "${CMAKE_BINARY_DIR}/benchmark_baselines"
+    CACHE PATH "directory of the JSON baselines recorded and compared against by the benchmarks")
+
+# the interpreter of the comparison script, looked up once for all the benchmarks
+find_package(Python3 COMPONENTS Interpreter)
+
+if (NOT Python3_Interpreter_FOUND)
+  message(WARNING "python3 not found, the '<NAME>_compare' targets of the benchmarks will not be available")
+endif ()
+
+########################################################################################################################
+
 # Add cpp benchmark test
 # Named parameters:
-#  NAME: name of the test
+#  NAME: name of the test; the following targets are also added, whose baseline is
+#  '${ROBOCIN_BENCHMARK_BASELINE_DIR}/<NAME>.json':
+#    <NAME>_baseline: runs the benchmark and overwrites the baseline with its results;
+#    <NAME>_compare: runs the benchmark and compares its results against the baseline, failing on regressions.
 #  HDRS: header files
 #  SRCS: source files
 #  RSRCS: resource files
@@ -162,6 +213,33 @@ function(robocin_cpp_benchmark_test)
     target_compile_definitions(${ARG_NAME} ${ARG_MACROS})
   endif ()
 
+  # the targets to record a baseline and to compare against it
+  set(baseline_path ${ROBOCIN_BENCHMARK_BASELINE_DIR}/${ARG_NAME}.json)
+  set(contender_path ${CMAKE_CURRENT_BINARY_DIR}/${ARG_NAME}.json)
+
+  add_custom_target(${ARG_NAME}_baseline
+          COMMAND ${CMAKE_COMMAND} -E make_directory ${ROBOCIN_BENCHMARK_BASELINE_DIR}
+          COMMAND $<TARGET_FILE:${ARG_NAME}> ${ROBOCIN_BENCHMARK_ARGS}
+                  --benchmark_out=${baseline_path} --benchmark_out_format=json
+          DEPENDS ${ARG_NAME}
+          COMMENT "Recording ${ARG_NAME} baseline"
+          USES_TERMINAL
+          VERBATIM
+  )
+
+  if (Python3_Interpreter_FOUND)
+    add_custom_target(${ARG_NAME}_compare
+            COMMAND $<TARGET_FILE:${ARG_NAME}> ${ROBOCIN_BENCHMARK_ARGS}
+                    --benchmark_out=${contender_path} --benchmark_out_format=json
+            COMMAND ${Python3_EXECUTABLE} ${ROBOCIN_PROJECT_PATH}/cmake/compare_benchmark.py
+                    ${baseline_path} ${contender_path} --threshold=${ROBOCIN_BENCHMARK_THRESHOLD}
+            DEPENDS ${ARG_NAME}
+            COMMENT "Comparing ${ARG_NAME} against its baseline"
+            USES_TERMINAL
+            VERBATIM
+    )
+  endif ()
+
 endfunction(robocin_cpp_benchmark_test)
 
 ########################################################################################################################
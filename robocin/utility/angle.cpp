@@ -0,0 +1,22 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle.h"
+
+namespace robocin {
+
+template class Radians<float>;
+template class Radians<double>;
+template class Radians<long double>;
+
+template class Degrees<float>;
+template class Degrees<double>;
+template class Degrees<long double>;
+
+template class NormalizedAngle<float>;
+template class NormalizedAngle<double>;
+template class NormalizedAngle<long double>;
+
+} // namespace robocin
@@ -0,0 +1,224 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_ANGLE_H
+#define ROBOCIN_UTILITY_ANGLE_H
+
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <numbers>
+
+#include "robocin/utility/angular.h"
+
+namespace robocin {
+
+template <std::floating_point F>
+class Radians;
+
+template <std::floating_point F>
+class Degrees;
+
+template <std::floating_point F>
+class NormalizedAngle;
+
+// Angle in radians, in any range ------------------------------------------------------------------
+template <std::floating_point F>
+class Radians {
+ public:
+  using value_type = F;
+
+  constexpr Radians() = default;
+  constexpr explicit Radians(F radians) : value_{radians} {}
+  constexpr explicit Radians(Degrees<F> degrees) : value_{degreesToRadians(degrees.value())} {}
+
+  [[nodiscard]] constexpr F value() const { return value_; }
+
+  constexpr Radians& operator+=(Radians other) {
+    value_ += other.value_;
+    return *this;
+  }
+
+  constexpr Radians& operator-=(Radians other) {
+    value_ -= other.value_;
+    return *this;
+  }
+
+  constexpr Radians& operator*=(F factor) {
+    value_ *= factor;
+    return *this;
+  }
+
+  constexpr Radians& operator/=(F divisor) {
+    value_ /= divisor;
+    return *this;
+  }
+
+  friend constexpr Radians operator+(Radians lhs, Radians rhs) { return lhs += rhs; }
+  friend constexpr Radians operator-(Radians lhs, Radians rhs) { return lhs -= rhs; }
+  friend constexpr Radians operator-(Radians angle) { return Radians{-angle.value_}; }
+  friend constexpr Radians operator*(Radians angle, F factor) { return angle *= factor; }
+  friend constexpr Radians operator*(F factor, Radians angle) { return angle *= factor; }
+  friend constexpr Radians operator/(Radians angle, F divisor) { return angle /= divisor; }
+
+  friend constexpr bool operator==(Radians lhs, Radians rhs) = default;
+  friend constexpr auto operator<=>(Radians lhs, Radians rhs) = default;
+
+ private:
+  F value_{};
+};
+
+// Angle in degrees, in any range ------------------------------------------------------------------
+template <std::floating_point F>
+class Degrees {
+ public:
+  using value_type = F;
+
+  constexpr Degrees() = default;
+  constexpr explicit Degrees(F degrees) : value_{degrees} {}
+  constexpr explicit Degrees(Radians<F> radians) : value_{radiansToDegrees(radians.value())} {}
+
+  [[nodiscard]] constexpr F value() const { return value_; }
+
+  constexpr Degrees& operator+=(Degrees other) {
+    value_ += other.value_;
+    return *this;
+  }
+
+  constexpr Degrees& operator-=(Degrees other) {
+    value_ -= other.value_;
+    return *this;
+  }
+
+  constexpr Degrees& operator*=(F factor) {
+    value_ *= factor;
+    return *this;
+  }
+
+  constexpr Degrees& operator/=(F divisor) {
+    value_ /= divisor;
+    return *this;
+  }
+
+  friend constexpr Degrees operator+(Degrees lhs, Degrees rhs) { return lhs += rhs; }
+  friend constexpr Degrees operator-(Degrees lhs, Degrees rhs) { return lhs -= rhs; }
+  friend constexpr Degrees operator-(Degrees angle) { return Degrees{-angle.value_}; }
+  friend constexpr Degrees operator*(Degrees angle, F factor) { return angle *= factor; }
+  friend constexpr Degrees operator*(F factor, Degrees angle) { return angle *= factor; }
+  friend constexpr Degrees operator/(Degrees angle, F divisor) { return angle /= divisor; }
+
+  friend constexpr bool operator==(Degrees lhs, Degrees rhs) = default;
+  friend constexpr auto operator<=>(Degrees lhs, Degrees rhs) = default;
+
+ private:
+  F value_{};
+};
+
+// Angle in radians, in the range [-pi, pi] --------------------------------------------------------
+// The invariant is established once, on construction, so the functions below never normalize it
+// again. Sums and differences of two normalized angles lie in [-2 * pi, 2 * pi], and are brought
+// back with a single conditional add or subtract of 2 * pi (no 'std::fmod'), giving the same result
+// as 'normalizeAngle'.
+template <std::floating_point F>
+class NormalizedAngle {
+  static constexpr F kPi = std::numbers::pi_v<F>;
+  static constexpr F k2Pi = 2 * kPi;
+
+ public:
+  using value_type = F;
+
+  constexpr NormalizedAngle() = default;
+  constexpr explicit NormalizedAngle(Radians<F> radians) :
+      value_{normalizeAngle(radians.value())} {}
+  constexpr explicit NormalizedAngle(Degrees<F> degrees) : NormalizedAngle{Radians<F>{degrees}} {}
+
+  // Wraps an angle that the caller guarantees to be in [-pi, pi], without normalizing it.
+  static constexpr NormalizedAngle fromNormalized(F radians) { return NormalizedAngle{radians}; }
+
+  [[nodiscard]] constexpr F value() const { return value_; }
+
+  // Every normalized angle is an angle in radians, so this conversion is free.
+  constexpr operator Radians<F>() const { return Radians<F>{value_}; } // NOLINT(*-explicit-*)
+
+  constexpr NormalizedAngle& operator+=(NormalizedAngle other) {
+    value_ = wrapOnce(value_ + other.value_);
+    return *this;
+  }
+
+  constexpr NormalizedAngle& operator-=(NormalizedAngle other) {
+    value_ = wrapOnce(value_ - other.value_);
+    return *this;
+  }
+
+  friend constexpr NormalizedAngle operator+(NormalizedAngle lhs, NormalizedAngle rhs) {
+    return lhs += rhs;
+  }
+  friend constexpr NormalizedAngle operator-(NormalizedAngle lhs, NormalizedAngle rhs) {
+    return lhs -= rhs;
+  }
+  friend constexpr NormalizedAngle operator-(NormalizedAngle angle) {
+    return NormalizedAngle{-angle.value_};
+  }
+
+  friend constexpr bool operator==(NormalizedAngle lhs, NormalizedAngle rhs) = default;
+  friend constexpr auto operator<=>(NormalizedAngle lhs, NormalizedAngle rhs) = default;
+
+ private:
+  constexpr explicit NormalizedAngle(F radians) : value_{radians} {}
+
+  // 'angle' must be in [-2 * pi, 2 * pi].
+  static constexpr F wrapOnce(F angle) {
+    if (angle > kPi) {
+      return angle - k2Pi;
+    }
+    if (angle < -kPi) {
+      return angle + k2Pi;
+    }
+    return angle;
+  }
+
+  F value_{};
+};
+
+template <std::floating_point F>
+constexpr NormalizedAngle<F> normalizeAngle(Radians<F> angle) {
+  return NormalizedAngle<F>{angle};
+}
+
+template <std::floating_point F>
+constexpr NormalizedAngle<F> normalizeAngle(Degrees<F> angle) {
+  return NormalizedAngle<F>{angle};
+}
+
+// Already normalized: a no-op.
+template <std::floating_point F>
+constexpr NormalizedAngle<F> normalizeAngle(NormalizedAngle<F> angle) {
+  return angle;
+}
+
+template <std::floating_point F>
+constexpr NormalizedAngle<F> smallestAngleDiff(Radians<F> lhs, Radians<F> rhs) {
+  return NormalizedAngle<F>{rhs - lhs};
+}
+
+// Same as the above, but without 'std::fmod', since both angles are already normalized.
+template <std::floating_point F>
+constexpr NormalizedAngle<F> smallestAngleDiff(NormalizedAngle<F> lhs, NormalizedAngle<F> rhs) {
+  return rhs - lhs;
+}
+
+template <std::floating_point F>
+constexpr F absSmallestAngleDiff(Radians<F> lhs, Radians<F> rhs) {
+  return std::abs(smallestAngleDiff(lhs, rhs).value());
+}
+
+template <std::floating_point F>
+constexpr F absSmallestAngleDiff(NormalizedAngle<F> lhs, NormalizedAngle<F> rhs) {
+  return std::abs(smallestAngleDiff(lhs, rhs).value());
+}
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_ANGLE_H
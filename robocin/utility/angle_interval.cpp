@@ -0,0 +1,18 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_interval.h"
+
+namespace robocin {
+
+template class AngleInterval<float>;
+template class AngleInterval<double>;
+template class AngleInterval<long double>;
+
+template class AngleIntervalSet<float>;
+template class AngleIntervalSet<double>;
+template class AngleIntervalSet<long double>;
+
+} // namespace robocin
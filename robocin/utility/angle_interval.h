@@ -0,0 +1,356 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_ANGLE_INTERVAL_H
+#define ROBOCIN_UTILITY_ANGLE_INTERVAL_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+namespace robocin {
+
+// Counter-clockwise arc of the circle, from its start, normalized to [-pi, pi], spanning a width in
+// [0, 2 * pi], so that arcs across the -pi / pi seam, and the whole circle, need no special case.
+template <std::floating_point F>
+class AngleInterval {
+  static constexpr F kPi = std::numbers::pi_v<F>;
+
+ public:
+  using value_type = F;
+
+  constexpr AngleInterval() = default;
+
+  // The arc from 'start', in any range, spanning 'width', clamped to [0, 2 * pi].
+  constexpr AngleInterval(value_type start, value_type width) :
+      start_{normalizeAngle(start)},
+      width_{std::clamp(width, value_type{0}, 2 * kPi)} {}
+
+  // The arc going counter-clockwise from 'first' to 'last', both in any range.
+  static constexpr AngleInterval fromEndpoints(value_type first, value_type last) {
+    const value_type kWidth = smallestAngleDiff(first, last);
+    return AngleInterval{first, kWidth < 0 ? kWidth + 2 * kPi : kWidth};
+  }
+
+  // The arc centered at 'center', spanning 'half_width' to each side (e.g. the angular shadow of a
+  // robot of radius 'r' at distance 'd' is 'fromCenter(direction, std::asin(r / d))').
+  static constexpr AngleInterval fromCenter(value_type center, value_type half_width) {
+    return AngleInterval{center - half_width, 2 * half_width};
+  }
+
+  static constexpr AngleInterval full() { return AngleInterval{-kPi, 2 * kPi}; }
+
+  [[nodiscard]] constexpr value_type start() const { return start_; }
+  [[nodiscard]] constexpr value_type width() const { return width_; }
+
+  // The end and the center of the arc, normalized to [-pi, pi].
+  [[nodiscard]] constexpr value_type end() const { return normalizeAngle(start_ + width_); }
+  [[nodiscard]] constexpr value_type center() const { return normalizeAngle(start_ + width_ / 2); }
+
+  [[nodiscard]] constexpr bool isFull() const { return width_ == 2 * kPi; }
+
+  // Whether the angle, in any range, lies in the arc (endpoints included).
+  [[nodiscard]] constexpr bool contains(value_type angle) const {
+    const value_type kOffset = smallestAngleDiff(start_, angle);
+    return (kOffset < 0 ? kOffset + 2 * kPi : kOffset) <= width_ or isFull();
+  }
+
+  friend constexpr bool operator==(const AngleInterval&, const AngleInterval&) = default;
+
+ private:
+  value_type start_ = 0;
+  value_type width_ = 0;
+};
+
+// Union of disjoint arcs of the circle (e.g. the directions in which a shot reaches the goal),
+// computed by sweeping sorted endpoints, in O(n log n) per operation on 'n' arcs.
+//
+// The arcs are stored as sorted, disjoint ranges of [-pi, pi]: those across the seam are split in
+// two, and joined again when read. Endpoints are compared within epsilon, as 'FuzzyLess' does:
+// ranges whose gap is not fuzzy greater than zero are merged, and those whose width is not are
+// dropped (e.g. the slivers left between the shadows of two touching robots), so that the results
+// are stable under noise.
+//
+// Every operation is done in place, and its intermediate ranges are kept in buffers owned by the
+// set, which keep their capacity, so that a set reused across frames stops allocating once it has
+// seen its largest input.
+template <std::floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
+class AngleIntervalSet {
+  static constexpr F kPi = std::numbers::pi_v<F>;
+
+ public:
+  using value_type = F;
+  using interval_type = AngleInterval<F>;
+  using policy_type = Policy;
+  using size_type = std::size_t;
+
+  AngleIntervalSet()
+    requires(has_default_tolerance_v<Policy, value_type>)
+      : AngleIntervalSet{Policy::template tolerance<value_type>()} {}
+
+  explicit AngleIntervalSet(value_type epsilon) : epsilon_{epsilon}, less_{epsilon} {}
+
+  [[nodiscard]] value_type epsilon() const { return epsilon_; }
+
+  [[nodiscard]] bool empty() const { return ranges_.empty(); }
+
+  // Removes every arc, keeping the capacity of the buffers.
+  void clear() { ranges_.clear(); }
+
+  // Replaces the arcs of the set by the given one.
+  void assign(const interval_type& interval) {
+    clear();
+    unite(interval);
+  }
+
+  // Set operations --------------------------------------------------------------------------------
+
+  void unite(const interval_type& interval) { unite(std::span{&interval, 1}); }
+
+  void unite(std::span<const interval_type> intervals) {
+    split(intervals, scratch_);
+    unite(scratch_);
+  }
+
+  void unite(const AngleIntervalSet& other) { unite(other.ranges_); }
+
+  void intersect(const interval_type& interval) { intersect(std::span{&interval, 1}); }
+
+  // Intersects the set with the union of the given arcs.
+  void intersect(std::span<const interval_type> intervals) {
+    split(intervals, scratch_);
+    coalesce(scratch_);
+    intersect(scratch_);
+  }
+
+  void intersect(const AngleIntervalSet& other) { intersect(other.ranges_); }
+
+  void subtract(const interval_type& interval) { subtract(std::span{&interval, 1}); }
+
+  // Subtracts the union of the given arcs from the set, e.g. the shadows of every obstacle from the
+  // arc of the goal.
+  void subtract(std::span<const interval_type> intervals) {
+    split(intervals, scratch_);
+    coalesce(scratch_);
+    subtract(scratch_);
+  }
+
+  void subtract(const AngleIntervalSet& other) { subtract(other.ranges_); }
+
+  // Queries ---------------------------------------------------------------------------------------
+
+  // The number of arcs, i.e. of maximal arcs, once those split by the seam are joined.
+  [[nodiscard]] size_type size() const {
+    return ranges_.size() - static_cast<size_type>(joinsAcrossSeam());
+  }
+
+  // The sum of the widths of the arcs.
+  [[nodiscard]] value_type measure() const {
+    value_type result = 0;
+    for (const Range& range : ranges_) {
+      result += range.last - range.first;
+    }
+    return result;
+  }
+
+  // Whether the angle, in any range, lies in an arc (endpoints within epsilon included).
+  [[nodiscard]] bool contains(value_type angle) const {
+    angle = normalizeAngle(angle);
+    // the seam lies in both -pi and pi.
+    return containsNormalized(angle)
+           or (not less_(angle, kPi) and containsNormalized(angle - 2 * kPi))
+           or (not less_(-kPi, angle) and containsNormalized(angle + 2 * kPi));
+  }
+
+  // The arcs, sorted by their start (but the one across the seam, if any, which comes last), into a
+  // reusable buffer.
+  void intervals(std::vector<interval_type>& result) const {
+    result.clear();
+    forEachInterval([&](const interval_type& interval) { result.push_back(interval); });
+  }
+
+  [[nodiscard]] std::vector<interval_type> intervals() const {
+    std::vector<interval_type> result;
+    intervals(result);
+    return result;
+  }
+
+  // The widest arc (the first one, on ties), or 'std::nullopt' if the set is empty. E.g. the widest
+  // open window to shoot at.
+  [[nodiscard]] std::optional<interval_type> largest() const {
+    std::optional<interval_type> result;
+    forEachInterval([&](const interval_type& interval) {
+      if (not result or result->width() < interval.width()) {
+        result = interval;
+      }
+    });
+    return result;
+  }
+
+  // The widest arc of the complement of the set (the first one, on ties), or 'std::nullopt' if the
+  // set covers the whole circle. E.g. the widest gap between the shadows of the obstacles.
+  [[nodiscard]] std::optional<interval_type> largestGap() const {
+    if (empty()) {
+      return interval_type::full();
+    }
+
+    std::optional<interval_type> result;
+    const auto kConsider = [&](value_type first, value_type width) {
+      if (less_(value_type{0}, width) and (not result or result->width() < width)) {
+        result = interval_type{first, width};
+      }
+    };
+    for (size_type i = 0; i + 1 < ranges_.size(); ++i) {
+      kConsider(ranges_[i].last, ranges_[i + 1].first - ranges_[i].last);
+    }
+    kConsider(ranges_.back().last, (kPi - ranges_.back().last) + (ranges_.front().first + kPi));
+    return result;
+  }
+
+ private:
+  // a sub-range of [-pi, pi].
+  struct Range {
+    value_type first;
+    value_type last;
+  };
+
+  // writes the ranges of the given arcs, sorted by their first angle.
+  static void split(std::span<const interval_type> intervals, std::vector<Range>& result) {
+    result.clear();
+    for (const interval_type& interval : intervals) {
+      const value_type kLast = interval.start() + interval.width();
+      if (interval.isFull()) {
+        result.push_back({-kPi, kPi});
+      } else if (kLast <= kPi) {
+        result.push_back({interval.start(), kLast});
+      } else {
+        result.push_back({interval.start(), kPi});
+        result.push_back({-kPi, kLast - 2 * kPi});
+      }
+    }
+    std::ranges::sort(result, std::ranges::less{}, &Range::first);
+  }
+
+  // merges, in place, the sorted ranges whose gap is not fuzzy greater than zero, and drops those
+  // whose width is not.
+  void coalesce(std::vector<Range>& ranges) const {
+    size_type size = 0;
+    for (const Range& range : ranges) {
+      if (size > 0 and not less_(ranges[size - 1].last, range.first)) {
+        ranges[size - 1].last = std::max(ranges[size - 1].last, range.last);
+      } else {
+        ranges[size++] = range;
+      }
+    }
+    ranges.resize(size);
+    std::erase_if(ranges, [&](const Range& range) { return not less_(range.first, range.last); });
+  }
+
+  // the following overloads take sorted, coalesced ranges (which may be 'scratch_').
+
+  void unite(const std::vector<Range>& ranges) {
+    result_.clear();
+    std::ranges::merge(
+        ranges_, ranges, std::back_inserter(result_), {}, &Range::first, &Range::first);
+    coalesce(result_);
+    std::swap(ranges_, result_);
+  }
+
+  void intersect(const std::vector<Range>& ranges) {
+    result_.clear();
+    for (size_type i = 0, j = 0; i < ranges_.size() and j < ranges.size();) {
+      const value_type kFirst = std::max(ranges_[i].first, ranges[j].first);
+      const value_type kLast = std::min(ranges_[i].last, ranges[j].last);
+      if (less_(kFirst, kLast)) {
+        result_.push_back({kFirst, kLast});
+      }
+      // the range that ends first cannot intersect the next ones of the other.
+      if (ranges_[i].last < ranges[j].last) {
+        ++i;
+      } else {
+        ++j;
+      }
+    }
+    std::swap(ranges_, result_);
+  }
+
+  void subtract(const std::vector<Range>& ranges) {
+    result_.clear();
+    size_type j = 0;
+    for (const Range& range : ranges_) {
+      value_type first = range.first;
+      // the cuts that end before the range cannot cut it, nor the next ones.
+      while (j < ranges.size() and ranges[j].last <= first) {
+        ++j;
+      }
+      // a cut that ends after the range may cut the next ones as well, hence it is not skipped.
+      for (size_type k = j; k < ranges.size() and ranges[k].first < range.last; ++k) {
+        if (less_(first, ranges[k].first)) {
+          result_.push_back({first, ranges[k].first});
+        }
+        first = std::max(first, ranges[k].last);
+      }
+      if (less_(first, range.last)) {
+        result_.push_back({first, range.last});
+      }
+    }
+    std::swap(ranges_, result_);
+  }
+
+  [[nodiscard]] bool containsNormalized(value_type angle) const {
+    // the first range that starts after the angle, ignoring epsilon, is preceded by the only one
+    // that may contain it, unless the next one starts within epsilon of it.
+    const auto kIt = std::ranges::upper_bound(ranges_, angle, std::ranges::less{}, &Range::first);
+    const bool kInPrevious = kIt != ranges_.begin() and not less_(std::prev(kIt)->last, angle);
+    const bool kInNext = kIt != ranges_.end() and not less_(angle, kIt->first);
+    return kInPrevious or kInNext;
+  }
+
+  // whether the first and the last ranges are the two halves of an arc across the seam.
+  [[nodiscard]] bool joinsAcrossSeam() const {
+    return ranges_.size() >= 2 and not less_(-kPi, ranges_.front().first)
+           and not less_(ranges_.back().last, kPi);
+  }
+
+  template <class Visitor>
+  void forEachInterval(Visitor visitor) const {
+    const bool kJoined = joinsAcrossSeam();
+    for (size_type i = kJoined ? 1 : 0; i + (kJoined ? 1 : 0) < ranges_.size(); ++i) {
+      visitor(rangeInterval(ranges_[i]));
+    }
+    if (kJoined) {
+      const Range& kFront = ranges_.front();
+      const Range& kBack = ranges_.back();
+      const value_type kWidth = (kBack.last - kBack.first) + (kFront.last - kFront.first);
+      visitor(interval_type{kBack.first, kWidth});
+    }
+  }
+
+  static interval_type rangeInterval(const Range& range) {
+    return range.first == -kPi and range.last == kPi ?
+               interval_type::full() :
+               interval_type{range.first, range.last - range.first};
+  }
+
+  value_type epsilon_;
+  FuzzyLess<value_type, policy_type> less_;
+
+  std::vector<Range> ranges_;
+  std::vector<Range> scratch_;
+  std::vector<Range> result_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_ANGLE_INTERVAL_H
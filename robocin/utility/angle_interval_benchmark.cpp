@@ -0,0 +1,93 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_interval.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+// 'size' angular shadows of robots, anywhere around the circle.
+template <class T>
+std::vector<AngleInterval<T>> randomShadows(std::size_t size) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> center{-kPi, kPi};
+  std::uniform_real_distribution<T> half_width{kPi / 64, kPi / 16};
+
+  std::vector<AngleInterval<T>> result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(AngleInterval<T>::fromCenter(center(generator), half_width(generator)));
+  }
+  return result;
+}
+
+// The open windows of the whole circle, subtracting one shadow at a time, as a loop over the
+// obstacles does.
+template <class T>
+void BM_AngleIntervalSetSubtractOneByOne(benchmark::State& state) {
+  const std::vector<AngleInterval<T>> kShadows =
+      randomShadows<T>(static_cast<std::size_t>(state.range(0)));
+
+  AngleIntervalSet<T> open;
+  for (auto _ : state) {
+    open.assign(AngleInterval<T>::full());
+    for (const AngleInterval<T>& shadow : kShadows) {
+      open.subtract(shadow);
+    }
+    benchmark::DoNotOptimize(open.largest());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kShadows.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetSubtractOneByOne, float)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetSubtractOneByOne, double)->Arg(16)->Arg(256);
+
+template <class T>
+void BM_AngleIntervalSetSubtract(benchmark::State& state) {
+  const std::vector<AngleInterval<T>> kShadows =
+      randomShadows<T>(static_cast<std::size_t>(state.range(0)));
+
+  AngleIntervalSet<T> open;
+  for (auto _ : state) {
+    open.assign(AngleInterval<T>::full());
+    open.subtract(kShadows);
+    benchmark::DoNotOptimize(open.largest());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kShadows.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetSubtract, float)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetSubtract, double)->Arg(16)->Arg(256);
+
+template <class T>
+void BM_AngleIntervalSetUnite(benchmark::State& state) {
+  const std::vector<AngleInterval<T>> kShadows =
+      randomShadows<T>(static_cast<std::size_t>(state.range(0)));
+
+  AngleIntervalSet<T> blocked;
+  for (auto _ : state) {
+    blocked.clear();
+    blocked.unite(kShadows);
+    benchmark::DoNotOptimize(blocked.largestGap());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kShadows.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetUnite, float)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_AngleIntervalSetUnite, double)->Arg(16)->Arg(256);
+
+} // namespace
+} // namespace robocin
@@ -0,0 +1,247 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_interval.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// AngleInterval -----------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, IntervalAcrossTheSeam) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const auto kInterval = AngleInterval<T>::fromEndpoints(kPi * 3 / 4, -kPi * 3 / 4 + 4 * kPi);
+  EXPECT_NEAR(kInterval.start(), kPi * 3 / 4, kEpsilon);
+  EXPECT_NEAR(kInterval.width(), kPi / 2, kEpsilon);
+  EXPECT_NEAR(kInterval.end(), -kPi * 3 / 4, kEpsilon);
+  EXPECT_NEAR(absSmallestAngleDiff(kInterval.center(), kPi), 0, kEpsilon);
+
+  EXPECT_TRUE(kInterval.contains(kPi));
+  EXPECT_TRUE(kInterval.contains(-kPi));
+  EXPECT_TRUE(kInterval.contains(-kPi * 7 / 8 - 2 * kPi));
+  EXPECT_FALSE(kInterval.contains(0));
+  EXPECT_FALSE(kInterval.contains(-kPi / 2));
+
+  const auto kShadow = AngleInterval<T>::fromCenter(kPi, kPi / 8);
+  EXPECT_NEAR(kShadow.start(), kPi * 7 / 8, kEpsilon);
+  EXPECT_NEAR(kShadow.width(), kPi / 4, kEpsilon);
+
+  EXPECT_TRUE(AngleInterval<T>::full().isFull());
+  EXPECT_TRUE(AngleInterval<T>::full().contains(T{1}));
+  EXPECT_TRUE((AngleInterval<T>{T{0}, 10 * kPi}.isFull()));
+}
+
+// AngleIntervalSet --------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, UniteAcrossTheSeam) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  AngleIntervalSet<T> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.largest(), std::nullopt);
+
+  set.unite(AngleInterval<T>{kPi * 3 / 4, kPi / 2});
+  set.unite(AngleInterval<T>{0, kPi / 4});
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_NEAR(set.measure(), kPi * 3 / 4, kEpsilon);
+
+  const std::vector<AngleInterval<T>> kIntervals = set.intervals();
+  ASSERT_EQ(kIntervals.size(), 2);
+  EXPECT_NEAR(kIntervals[0].start(), 0, kEpsilon);
+  EXPECT_NEAR(kIntervals[0].width(), kPi / 4, kEpsilon);
+  EXPECT_NEAR(kIntervals[1].start(), kPi * 3 / 4, kEpsilon);
+  EXPECT_NEAR(kIntervals[1].width(), kPi / 2, kEpsilon);
+
+  EXPECT_TRUE(set.contains(kPi));
+  EXPECT_TRUE(set.contains(-kPi));
+  EXPECT_TRUE(set.contains(-kPi * 7 / 8));
+  EXPECT_TRUE(set.contains(kPi / 8 + 2 * kPi));
+  EXPECT_FALSE(set.contains(kPi / 2));
+  EXPECT_FALSE(set.contains(-kPi / 2));
+
+  // bridging both arcs.
+  set.unite(AngleInterval<T>::fromEndpoints(kPi / 8, kPi * 7 / 8));
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_NEAR(set.largest()->start(), 0, kEpsilon);
+  EXPECT_NEAR(set.largest()->width(), kPi * 5 / 4, kEpsilon);
+
+  set.unite(AngleInterval<T>::full());
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_TRUE(set.largest()->isFull());
+  EXPECT_EQ(set.largestGap(), std::nullopt);
+}
+
+TYPED_TEST(FloatingPointTest, SubtractShadowsFromTheGoal) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // the goal, seen from behind it, across the seam, and three robots, two of which overlap.
+  AngleIntervalSet<T> open;
+  open.assign(AngleInterval<T>::fromCenter(kPi, kPi / 4));
+
+  const std::vector<AngleInterval<T>> kShadows{
+      AngleInterval<T>::fromCenter(kPi * 7 / 8, kPi / 32),
+      AngleInterval<T>::fromCenter(-kPi * 7 / 8, kPi / 16),
+      AngleInterval<T>::fromCenter(-kPi * 7 / 8 + kPi / 16, kPi / 16),
+      AngleInterval<T>::fromCenter(0, kPi / 4),
+  };
+  open.subtract(kShadows);
+
+  ASSERT_EQ(open.size(), 2);
+  EXPECT_NEAR(open.measure(), kPi / 2 - kPi / 16 - kPi * 3 / 16, kEpsilon);
+
+  const std::optional<AngleInterval<T>> kLargest = open.largest();
+  ASSERT_TRUE(kLargest.has_value());
+  EXPECT_NEAR(kLargest->start(), kPi * 29 / 32, kEpsilon);
+  EXPECT_NEAR(kLargest->width(), kPi * 3 / 32 + kPi / 16, kEpsilon);
+  EXPECT_TRUE(open.contains(kPi));
+  EXPECT_FALSE(open.contains(kPi * 7 / 8));
+
+  // the widest gap goes from the shadows of the overlapping robots to the goal post.
+  const std::optional<AngleInterval<T>> kGap = open.largestGap();
+  ASSERT_TRUE(kGap.has_value());
+  EXPECT_NEAR(kGap->start(), -kPi * 15 / 16, kEpsilon);
+  EXPECT_NEAR(kGap->width(), kPi * 27 / 16, kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, EndpointsAreComparedWithinEpsilon) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // arcs whose gap is within epsilon are merged.
+  AngleIntervalSet<T> set;
+  set.unite(AngleInterval<T>{0, 1});
+  set.unite(AngleInterval<T>{1 + kEpsilon / 2, 1});
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_NEAR(set.measure(), 2 + kEpsilon / 2, kEpsilon);
+
+  // shadows whose gap is within epsilon leave no sliver.
+  const std::vector<AngleInterval<T>> kShadows{
+      AngleInterval<T>{T{0.5}, T{0.5} + kEpsilon / 2},
+      AngleInterval<T>{T{-0.5}, 1 - kEpsilon / 2},
+  };
+  set.subtract(kShadows);
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_NEAR(set.largest()->start(), 1 + kEpsilon / 2, kEpsilon);
+
+  // arcs narrower than epsilon are dropped.
+  set.subtract(AngleInterval<T>{1 + kEpsilon, 1 - kEpsilon / 4});
+  EXPECT_TRUE(set.empty());
+}
+
+TYPED_TEST(FloatingPointTest, Intersect) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  AngleIntervalSet<T> set;
+  set.assign(AngleInterval<T>::fromEndpoints(kPi / 2, -kPi / 2));
+
+  AngleIntervalSet<T> other;
+  other.unite(AngleInterval<T>::fromEndpoints(kPi / 4, kPi * 3 / 4));
+  other.unite(AngleInterval<T>::fromEndpoints(kPi * 7 / 8, -kPi * 7 / 8));
+  set.intersect(other);
+
+  ASSERT_EQ(set.size(), 2);
+  EXPECT_NEAR(set.measure(), kPi / 4 + kPi / 4, kEpsilon);
+  EXPECT_TRUE(set.contains(kPi));
+  EXPECT_TRUE(set.contains(kPi * 5 / 8));
+  EXPECT_FALSE(set.contains(kPi * 3 / 8));
+
+  set.intersect(AngleInterval<T>{0, kPi / 2});
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.largestGap()->isFull());
+}
+
+TYPED_TEST(FloatingPointTest, RandomOperationsMatchSampledMembership) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr std::size_t kNumIntervals = 8;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> start{-kPi, kPi};
+  std::uniform_real_distribution<T> width{0, kPi / 2};
+
+  const auto kRandomIntervals = [&] {
+    std::vector<AngleInterval<T>> result;
+    for (std::size_t i = 0; i < kNumIntervals; ++i) {
+      result.emplace_back(start(generator), width(generator));
+    }
+    return result;
+  };
+
+  const auto kAnyContains = [](const std::vector<AngleInterval<T>>& intervals, T angle) {
+    return std::ranges::any_of(intervals, [&](const auto& interval) {
+      return interval.contains(angle);
+    });
+  };
+  // angles within epsilon of an endpoint may be on either side.
+  const auto kNearEndpoint = [](const std::vector<AngleInterval<T>>& intervals, T angle) {
+    return std::ranges::any_of(intervals, [&](const auto& interval) {
+      return absSmallestAngleDiff(interval.start(), angle) <= 2 * kEpsilon
+             or absSmallestAngleDiff(interval.end(), angle) <= 2 * kEpsilon;
+    });
+  };
+
+  for (int round = 0; round < 20; ++round) {
+    const std::vector<AngleInterval<T>> kLhs = kRandomIntervals();
+    const std::vector<AngleInterval<T>> kRhs = kRandomIntervals();
+
+    AngleIntervalSet<T> united;
+    united.unite(kLhs);
+    AngleIntervalSet<T> subtracted = united;
+    subtracted.subtract(kRhs);
+    AngleIntervalSet<T> intersected = united;
+    intersected.intersect(kRhs);
+
+    EXPECT_NEAR(subtracted.measure() + intersected.measure(), united.measure(), 4 * kEpsilon);
+
+    for (int i = 0; i < 256; ++i) {
+      const T kAngle = -kPi + static_cast<T>(i) * kPi / 128;
+      if (kNearEndpoint(kLhs, kAngle) or kNearEndpoint(kRhs, kAngle)) {
+        continue;
+      }
+      const bool kInLhs = kAnyContains(kLhs, kAngle);
+      const bool kInRhs = kAnyContains(kRhs, kAngle);
+      EXPECT_EQ(united.contains(kAngle), kInLhs) << kAngle;
+      EXPECT_EQ(subtracted.contains(kAngle), kInLhs and not kInRhs) << kAngle;
+      EXPECT_EQ(intersected.contains(kAngle), kInLhs and kInRhs) << kAngle;
+    }
+  }
+}
+
+} // namespace
+} // namespace robocin
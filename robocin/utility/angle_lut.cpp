@@ -0,0 +1,18 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_lut.h"
+
+namespace robocin {
+
+template class AngleLUT<float, 256>;
+template class AngleLUT<double, 256>;
+template class AngleLUT<long double, 256>;
+
+template class AngleLUT<float, 256, AngleInterpolation::kCubic>;
+template class AngleLUT<double, 256, AngleInterpolation::kCubic>;
+template class AngleLUT<long double, 256, AngleInterpolation::kCubic>;
+
+} // namespace robocin
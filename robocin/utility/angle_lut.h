@@ -0,0 +1,134 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_ANGLE_LUT_H
+#define ROBOCIN_UTILITY_ANGLE_LUT_H
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#include "robocin/utility/angular.h"
+
+namespace robocin {
+
+enum class AngleInterpolation {
+  kLinear,
+  kCubic, // Catmull-Rom, which goes through the samples and has a continuous first derivative.
+};
+
+// Table of 'N' samples of a function over one turn, at the angles '-pi + i * 2 * pi / N', which is
+// evaluated at any angle by interpolating its samples, across the -pi / pi seam as well. Angles are
+// normalized as 'normalizeAngle' does, so that the table has the period of the function it samples.
+//
+// The samples are stored with their neighbors across the seam (i.e. the last one before the first
+// and the first ones after the last), so that the interpolation reads consecutive samples without
+// wrapping its indices.
+template <std::floating_point T,
+          std::size_t N,
+          AngleInterpolation Interpolation = AngleInterpolation::kLinear>
+class AngleLUT {
+  static_assert(N >= 2 and N <= std::numeric_limits<std::int32_t>::max());
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kStep = 2 * kPi / N;
+  static constexpr T kInverseStep = N / (2 * kPi);
+
+  // the samples before the first one, and after the last one, as read by the interpolation.
+  static constexpr std::size_t kPadding = Interpolation == AngleInterpolation::kCubic ? 1 : 0;
+  static constexpr std::size_t kPaddedSize = N + 2 * kPadding + 2;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  static constexpr size_type kSize = N;
+  static constexpr AngleInterpolation kInterpolation = Interpolation;
+
+  constexpr explicit AngleLUT(const std::array<value_type, N>& samples) {
+    for (size_type i = 0; i < kPaddedSize; ++i) {
+      padded_[i] = samples[(i + N - kPadding) % N];
+    }
+  }
+
+  // Samples 'function(angle)' at every sample angle, at compile time when 'function' is constexpr.
+  template <std::invocable<value_type> Function>
+  static constexpr AngleLUT fromFunction(Function function) {
+    std::array<value_type, N> samples{};
+    for (size_type i = 0; i < N; ++i) {
+      samples[i] = static_cast<value_type>(function(angle(i)));
+    }
+    return AngleLUT{samples};
+  }
+
+  // The angle of the i-th sample, in [-pi, pi).
+  static constexpr value_type angle(size_type index) {
+    return -kPi + static_cast<value_type>(index) * kStep;
+  }
+
+  [[nodiscard]] constexpr value_type sample(size_type index) const {
+    return padded_[index + kPadding];
+  }
+
+  // The interpolated value at a given angle. NaN angles give NaN.
+  constexpr value_type operator()(value_type angle) const {
+    if (not(-kPi <= angle and angle <= kPi)) [[unlikely]] {
+      angle = normalizeAngle(angle);
+      if (angle != angle) {
+        return angle;
+      }
+    }
+    return interpolate(angle);
+  }
+
+  // Batch overload: the interpolated values at the given angles, in a single loop whose angles are
+  // normalized only when out of [-pi, pi]. 'values' must have the same size as 'angles' and may
+  // alias it.
+  void operator()(std::span<const value_type> angles, std::span<value_type> values) const {
+    assert(angles.size() == values.size());
+
+    for (size_type i = 0; i < values.size(); ++i) {
+      values[i] = (*this)(angles[i]);
+    }
+  }
+
+ private:
+  // 'angle' must be in [-pi, pi], give or take the rounding errors of its normalization.
+  [[nodiscard]] constexpr value_type interpolate(value_type angle) const {
+    const value_type kPosition = (angle + kPi) * kInverseStep;
+    // the position is never negative (except for rounding), hence truncating is flooring.
+    const auto kIndex = static_cast<std::int32_t>(kPosition);
+    const value_type kFraction = kPosition - static_cast<value_type>(kIndex);
+
+    const value_type* const kSamples = padded_.data() + kIndex;
+
+    if constexpr (Interpolation == AngleInterpolation::kLinear) {
+      return kSamples[0] + kFraction * (kSamples[1] - kSamples[0]);
+    } else {
+      const value_type kP0 = kSamples[0];
+      const value_type kP1 = kSamples[1];
+      const value_type kP2 = kSamples[2];
+      const value_type kP3 = kSamples[3];
+
+      return kP1
+             + kFraction / 2
+                   * ((kP2 - kP0)
+                      + kFraction
+                            * ((2 * kP0 - 5 * kP1 + 4 * kP2 - kP3)
+                               + kFraction * (3 * (kP1 - kP2) + kP3 - kP0)));
+    }
+  }
+
+  std::array<value_type, kPaddedSize> padded_{};
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_ANGLE_LUT_H
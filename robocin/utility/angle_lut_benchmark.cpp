@@ -0,0 +1,89 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_lut.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumValues = 1'024;
+
+template <class T>
+std::vector<T> randomAngles() {
+  return randomValues<T>(-std::numbers::pi_v<T>, std::numbers::pi_v<T>, kNumValues);
+}
+
+// the function the tables replace.
+template <class T>
+T periodicFunction(T angle) {
+  return std::cos(angle) + std::sin(2 * angle) / 2;
+}
+
+template <class T>
+void BM_PeriodicFunction(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>();
+
+  for (auto _ : state) {
+    for (const T kAngle : kAngles) {
+      benchmark::DoNotOptimize(periodicFunction(kAngle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_PeriodicFunction, float);
+BENCHMARK_TEMPLATE(BM_PeriodicFunction, double);
+
+template <class T, std::size_t N, AngleInterpolation Interpolation>
+void BM_AngleLUT(benchmark::State& state) {
+  const auto kLut = AngleLUT<T, N, Interpolation>::fromFunction(periodicFunction<T>);
+  const std::vector<T> kAngles = randomAngles<T>();
+
+  for (auto _ : state) {
+    for (const T kAngle : kAngles) {
+      benchmark::DoNotOptimize(kLut(kAngle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleLUT, float, 256, AngleInterpolation::kLinear);
+BENCHMARK_TEMPLATE(BM_AngleLUT, double, 256, AngleInterpolation::kLinear);
+BENCHMARK_TEMPLATE(BM_AngleLUT, float, 256, AngleInterpolation::kCubic);
+BENCHMARK_TEMPLATE(BM_AngleLUT, double, 256, AngleInterpolation::kCubic);
+BENCHMARK_TEMPLATE(BM_AngleLUT, double, 8'192, AngleInterpolation::kLinear);
+
+template <class T, std::size_t N, AngleInterpolation Interpolation>
+void BM_AngleLUTBatch(benchmark::State& state) {
+  const auto kLut = AngleLUT<T, N, Interpolation>::fromFunction(periodicFunction<T>);
+  const std::vector<T> kAngles = randomAngles<T>();
+
+  std::vector<T> values(kAngles.size());
+  for (auto _ : state) {
+    kLut(kAngles, values);
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleLUTBatch, float, 256, AngleInterpolation::kLinear);
+BENCHMARK_TEMPLATE(BM_AngleLUTBatch, double, 256, AngleInterpolation::kLinear);
+BENCHMARK_TEMPLATE(BM_AngleLUTBatch, float, 256, AngleInterpolation::kCubic);
+BENCHMARK_TEMPLATE(BM_AngleLUTBatch, double, 256, AngleInterpolation::kCubic);
+BENCHMARK_TEMPLATE(BM_AngleLUTBatch, double, 8'192, AngleInterpolation::kLinear);
+
+} // namespace
+} // namespace robocin
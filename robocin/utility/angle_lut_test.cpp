@@ -0,0 +1,173 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_lut.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/angular_math.h"
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+constexpr std::size_t kBatchSize = 1'003;
+
+// a periodic function, as e.g. a speed limit by heading.
+template <class T>
+T periodicFunction(T angle) {
+  return std::cos(angle) + std::sin(2 * angle) / 2;
+}
+
+// The fewest samples whose interpolation error is within epsilon, for the function above (whose
+// second derivative is at most 3, and whose third derivative is at most 5).
+template <class T, AngleInterpolation Interpolation>
+using AccurateLUT =
+    AngleLUT<T, (Interpolation == AngleInterpolation::kLinear ? 8'192 : 1'024), Interpolation>;
+
+TYPED_TEST(FloatingPointTest, FromFunctionIsConstexpr) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  static constexpr auto kLut = AngleLUT<T, 4'096>::fromFunction([](T angle) {
+    return fastCos(angle);
+  });
+
+  static_assert(kLut.sample(0) == fastCos(-kPi));
+  static_assert(std::abs(kLut(T{0}) - 1) <= kEpsilon);
+  static_assert(std::abs(kLut(kPi / 2)) <= kEpsilon);
+  static_assert(std::abs(kLut(kPi) + 1) <= kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, LinearInterpolationIsWithinEpsilon) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const auto kLut = AccurateLUT<T, AngleInterpolation::kLinear>::fromFunction(periodicFunction<T>);
+
+  for (const T kAngle : randomValues<T>(-kPi, kPi, kBatchSize)) {
+    EXPECT_NEAR(kLut(kAngle), periodicFunction(kAngle), epsilon_v<T>) << kAngle;
+  }
+}
+
+TYPED_TEST(FloatingPointTest, CubicInterpolationIsWithinEpsilon) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const auto kLut = AccurateLUT<T, AngleInterpolation::kCubic>::fromFunction(periodicFunction<T>);
+
+  for (const T kAngle : randomValues<T>(-kPi, kPi, kBatchSize)) {
+    EXPECT_NEAR(kLut(kAngle), periodicFunction(kAngle), epsilon_v<T>) << kAngle;
+  }
+}
+
+TYPED_TEST(FloatingPointTest, InterpolationGoesThroughTheSamples) {
+  using T = TypeParam;
+
+  using LinearLUT = AngleLUT<T, 64>;
+  using CubicLUT = AngleLUT<T, 64, AngleInterpolation::kCubic>;
+
+  const auto kLinear = LinearLUT::fromFunction(periodicFunction<T>);
+  const auto kCubic = CubicLUT::fromFunction(periodicFunction<T>);
+
+  for (std::size_t i = 0; i < 64; ++i) {
+    const T kAngle = LinearLUT::angle(i);
+    EXPECT_NEAR(kLinear(kAngle), kLinear.sample(i), epsilon_v<T>);
+    EXPECT_NEAR(kCubic(kAngle), kCubic.sample(i), epsilon_v<T>);
+  }
+}
+
+TYPED_TEST(FloatingPointTest, InterpolationAcrossTheSeam) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // the samples around the seam are far apart, so that wrapping around matters.
+  const auto kLinear = AngleLUT<T, 8>::fromFunction([](T angle) { return angle; });
+  const auto kCubic = AngleLUT<T, 8, AngleInterpolation::kCubic>::fromFunction([](T angle) {
+    return angle;
+  });
+
+  EXPECT_EQ(kLinear(kPi), kLinear(-kPi));
+  EXPECT_EQ(kCubic(kPi), kCubic(-kPi));
+
+  // halfway between the last sample (3/4 pi) and the first one (-pi), through pi.
+  const T kMidpoint = kPi * 7 / 8;
+  EXPECT_NEAR(kLinear(kMidpoint), (kPi * 3 / 4 - kPi) / 2, kEpsilon);
+  EXPECT_NEAR(kLinear(kMidpoint - 2 * kPi), kLinear(kMidpoint), kEpsilon);
+  EXPECT_NEAR(kCubic(kMidpoint - 2 * kPi), kCubic(kMidpoint), kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, AnglesAreNormalized) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const auto kLut = AccurateLUT<T, AngleInterpolation::kCubic>::fromFunction(periodicFunction<T>);
+
+  for (const T kAngle : randomValues<T>(-10 * kPi, 10 * kPi, kBatchSize)) {
+    EXPECT_NEAR(kLut(kAngle), kLut(normalizeAngle(kAngle)), epsilon_v<T>) << kAngle;
+  }
+  EXPECT_TRUE(std::isnan(kLut(std::numeric_limits<T>::quiet_NaN())));
+  EXPECT_TRUE(std::isnan(kLut(std::numeric_limits<T>::infinity())));
+}
+
+// Batch overload ----------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, BatchGivenRandomAngles) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  using LinearLUT = AccurateLUT<T, AngleInterpolation::kLinear>;
+  using CubicLUT = AccurateLUT<T, AngleInterpolation::kCubic>;
+
+  const auto kLinear = LinearLUT::fromFunction(periodicFunction<T>);
+  const auto kCubic = CubicLUT::fromFunction(periodicFunction<T>);
+
+  std::vector<T> angles = randomValues<T>(-10 * kPi, 10 * kPi, kBatchSize);
+  angles[0] = std::numeric_limits<T>::quiet_NaN();
+
+  std::vector<T> linear(angles.size());
+  std::vector<T> cubic(angles.size());
+  kLinear(angles, linear);
+  kCubic(angles, cubic);
+
+  EXPECT_TRUE(std::isnan(linear[0]));
+  EXPECT_TRUE(std::isnan(cubic[0]));
+  for (std::size_t i = 1; i < angles.size(); ++i) {
+    EXPECT_NEAR(linear[i], kLinear(angles[i]), epsilon_v<T>) << angles[i];
+    EXPECT_NEAR(cubic[i], kCubic(angles[i]), epsilon_v<T>) << angles[i];
+  }
+
+  // in place.
+  kCubic(angles, angles);
+  for (std::size_t i = 1; i < angles.size(); ++i) {
+    EXPECT_EQ(angles[i], cubic[i]);
+  }
+}
+
+} // namespace
+} // namespace robocin
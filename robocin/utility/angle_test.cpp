@@ -0,0 +1,120 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle.h"
+
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+constexpr std::size_t kNumAngles = 1'000;
+
+TYPED_TEST(FloatingPointTest, HaveTheSizeOfTheirValue) {
+  using T = TypeParam;
+
+  static_assert(sizeof(Radians<T>) == sizeof(T));
+  static_assert(sizeof(Degrees<T>) == sizeof(T));
+  static_assert(sizeof(NormalizedAngle<T>) == sizeof(T));
+}
+
+TYPED_TEST(FloatingPointTest, RadiansAndDegreesConvertToEachOther) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  static_assert(Radians<T>{Degrees<T>{0}} == Radians<T>{0});
+  static_assert((Radians<T>{1} + Radians<T>{2}) * T{2} == Radians<T>{6});
+  static_assert(Degrees<T>{90} - Degrees<T>{180} == -Degrees<T>{90});
+
+  EXPECT_NEAR(Radians<T>{Degrees<T>{180}}.value(), kPi, kEpsilon);
+  EXPECT_NEAR(Degrees<T>{Radians<T>{kPi / 2}}.value(), 90, kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, NormalizedAngleIsInMinusPiAndPi) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  EXPECT_NEAR(NormalizedAngle<T>{Radians<T>{3 * kPi / 2}}.value(), -kPi / 2, kEpsilon);
+  EXPECT_NEAR(NormalizedAngle<T>{Degrees<T>{-270}}.value(), kPi / 2, kEpsilon);
+
+  for (const T kAngle : randomValues<T>(-100 * kPi, 100 * kPi, kNumAngles)) {
+    EXPECT_EQ(normalizeAngle(Radians<T>{kAngle}).value(), normalizeAngle(kAngle));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, NormalizeAngleGivenNormalizedAngleIsANoOp) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr auto kAngle = NormalizedAngle<T>::fromNormalized(kPi);
+
+  static_assert(normalizeAngle(kAngle) == kAngle);
+  static_assert(normalizeAngle(kAngle).value() == kPi);
+}
+
+TYPED_TEST(FloatingPointTest, NormalizedAngleArithmeticStaysInMinusPiAndPi) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kLhs = randomValues<T>(-kPi, kPi, kNumAngles);
+  const std::vector<T> kRhs = randomValues<T>(-kPi, kPi, kLhs.size() + 1);
+
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    const auto kLhsAngle = NormalizedAngle<T>::fromNormalized(kLhs[i]);
+    const auto kRhsAngle = NormalizedAngle<T>::fromNormalized(kRhs[i + 1]);
+
+    EXPECT_EQ((kLhsAngle + kRhsAngle).value(), normalizeAngle(kLhs[i] + kRhs[i + 1]));
+    EXPECT_EQ((kLhsAngle - kRhsAngle).value(), normalizeAngle(kLhs[i] - kRhs[i + 1]));
+    EXPECT_EQ((-kLhsAngle).value(), -kLhs[i]);
+  }
+}
+
+TYPED_TEST(FloatingPointTest, SmallestAngleDiffMatchesTheFreeFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kLhs = randomValues<T>(-kPi, kPi, kNumAngles);
+  const std::vector<T> kRhs = randomValues<T>(-10 * kPi, 10 * kPi, kNumAngles);
+
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    const auto kLhsNormalized = NormalizedAngle<T>::fromNormalized(kLhs[i]);
+    const auto kRhsNormalized = normalizeAngle(Radians<T>{kRhs[i]});
+    const T kNormalizedRhs = normalizeAngle(kRhs[i]);
+
+    EXPECT_EQ(smallestAngleDiff(Radians<T>{kLhs[i]}, Radians<T>{kRhs[i]}).value(),
+              smallestAngleDiff(kLhs[i], kRhs[i]));
+    EXPECT_EQ(absSmallestAngleDiff(Radians<T>{kLhs[i]}, Radians<T>{kRhs[i]}),
+              absSmallestAngleDiff(kLhs[i], kRhs[i]));
+    EXPECT_EQ(smallestAngleDiff(kLhsNormalized, kRhsNormalized).value(),
+              smallestAngleDiff(kLhs[i], kNormalizedRhs));
+    EXPECT_EQ(absSmallestAngleDiff(kLhsNormalized, kRhsNormalized),
+              absSmallestAngleDiff(kLhs[i], kNormalizedRhs));
+  }
+}
+
+} // namespace
+} // namespace robocin
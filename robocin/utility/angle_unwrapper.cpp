@@ -0,0 +1,18 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_unwrapper.h"
+
+namespace robocin {
+
+template class AngleUnwrapper<float>;
+template class AngleUnwrapper<double>;
+template class AngleUnwrapper<long double>;
+
+template class AngleUnwrapperArray<float>;
+template class AngleUnwrapperArray<double>;
+template class AngleUnwrapperArray<long double>;
+
+} // namespace robocin
@@ -0,0 +1,165 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_ANGLE_UNWRAPPER_H
+#define ROBOCIN_UTILITY_ANGLE_UNWRAPPER_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "robocin/utility/angular.h"
+
+// The following classes turn a stream of angles wrapped to [-pi, pi] (e.g. the headings given by
+// vision) into a continuous (unwrapped) signal, by counting the turns at which consecutive samples
+// cross the seam, i.e. whenever they are more than pi apart. Hence, consecutive samples must be
+// less than pi apart along the shortest path, as 'smallestAngleDiff' assumes.
+//
+// The state is the last wrapped sample and the integer turn count, so that it never accumulates
+// rounding errors, regardless of how long it runs. The unwrapped angle, 'turns * 2 * pi + wrapped',
+// is computed from them on every update, as accurately as 'F' allows (exactly for up to
+// 'normalizeAngleFastMaxAngle<F>'), and 'recenter' brings it back to [-pi, pi] at any time.
+//
+// NaN samples (e.g. missing detections) give NaN, and leave the state unchanged.
+
+namespace robocin {
+namespace internal {
+
+// 'turns * 2 * pi + wrapped', with the split 2 * pi of the Cody-Waite reduction.
+template <std::floating_point F>
+constexpr F unwrapAngle(F turns, F wrapped) {
+  return turns * TwoPi<F>::kHigh + (turns * TwoPi<F>::kLow + wrapped);
+}
+
+// The turns counted between consecutive wrapped samples: +1 when crossing the seam from pi to -pi,
+// -1 from -pi to pi, and 0 otherwise (including when either sample is NaN).
+template <std::floating_point F>
+constexpr F seamCrossings(F previous, F current) {
+  constexpr F kPi = std::numbers::pi_v<F>;
+
+  const F kDiff = current - previous;
+  return static_cast<F>(kDiff < -kPi) - static_cast<F>(kDiff > kPi);
+}
+
+} // namespace internal
+
+// Unwraps a single signal, in O(1) per sample -----------------------------------------------------
+template <std::floating_point F>
+class AngleUnwrapper {
+ public:
+  using value_type = F;
+
+  // Adds a sample, in any range, returning the unwrapped angle. The first sample (after
+  // construction or 'reset') is returned normalized.
+  value_type update(value_type angle) {
+    const value_type kWrapped = normalizeAngle(angle);
+
+    turns_ += internal::seamCrossings(wrapped_, kWrapped);
+    wrapped_ = kWrapped == kWrapped ? kWrapped : wrapped_;
+
+    return internal::unwrapAngle(turns_, kWrapped);
+  }
+
+  // The unwrapped angle of the last (non-NaN) sample, or NaN if there is none.
+  [[nodiscard]] value_type unwrapped() const { return internal::unwrapAngle(turns_, wrapped_); }
+
+  // The last (non-NaN) sample, normalized, or NaN if there is none.
+  [[nodiscard]] value_type wrapped() const { return wrapped_; }
+
+  // The number of whole turns of the unwrapped angle.
+  [[nodiscard]] value_type turns() const { return turns_; }
+
+  // Wraps an angle given in the unwrapped frame (e.g. an estimate of a filter fed by 'update') back
+  // to [-pi, pi], by removing the turns counted so far before normalizing it, so that large turn
+  // counts do not lose precision.
+  [[nodiscard]] value_type rewrap(value_type unwrapped) const {
+    return normalizeAngle((unwrapped - turns_ * internal::TwoPi<value_type>::kHigh)
+                          - turns_ * internal::TwoPi<value_type>::kLow);
+  }
+
+  // Sets the turn count to zero, shifting the unwrapped angle by a whole number of turns to
+  // [-pi, pi], and returns the number of turns removed (e.g. to shift the state of a filter).
+  value_type recenter() { return std::exchange(turns_, value_type{0}); }
+
+  // Forgets every sample.
+  void reset() {
+    turns_ = 0;
+    wrapped_ = std::numeric_limits<value_type>::quiet_NaN();
+  }
+
+ private:
+  // an integer, which is exact up to 2^digits turns.
+  value_type turns_ = 0;
+  value_type wrapped_ = std::numeric_limits<value_type>::quiet_NaN();
+};
+
+// Unwraps a signal per element, e.g. the headings of every robot, in structure-of-arrays layout ---
+// Each element behaves as an 'AngleUnwrapper', and the whole array is updated at once, in a loop
+// that neither branches nor allocates, so that it vectorizes.
+template <std::floating_point F>
+class AngleUnwrapperArray {
+ public:
+  using value_type = F;
+  using size_type = std::size_t;
+
+  explicit AngleUnwrapperArray(size_type size) :
+      turns_(size, value_type{0}),
+      wrapped_(size, std::numeric_limits<value_type>::quiet_NaN()) {}
+
+  [[nodiscard]] size_type size() const { return turns_.size(); }
+
+  // Adds a sample per element, writing their unwrapped angles. Samples are normalized by
+  // 'normalizeAngleFast', so their magnitude must be up to 'normalizeAngleFastMaxAngle<F>'.
+  // 'angles' and 'unwrapped' must have 'size()' elements, and may alias each other.
+  void update(std::span<const value_type> angles, std::span<value_type> unwrapped) {
+    assert(angles.size() == size() and unwrapped.size() == size());
+
+    value_type* const kTurns = turns_.data();
+    value_type* const kWrapped = wrapped_.data();
+    for (size_type i = 0; i < size(); ++i) {
+      const value_type kAngle = normalizeAngleFast(angles[i]);
+
+      kTurns[i] += internal::seamCrossings(kWrapped[i], kAngle);
+      kWrapped[i] = kAngle == kAngle ? kAngle : kWrapped[i];
+
+      unwrapped[i] = internal::unwrapAngle(kTurns[i], kAngle);
+    }
+  }
+
+  [[nodiscard]] value_type unwrapped(size_type index) const {
+    return internal::unwrapAngle(turns_[index], wrapped_[index]);
+  }
+
+  [[nodiscard]] std::span<const value_type> wrapped() const { return wrapped_; }
+  [[nodiscard]] std::span<const value_type> turns() const { return turns_; }
+
+  // As 'AngleUnwrapper::rewrap', for the given element.
+  [[nodiscard]] value_type rewrap(size_type index, value_type unwrapped) const {
+    return normalizeAngle((unwrapped - turns_[index] * internal::TwoPi<value_type>::kHigh)
+                          - turns_[index] * internal::TwoPi<value_type>::kLow);
+  }
+
+  // As 'AngleUnwrapper::recenter', for the given element.
+  value_type recenter(size_type index) { return std::exchange(turns_[index], value_type{0}); }
+
+  // Forgets every sample of the given element (e.g. a robot that left the field).
+  void reset(size_type index) {
+    turns_[index] = 0;
+    wrapped_[index] = std::numeric_limits<value_type>::quiet_NaN();
+  }
+
+ private:
+  std::vector<value_type> turns_;
+  std::vector<value_type> wrapped_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_ANGLE_UNWRAPPER_H
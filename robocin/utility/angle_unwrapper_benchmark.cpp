@@ -0,0 +1,109 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_unwrapper.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumFrames = 64;
+
+// 'kNumFrames' frames of 'size' headings, wrapped to [-pi, pi], each turning by up to pi / 2 per
+// frame.
+template <class T>
+std::vector<std::vector<T>> randomFrames(std::size_t size) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> step{-kPi / 2, kPi / 2};
+
+  std::vector<T> angles(size);
+  std::vector<std::vector<T>> result(kNumFrames);
+  for (std::vector<T>& frame : result) {
+    for (T& angle : angles) {
+      angle = normalizeAngle(angle + step(generator));
+    }
+    frame = angles;
+  }
+  return result;
+}
+
+// The loop the unwrapper replaces: every heading accumulates its smallest difference to the
+// previous one.
+template <class T>
+void BM_SmallestAngleDiffLoop(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<std::vector<T>> kFrames = randomFrames<T>(kSize);
+
+  std::vector<T> previous(kSize);
+  std::vector<T> unwrapped(kSize);
+  for (auto _ : state) {
+    for (const std::vector<T>& kFrame : kFrames) {
+      for (std::size_t i = 0; i < kSize; ++i) {
+        unwrapped[i] += smallestAngleDiff(previous[i], kFrame[i]);
+        previous[i] = kFrame[i];
+      }
+      benchmark::DoNotOptimize(unwrapped.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumFrames * kSize));
+}
+
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiffLoop, float)->Arg(16)->Arg(1'024);
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiffLoop, double)->Arg(16)->Arg(1'024);
+
+template <class T>
+void BM_AngleUnwrapper(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<std::vector<T>> kFrames = randomFrames<T>(kSize);
+
+  std::vector<AngleUnwrapper<T>> unwrappers(kSize);
+  std::vector<T> unwrapped(kSize);
+  for (auto _ : state) {
+    for (const std::vector<T>& kFrame : kFrames) {
+      for (std::size_t i = 0; i < kSize; ++i) {
+        unwrapped[i] = unwrappers[i].update(kFrame[i]);
+      }
+      benchmark::DoNotOptimize(unwrapped.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumFrames * kSize));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleUnwrapper, float)->Arg(16)->Arg(1'024);
+BENCHMARK_TEMPLATE(BM_AngleUnwrapper, double)->Arg(16)->Arg(1'024);
+
+template <class T>
+void BM_AngleUnwrapperArray(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<std::vector<T>> kFrames = randomFrames<T>(kSize);
+
+  AngleUnwrapperArray<T> array{kSize};
+  std::vector<T> unwrapped(kSize);
+  for (auto _ : state) {
+    for (const std::vector<T>& kFrame : kFrames) {
+      array.update(kFrame, unwrapped);
+      benchmark::DoNotOptimize(unwrapped.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumFrames * kSize));
+}
+
+BENCHMARK_TEMPLATE(BM_AngleUnwrapperArray, float)->Arg(16)->Arg(1'024);
+BENCHMARK_TEMPLATE(BM_AngleUnwrapperArray, double)->Arg(16)->Arg(1'024);
+
+} // namespace
+} // namespace robocin
@@ -0,0 +1,195 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angle_unwrapper.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// a continuous signal, starting at 'start', whose steps are less than pi / 2 in magnitude and turn
+// mostly in the same direction, so that it goes around several times.
+template <class T>
+std::vector<T> randomWalk(std::size_t size, T start, unsigned seed = 42) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  std::mt19937 generator{seed}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> step{-kPi / 4, kPi / 2};
+
+  std::vector<T> result(size);
+  T angle = start;
+  for (T& value : result) {
+    value = angle;
+    angle += step(generator);
+  }
+  return result;
+}
+
+TYPED_TEST(FloatingPointTest, UpdateGivenRandomWalk) {
+  using T = TypeParam;
+
+  const std::vector<T> kSignal = randomWalk<T>(1'000, T{0.5});
+
+  AngleUnwrapper<T> unwrapper;
+  for (const T kAngle : kSignal) {
+    EXPECT_NEAR(unwrapper.update(normalizeAngle(kAngle)), kAngle, epsilon_v<T>) << kAngle;
+  }
+  EXPECT_NEAR(unwrapper.unwrapped(), kSignal.back(), epsilon_v<T>);
+  EXPECT_NEAR(unwrapper.wrapped(), normalizeAngle(kSignal.back()), epsilon_v<T>);
+  EXPECT_GT(unwrapper.turns(), 10);
+}
+
+TYPED_TEST(FloatingPointTest, UpdateAcrossTheSeam) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  AngleUnwrapper<T> unwrapper;
+  EXPECT_EQ(unwrapper.update(kPi * 7 / 8 - 4 * kPi), normalizeAngle(kPi * 7 / 8 - 4 * kPi));
+
+  EXPECT_NEAR(unwrapper.update(-kPi * 7 / 8), kPi * 9 / 8, kEpsilon);
+  EXPECT_EQ(unwrapper.turns(), 1);
+  EXPECT_NEAR(unwrapper.update(kPi * 7 / 8), kPi * 7 / 8, kEpsilon);
+  EXPECT_EQ(unwrapper.turns(), 0);
+  EXPECT_NEAR(unwrapper.update(-kPi * 7 / 8), kPi * 9 / 8, kEpsilon);
+  EXPECT_NEAR(unwrapper.update(-kPi / 2), kPi * 3 / 2, kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, NaNSamplesLeaveTheStateUnchanged) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kNaN = std::numeric_limits<T>::quiet_NaN();
+
+  AngleUnwrapper<T> unwrapper;
+  EXPECT_TRUE(std::isnan(unwrapper.update(kNaN)));
+  EXPECT_TRUE(std::isnan(unwrapper.unwrapped()));
+
+  unwrapper.update(kPi * 3 / 4);
+  EXPECT_TRUE(std::isnan(unwrapper.update(kNaN)));
+  EXPECT_NEAR(unwrapper.update(-kPi * 3 / 4), kPi * 5 / 4, epsilon_v<T>);
+}
+
+TYPED_TEST(FloatingPointTest, RecenterRewrapAndReset) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  AngleUnwrapper<T> unwrapper;
+  for (const T kAngle : randomWalk<T>(100, T{0})) {
+    unwrapper.update(normalizeAngle(kAngle));
+  }
+
+  const T kUnwrapped = unwrapper.unwrapped();
+  const T kEstimate = kUnwrapped + kPi / 8;
+  EXPECT_NEAR(unwrapper.rewrap(kEstimate), normalizeAngle(kEstimate), kEpsilon);
+
+  const T kTurns = unwrapper.recenter();
+  EXPECT_EQ(unwrapper.turns(), 0);
+  EXPECT_NEAR(unwrapper.unwrapped(), kUnwrapped - kTurns * 2 * kPi, kEpsilon);
+  EXPECT_NEAR(unwrapper.unwrapped(), unwrapper.wrapped(), kEpsilon);
+
+  unwrapper.reset();
+  EXPECT_TRUE(std::isnan(unwrapper.unwrapped()));
+  EXPECT_EQ(unwrapper.update(-kPi / 2), -kPi / 2);
+}
+
+TYPED_TEST(FloatingPointTest, LongRunningSignalsDoNotLosePrecision) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr long double kStep = std::numbers::pi_v<long double> / 4;
+
+  // a whole turn in 8 steps, for 1'000 turns, so that the turn count is exact but a sum of the
+  // steps would accumulate their rounding errors. The reference sums them in long double.
+  AngleUnwrapper<T> unwrapper;
+  long double reference = 0;
+  for (int step = 0; step < 8'000; ++step) {
+    unwrapper.update(normalizeAngle(static_cast<T>(step % 8) * kPi / 4));
+    if (step > 0) {
+      reference += kStep;
+    }
+    if (step % 1'000 == 999) {
+      EXPECT_NEAR(unwrapper.unwrapped(), reference, kEpsilon) << step;
+    }
+  }
+  EXPECT_EQ(unwrapper.turns(), 1'000);
+  EXPECT_EQ(unwrapper.wrapped(), normalizeAngle(7 * kPi / 4));
+  EXPECT_NEAR(unwrapper.unwrapped(), reference, kEpsilon);
+}
+
+// AngleUnwrapperArray -----------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, ArrayMatchesTheScalarUnwrapper) {
+  using T = TypeParam;
+
+  // several signals, one of which gets a NaN sample, which must not affect the others.
+  static constexpr std::size_t kNumSignals = 11;
+  static constexpr std::size_t kNumSamples = 200;
+
+  std::vector<std::vector<T>> signals;
+  for (std::size_t i = 0; i < kNumSignals; ++i) {
+    signals.push_back(randomWalk<T>(kNumSamples, static_cast<T>(i), static_cast<unsigned>(i)));
+  }
+  signals[3][50] = std::numeric_limits<T>::quiet_NaN();
+
+  std::vector<AngleUnwrapper<T>> unwrappers(kNumSignals);
+  AngleUnwrapperArray<T> array{kNumSignals};
+  ASSERT_EQ(array.size(), kNumSignals);
+
+  std::vector<T> frame(kNumSignals);
+  for (std::size_t sample = 0; sample < kNumSamples; ++sample) {
+    for (std::size_t i = 0; i < kNumSignals; ++i) {
+      frame[i] = signals[i][sample];
+    }
+    array.update(frame, frame);
+
+    for (std::size_t i = 0; i < kNumSignals; ++i) {
+      const T kExpected = unwrappers[i].update(normalizeAngle(signals[i][sample]));
+      if (std::isnan(kExpected)) {
+        EXPECT_TRUE(std::isnan(frame[i]));
+      } else {
+        EXPECT_NEAR(frame[i], kExpected, epsilon_v<T>);
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < kNumSignals; ++i) {
+    EXPECT_EQ(array.turns()[i], unwrappers[i].turns());
+    EXPECT_NEAR(array.unwrapped(i), unwrappers[i].unwrapped(), epsilon_v<T>);
+  }
+
+  const T kTurns = array.recenter(0);
+  EXPECT_EQ(kTurns, unwrappers[0].turns());
+  EXPECT_EQ(array.turns()[0], 0);
+
+  array.reset(1);
+  EXPECT_TRUE(std::isnan(array.unwrapped(1)));
+}
+
+} // namespace
+} // namespace robocin
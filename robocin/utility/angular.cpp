@@ -4,3 +4,260 @@
 //
 
 #include "robocin/utility/angular.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "robocin/utility/internal/angular_dispatch.h"
+#include "robocin/utility/internal/angular_kernels.h"
+
+namespace robocin {
+
+constinit const internal::AngularKernelSet internal::kScalarAngularKernels =
+    internal::angularKernelSet<internal::simd::None>();
+#if defined(__SSE2__)
+constinit const internal::AngularKernelSet internal::kSse2AngularKernels =
+    internal::angularKernelSet<internal::simd::Sse2>();
+#endif
+
+namespace {
+
+namespace simd = internal::simd;
+
+using internal::AbsSmallestAngleDiff;
+using internal::AngularKernels;
+using internal::DegreesToRadians;
+using internal::NormalizeAngle;
+using internal::RadiansToDegrees;
+using internal::SmallestAngleDiff;
+
+constexpr internal::SimdKernelTable<internal::AngularKernelSet> kKernelTable{
+    &internal::kScalarAngularKernels,
+#if defined(__SSE2__)
+    &internal::kSse2AngularKernels,
+#else
+    nullptr,
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+    &internal::kAvx2AngularKernels,
+    &internal::kAvx512AngularKernels,
+#else
+    nullptr,
+    nullptr,
+#endif
+};
+
+// The kernels of the active instruction set, for 'F'.
+template <std::floating_point F>
+const AngularKernels<F>& kernels() {
+  const internal::AngularKernelSet& kSet = internal::dispatchSimdKernels(kKernelTable);
+  if constexpr (std::same_as<F, float>) {
+    return kSet.for_float;
+  } else {
+    return kSet.for_double;
+  }
+}
+
+// Half precision ----------------------------------------------------------------------------------
+// The values are widened to 'float' a chunk at a time, into the stack, so that the 'float' kernels
+// compute them, and their results are rounded back.
+
+inline constexpr std::size_t kWidenedChunkSize = 256;
+
+using ChunkBuffer = std::array<float, kWidenedChunkSize>;
+
+template <AngularKernels<float>::Unary AngularKernels<float>::*kKernel, narrow_floating_point N>
+void widenedTransform(std::span<const N> input, std::span<N> output) {
+  assert(input.size() == output.size());
+
+  const auto kKernelOfIsa = kernels<float>().*kKernel;
+
+  ChunkBuffer buffer; // NOLINT(*-member-init)
+  for (std::size_t first = 0; first < input.size(); first += kWidenedChunkSize) {
+    const std::span<float> kChunk =
+        std::span{buffer}.first(std::min(kWidenedChunkSize, input.size() - first));
+
+    std::ranges::copy(input.subspan(first, kChunk.size()), kChunk.begin());
+    kKernelOfIsa(kChunk, kChunk);
+    std::ranges::copy(kChunk, output.subspan(first).begin());
+  }
+}
+
+template <AngularKernels<float>::Binary AngularKernels<float>::*kKernel, narrow_floating_point N>
+void widenedTransform(std::span<const N> lhs, std::span<const N> rhs, std::span<N> output) {
+  assert(lhs.size() == rhs.size() and lhs.size() == output.size());
+
+  const auto kKernelOfIsa = kernels<float>().*kKernel;
+
+  ChunkBuffer lhs_buffer; // NOLINT(*-member-init)
+  ChunkBuffer rhs_buffer; // NOLINT(*-member-init)
+  for (std::size_t first = 0; first < lhs.size(); first += kWidenedChunkSize) {
+    const std::size_t kSize = std::min(kWidenedChunkSize, lhs.size() - first);
+    const std::span<float> kLhs = std::span{lhs_buffer}.first(kSize);
+    const std::span<float> kRhs = std::span{rhs_buffer}.first(kSize);
+
+    std::ranges::copy(lhs.subspan(first, kSize), kLhs.begin());
+    std::ranges::copy(rhs.subspan(first, kSize), kRhs.begin());
+    kKernelOfIsa(kLhs, kRhs, kLhs);
+    std::ranges::copy(kLhs, output.subspan(first).begin());
+  }
+}
+
+} // namespace
+
+// degreesToRadians --------------------------------------------------------------------------------
+void degreesToRadians(std::span<const float> degrees, std::span<float> radians) {
+  kernels<float>().degrees_to_radians(degrees, radians);
+}
+
+void degreesToRadians(std::span<const double> degrees, std::span<double> radians) {
+  kernels<double>().degrees_to_radians(degrees, radians);
+}
+
+void degreesToRadians(std::span<const long double> degrees, std::span<long double> radians) {
+  simd::transform<simd::None, DegreesToRadians, long double>(degrees, radians);
+}
+
+// radiansToDegrees --------------------------------------------------------------------------------
+void radiansToDegrees(std::span<const float> radians, std::span<float> degrees) {
+  kernels<float>().radians_to_degrees(radians, degrees);
+}
+
+void radiansToDegrees(std::span<const double> radians, std::span<double> degrees) {
+  kernels<double>().radians_to_degrees(radians, degrees);
+}
+
+void radiansToDegrees(std::span<const long double> radians, std::span<long double> degrees) {
+  simd::transform<simd::None, RadiansToDegrees, long double>(radians, degrees);
+}
+
+// normalizeAngles ---------------------------------------------------------------------------------
+void normalizeAngles(std::span<const float> angles, std::span<float> normalized) {
+  kernels<float>().normalize_angles(angles, normalized);
+}
+
+void normalizeAngles(std::span<const double> angles, std::span<double> normalized) {
+  kernels<double>().normalize_angles(angles, normalized);
+}
+
+void normalizeAngles(std::span<const long double> angles, std::span<long double> normalized) {
+  simd::transform<simd::None, NormalizeAngle, long double>(angles, normalized);
+}
+
+void normalizeAngles(std::span<float> angles) {
+  kernels<float>().normalize_angles(angles, angles);
+}
+
+void normalizeAngles(std::span<double> angles) {
+  kernels<double>().normalize_angles(angles, angles);
+}
+
+void normalizeAngles(std::span<long double> angles) {
+  simd::transform<simd::None, NormalizeAngle, long double>(angles, angles);
+}
+
+// smallestAngleDiffs ------------------------------------------------------------------------------
+void smallestAngleDiffs(std::span<const float> lhs,
+                        std::span<const float> rhs,
+                        std::span<float> diffs) {
+  kernels<float>().smallest_angle_diffs(lhs, rhs, diffs);
+}
+
+void smallestAngleDiffs(std::span<const double> lhs,
+                        std::span<const double> rhs,
+                        std::span<double> diffs) {
+  kernels<double>().smallest_angle_diffs(lhs, rhs, diffs);
+}
+
+void smallestAngleDiffs(std::span<const long double> lhs,
+                        std::span<const long double> rhs,
+                        std::span<long double> diffs) {
+  simd::transform<simd::None, SmallestAngleDiff, long double>(lhs, rhs, diffs);
+}
+
+// absSmallestAngleDiffs ---------------------------------------------------------------------------
+void absSmallestAngleDiffs(std::span<const float> lhs,
+                           std::span<const float> rhs,
+                           std::span<float> diffs) {
+  kernels<float>().abs_smallest_angle_diffs(lhs, rhs, diffs);
+}
+
+void absSmallestAngleDiffs(std::span<const double> lhs,
+                           std::span<const double> rhs,
+                           std::span<double> diffs) {
+  kernels<double>().abs_smallest_angle_diffs(lhs, rhs, diffs);
+}
+
+void absSmallestAngleDiffs(std::span<const long double> lhs,
+                           std::span<const long double> rhs,
+                           std::span<long double> diffs) {
+  simd::transform<simd::None, AbsSmallestAngleDiff, long double>(lhs, rhs, diffs);
+}
+
+// Half precision overloads ------------------------------------------------------------------------
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+void degreesToRadians(std::span<const float16_t> degrees, std::span<float16_t> radians) {
+  widenedTransform<&AngularKernels<float>::degrees_to_radians>(degrees, radians);
+}
+
+void radiansToDegrees(std::span<const float16_t> radians, std::span<float16_t> degrees) {
+  widenedTransform<&AngularKernels<float>::radians_to_degrees>(radians, degrees);
+}
+
+void normalizeAngles(std::span<const float16_t> angles, std::span<float16_t> normalized) {
+  widenedTransform<&AngularKernels<float>::normalize_angles>(angles, normalized);
+}
+
+void normalizeAngles(std::span<float16_t> angles) {
+  widenedTransform<&AngularKernels<float>::normalize_angles, float16_t>(angles, angles);
+}
+
+void smallestAngleDiffs(std::span<const float16_t> lhs,
+                        std::span<const float16_t> rhs,
+                        std::span<float16_t> diffs) {
+  widenedTransform<&AngularKernels<float>::smallest_angle_diffs>(lhs, rhs, diffs);
+}
+
+void absSmallestAngleDiffs(std::span<const float16_t> lhs,
+                           std::span<const float16_t> rhs,
+                           std::span<float16_t> diffs) {
+  widenedTransform<&AngularKernels<float>::abs_smallest_angle_diffs>(lhs, rhs, diffs);
+}
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+void degreesToRadians(std::span<const bfloat16_t> degrees, std::span<bfloat16_t> radians) {
+  widenedTransform<&AngularKernels<float>::degrees_to_radians>(degrees, radians);
+}
+
+void radiansToDegrees(std::span<const bfloat16_t> radians, std::span<bfloat16_t> degrees) {
+  widenedTransform<&AngularKernels<float>::radians_to_degrees>(radians, degrees);
+}
+
+void normalizeAngles(std::span<const bfloat16_t> angles, std::span<bfloat16_t> normalized) {
+  widenedTransform<&AngularKernels<float>::normalize_angles>(angles, normalized);
+}
+
+void normalizeAngles(std::span<bfloat16_t> angles) {
+  widenedTransform<&AngularKernels<float>::normalize_angles, bfloat16_t>(angles, angles);
+}
+
+void smallestAngleDiffs(std::span<const bfloat16_t> lhs,
+                        std::span<const bfloat16_t> rhs,
+                        std::span<bfloat16_t> diffs) {
+  widenedTransform<&AngularKernels<float>::smallest_angle_diffs>(lhs, rhs, diffs);
+}
+
+void absSmallestAngleDiffs(std::span<const bfloat16_t> lhs,
+                           std::span<const bfloat16_t> rhs,
+                           std::span<bfloat16_t> diffs) {
+  widenedTransform<&AngularKernels<float>::abs_smallest_angle_diffs>(lhs, rhs, diffs);
+}
+#endif
+
+} // namespace robocin
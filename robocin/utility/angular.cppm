@@ -0,0 +1,45 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The 'robocin.utility.angular' module interface, built when 'ROBOCIN_CPP_MODULES' is set. It
+// exports the declarations of 'angular.h', which is included in the global module fragment.
+
+module;
+
+#include "robocin/utility/angular.h"
+
+export module robocin.utility.angular;
+
+export namespace robocin {
+
+// concepts.h / type_traits.h.
+using robocin::arithmetic;
+using robocin::contiguous_arithmetic_range;
+using robocin::contiguous_floating_point_range;
+using robocin::floating_point;
+using robocin::narrow_floating_point;
+using robocin::output_contiguous_arithmetic_range;
+#if defined(ROBOCIN_HAS_FLOAT16)
+using robocin::float16_t;
+#endif
+#if defined(ROBOCIN_HAS_BFLOAT16)
+using robocin::bfloat16_t;
+#endif
+
+// angular.h.
+using robocin::absSmallestAngleDiff;
+using robocin::degreesToRadians;
+using robocin::normalizeAngle;
+using robocin::normalizeAngleFast;
+using robocin::normalizeAngleFastMaxAngle;
+using robocin::normalizeAngleFastMaxError;
+using robocin::radiansToDegrees;
+using robocin::smallestAngleDiff;
+
+using robocin::absSmallestAngleDiffs;
+using robocin::normalizeAngles;
+using robocin::smallestAngleDiffs;
+
+} // namespace robocin
@@ -6,61 +6,337 @@
 #ifndef ROBOCIN_UTILITY_ANGULAR_H
 #define ROBOCIN_UTILITY_ANGULAR_H
 
+#include <cassert>
 #include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
 #include <numbers>
+#include <ranges>
+#include <span>
 
 #include "robocin/utility/concepts.h"
 
 namespace robocin {
+namespace internal {
+
+// The same 2 * pi used by 'normalizeAngle', split into a high part, whose product by a turn count
+// of up to 'kMaxTurns' is exact, and a low part, such that 'kHigh + kLow == kValue' (Cody-Waite
+// reduction). The split is done by Veltkamp's algorithm, which is exact and constexpr.
+template <std::floating_point F>
+struct TwoPi {
+  static constexpr F kValue = 2 * std::numbers::pi_v<F>;
+  static constexpr F kInverse = 1 / kValue;
+
+  static constexpr int kSplitBits = (std::numeric_limits<F>::digits + 1) / 2;
+  static constexpr F kMaxTurns = [] {
+    F result = 1;
+    for (int i = 0; i < kSplitBits; ++i) {
+      result *= 2;
+    }
+    return result - 1;
+  }();
+
+  static constexpr F kHigh = [] {
+    const F kScaled = (kMaxTurns + 2) * kValue;
+    return kScaled - (kScaled - kValue);
+  }();
+  static constexpr F kLow = kValue - kHigh;
+
+  // largest magnitude for which the reduction by 'kHigh' and 'kLow' is accurate.
+  static constexpr F kMaxReducible = kMaxTurns * kValue;
+};
+
+// 3 * 2^(digits - 2): a number whose unit in the last place is one.
+template <std::floating_point F>
+inline constexpr F kRoundingShifter = [] {
+  F result = 3;
+  for (int i = 2; i < std::numeric_limits<F>::digits; ++i) {
+    result *= 2;
+  }
+  return result;
+}();
+
+// Rounds to the nearest integer (ties to even) without branches, by adding and subtracting
+// 'kRoundingShifter'. It requires strict IEEE-754 arithmetic (no '-ffast-math') and
+// '|value| < 2^(digits - 2)'.
+template <std::floating_point F>
+constexpr F roundToNearest(F value) {
+  return (value + kRoundingShifter<F>) - kRoundingShifter<F>;
+}
+
+} // namespace internal
+
+// The scalar functions compute the half precision types (see 'widened_floating_point') in 'float',
+// rounding their results back.
 
 template <arithmetic T>
 constexpr auto degreesToRadians(T degrees) {
-  using F = std::conditional_t<std::floating_point<T>, T, double>;
+  if constexpr (narrow_floating_point<T>) {
+    return static_cast<T>(degreesToRadians(static_cast<float>(degrees)));
+  } else {
+    using F = std::conditional_t<std::floating_point<T>, T, double>;
 
-  constexpr F kDegreesToRadiansFactor = std::numbers::pi_v<F> / 180;
+    constexpr F kDegreesToRadiansFactor = std::numbers::pi_v<F> / 180;
 
-  return degrees * kDegreesToRadiansFactor;
+    return degrees * kDegreesToRadiansFactor;
+  }
 }
 
 template <arithmetic T>
 constexpr auto radiansToDegrees(T radians) {
-  using F = std::conditional_t<std::floating_point<T>, T, double>;
+  if constexpr (narrow_floating_point<T>) {
+    return static_cast<T>(radiansToDegrees(static_cast<float>(radians)));
+  } else {
+    using F = std::conditional_t<std::floating_point<T>, T, double>;
 
-  constexpr F kRadiansToDegreesFactor = 180 / std::numbers::pi_v<F>;
+    constexpr F kRadiansToDegreesFactor = 180 / std::numbers::pi_v<F>;
 
-  return radians * kRadiansToDegreesFactor;
+    return radians * kRadiansToDegreesFactor;
+  }
 }
 
 template <arithmetic T>
 constexpr auto normalizeAngle(T angle) {
-  using F = std::conditional_t<std::floating_point<T>, T, double>;
+  if constexpr (narrow_floating_point<T>) {
+    return static_cast<T>(normalizeAngle(static_cast<float>(angle)));
+  } else {
+    using F = std::conditional_t<std::floating_point<T>, T, double>;
+
+    constexpr F kPi = std::numbers::pi_v<F>;
+    constexpr F k2Pi = 2 * kPi;
 
-  constexpr F kPi = std::numbers::pi_v<F>;
-  constexpr F k2Pi = 2 * kPi;
+    if (-kPi <= angle && angle <= kPi) {
+      return static_cast<F>(angle);
+    }
 
-  if (-kPi <= angle && angle <= kPi) {
-    return static_cast<F>(angle);
+    F result = std::fmod(static_cast<F>(angle), k2Pi);
+    if (result < -kPi) {
+      result += k2Pi;
+    } else if (result > kPi) {
+      result -= k2Pi;
+    }
+    return result;
   }
+}
 
-  F result = std::fmod(static_cast<F>(angle), k2Pi);
-  if (result < -kPi) {
-    result += k2Pi;
-  } else if (result > kPi) {
-    result -= k2Pi;
+// Worst-case error of 'normalizeAngleFast' against 'normalizeAngle', modulo 2 * pi, for angles
+// whose magnitude is up to 'normalizeAngleFastMaxAngle<F>' (4 ulps of 1, i.e. 2 ulps of pi):
+//  -- float:       ~4.77e-7;
+//  -- double:      ~8.88e-16;
+//  -- long double: ~4.34e-19 (x87 80-bit extended precision).
+template <std::floating_point F>
+inline constexpr F normalizeAngleFastMaxError = 4 * std::numeric_limits<F>::epsilon();
+
+// Largest angle magnitude for which 'normalizeAngleFastMaxError' holds:
+//  -- float:       ~2.57e4 (4'095 turns);
+//  -- double:      ~8.43e8 (2^27 - 1 turns);
+//  -- long double: ~2.70e10 (2^32 - 1 turns).
+template <std::floating_point F>
+inline constexpr F normalizeAngleFastMaxAngle = internal::TwoPi<F>::kMaxReducible;
+
+// Branch-free, 'std::fmod'-free variant of 'normalizeAngle': the angle is reduced by the turn count
+// given by multiplying it by 1 / (2 * pi) and rounding to the nearest integer. Angles in [-pi, pi]
+// are returned unchanged, except at the seam, where pi may be mapped to -pi (and vice versa).
+template <arithmetic T>
+constexpr auto normalizeAngleFast(T angle) {
+  if constexpr (narrow_floating_point<T>) {
+    return static_cast<T>(normalizeAngleFast(static_cast<float>(angle)));
+  } else {
+    using F = std::conditional_t<std::floating_point<T>, T, double>;
+    using TwoPi = internal::TwoPi<F>;
+
+    const F kAngle = static_cast<F>(angle);
+    const F kTurns = internal::roundToNearest(kAngle * TwoPi::kInverse);
+
+    return (kAngle - kTurns * TwoPi::kHigh) - kTurns * TwoPi::kLow;
   }
-  return result;
 }
 
 template <arithmetic T, arithmetic U>
 constexpr auto smallestAngleDiff(T lhs, U rhs) {
-  using F = std::conditional_t<std::floating_point<std::common_type_t<T, U>>, T, double>;
+  if constexpr (narrow_floating_point<T>) {
+    return static_cast<T>(
+        smallestAngleDiff(static_cast<float>(lhs), static_cast<widened_floating_point_t<U>>(rhs)));
+  } else {
+    using F = std::conditional_t<std::floating_point<std::common_type_t<T, U>>, T, double>;
 
-  return normalizeAngle<F>(rhs - lhs);
+    return normalizeAngle<F>(rhs - lhs);
+  }
 }
 
 template <arithmetic T, arithmetic U>
 constexpr auto absSmallestAngleDiff(T lhs, U rhs) {
-  return std::abs(smallestAngleDiff(lhs, rhs));
+  using D = decltype(smallestAngleDiff(lhs, rhs));
+
+  const D kDiff = smallestAngleDiff(lhs, rhs);
+  if constexpr (narrow_floating_point<D>) {
+    return static_cast<D>(std::abs(static_cast<float>(kDiff)));
+  } else {
+    return std::abs(kDiff);
+  }
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+// The following functions apply the scalar functions above to every element of the given spans,
+// using vectorized kernels for 'float' and 'double' whenever the target supports them. Their
+// results stay within 'epsilon_v<T>' of the scalar functions. Output spans must have the same size
+// as the input spans and may alias them.
+
+void degreesToRadians(std::span<const float> degrees, std::span<float> radians);
+void degreesToRadians(std::span<const double> degrees, std::span<double> radians);
+void degreesToRadians(std::span<const long double> degrees, std::span<long double> radians);
+
+void radiansToDegrees(std::span<const float> radians, std::span<float> degrees);
+void radiansToDegrees(std::span<const double> radians, std::span<double> degrees);
+void radiansToDegrees(std::span<const long double> radians, std::span<long double> degrees);
+
+void normalizeAngles(std::span<const float> angles, std::span<float> normalized);
+void normalizeAngles(std::span<const double> angles, std::span<double> normalized);
+void normalizeAngles(std::span<const long double> angles, std::span<long double> normalized);
+
+void normalizeAngles(std::span<float> angles);
+void normalizeAngles(std::span<double> angles);
+void normalizeAngles(std::span<long double> angles);
+
+void smallestAngleDiffs(std::span<const float> lhs,
+                        std::span<const float> rhs,
+                        std::span<float> diffs);
+void smallestAngleDiffs(std::span<const double> lhs,
+                        std::span<const double> rhs,
+                        std::span<double> diffs);
+void smallestAngleDiffs(std::span<const long double> lhs,
+                        std::span<const long double> rhs,
+                        std::span<long double> diffs);
+
+void absSmallestAngleDiffs(std::span<const float> lhs,
+                           std::span<const float> rhs,
+                           std::span<float> diffs);
+void absSmallestAngleDiffs(std::span<const double> lhs,
+                           std::span<const double> rhs,
+                           std::span<double> diffs);
+void absSmallestAngleDiffs(std::span<const long double> lhs,
+                           std::span<const long double> rhs,
+                           std::span<long double> diffs);
+
+// Half precision overloads: the values are widened to 'float' in chunks, on the stack, and given to
+// the 'float' kernels, whose results are rounded back, as the scalar functions do.
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+void degreesToRadians(std::span<const float16_t> degrees, std::span<float16_t> radians);
+void radiansToDegrees(std::span<const float16_t> radians, std::span<float16_t> degrees);
+void normalizeAngles(std::span<const float16_t> angles, std::span<float16_t> normalized);
+void normalizeAngles(std::span<float16_t> angles);
+void smallestAngleDiffs(std::span<const float16_t> lhs,
+                        std::span<const float16_t> rhs,
+                        std::span<float16_t> diffs);
+void absSmallestAngleDiffs(std::span<const float16_t> lhs,
+                           std::span<const float16_t> rhs,
+                           std::span<float16_t> diffs);
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+void degreesToRadians(std::span<const bfloat16_t> degrees, std::span<bfloat16_t> radians);
+void radiansToDegrees(std::span<const bfloat16_t> radians, std::span<bfloat16_t> degrees);
+void normalizeAngles(std::span<const bfloat16_t> angles, std::span<bfloat16_t> normalized);
+void normalizeAngles(std::span<bfloat16_t> angles);
+void smallestAngleDiffs(std::span<const bfloat16_t> lhs,
+                        std::span<const bfloat16_t> rhs,
+                        std::span<bfloat16_t> diffs);
+void absSmallestAngleDiffs(std::span<const bfloat16_t> lhs,
+                           std::span<const bfloat16_t> rhs,
+                           std::span<bfloat16_t> diffs);
+#endif
+
+// Range overloads ---------------------------------------------------------------------------------
+// The following overloads apply the scalar functions above to every element of contiguous ranges
+// (e.g. 'normalizeAngle(std::span<double>)' or 'smallestAngleDiff(lhs, rhs, diffs)' given vectors),
+// in place or into an output range. When every range has the same floating point value type, they
+// call the batch overloads above, hence the vectorized kernels; otherwise (e.g. mixed types or
+// integers), they loop over the scalar function, so that each element is promoted as it would be
+// by the scalar function. Output ranges must have the size of the input ranges and may alias them.
+
+namespace internal {
+
+template <class Batch, class Scalar, class Output, class... Inputs>
+void transformRanges(Batch batch, Scalar scalar, Output& output, const Inputs&... inputs) {
+  using F = std::ranges::range_value_t<Output>;
+
+  const std::size_t kSize = std::ranges::size(output);
+  assert(((std::ranges::size(inputs) == kSize) and ...));
+
+  if constexpr (floating_point<F>
+                and (std::same_as<std::ranges::range_value_t<Inputs>, F> and ...)) {
+    batch(std::span<const F>{inputs}..., std::span<F>{output});
+  } else {
+    F* const kOutput = std::ranges::data(output);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      kOutput[i] = static_cast<F>(scalar(std::ranges::data(inputs)[i]...));
+    }
+  }
+}
+
+} // namespace internal
+
+template <contiguous_arithmetic_range R, output_contiguous_arithmetic_range Output>
+void degreesToRadians(const R& degrees, Output&& radians) {
+  internal::transformRanges([](auto... spans) { degreesToRadians(spans...); },
+                            [](auto degree) { return degreesToRadians(degree); },
+                            radians,
+                            degrees);
+}
+
+template <output_contiguous_arithmetic_range R>
+void degreesToRadians(R&& angles) {
+  degreesToRadians(angles, angles);
+}
+
+template <contiguous_arithmetic_range R, output_contiguous_arithmetic_range Output>
+void radiansToDegrees(const R& radians, Output&& degrees) {
+  internal::transformRanges([](auto... spans) { radiansToDegrees(spans...); },
+                            [](auto radian) { return radiansToDegrees(radian); },
+                            degrees,
+                            radians);
+}
+
+template <output_contiguous_arithmetic_range R>
+void radiansToDegrees(R&& angles) {
+  radiansToDegrees(angles, angles);
+}
+
+template <contiguous_arithmetic_range R, output_contiguous_arithmetic_range Output>
+void normalizeAngle(const R& angles, Output&& normalized) {
+  internal::transformRanges([](auto... spans) { normalizeAngles(spans...); },
+                            [](auto angle) { return normalizeAngle(angle); },
+                            normalized,
+                            angles);
+}
+
+template <output_contiguous_arithmetic_range R>
+void normalizeAngle(R&& angles) {
+  normalizeAngle(angles, angles);
+}
+
+template <contiguous_arithmetic_range R,
+          contiguous_arithmetic_range U,
+          output_contiguous_arithmetic_range Output>
+void smallestAngleDiff(const R& lhs, const U& rhs, Output&& diffs) {
+  internal::transformRanges([](auto... spans) { smallestAngleDiffs(spans...); },
+                            [](auto left, auto right) { return smallestAngleDiff(left, right); },
+                            diffs,
+                            lhs,
+                            rhs);
+}
+
+template <contiguous_arithmetic_range R,
+          contiguous_arithmetic_range U,
+          output_contiguous_arithmetic_range Output>
+void absSmallestAngleDiff(const R& lhs, const U& rhs, Output&& diffs) {
+  internal::transformRanges([](auto... spans) { absSmallestAngleDiffs(spans...); },
+                            [](auto left, auto right) { return absSmallestAngleDiff(left, right); },
+                            diffs,
+                            lhs,
+                            rhs);
 }
 
 } // namespace robocin
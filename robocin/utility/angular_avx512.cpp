@@ -0,0 +1,39 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The kernels of the batch overloads of 'angular.h', compiled for AVX-512 (see 'cpu_dispatch.h').
+
+#include "robocin/utility/internal/angular_dispatch.h"
+
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+#include <immintrin.h>
+
+#include "robocin/utility/type_traits.h"
+
+// Every header the kernels depend on is included above, before the target changes, so that only the
+// kernels themselves are compiled for AVX-512, and not the inline functions they call, whose copies
+// the linker could otherwise keep for the whole program.
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512dq")
+#define ROBOCIN_SIMD_TARGET_AVX512
+#include "robocin/utility/internal/angular_kernels.h"
+#pragma GCC pop_options
+
+namespace robocin {
+
+constinit const internal::AngularKernelSet internal::kAvx512AngularKernels =
+    internal::angularKernelSet<internal::simd::Avx512>();
+
+} // namespace robocin
+#endif
@@ -0,0 +1,157 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angular.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumAngles = 1'024;
+
+// angles in [-pi, pi] if not 'out_of_range', in [-100 * pi, 100 * pi] otherwise.
+template <class T>
+std::vector<T> randomAngles(bool out_of_range, unsigned seed = 42) {
+  static constexpr double kPi = std::numbers::pi;
+
+  const double kMaxAngle = out_of_range ? 100 * kPi : kPi;
+
+  // drawn as 'double', hence integral types get the same angles, truncated.
+  const std::vector<double> kAngles = randomValues(-kMaxAngle, kMaxAngle, kNumAngles, seed);
+
+  std::vector<T> result(kAngles.size());
+  for (std::size_t i = 0; i < kAngles.size(); ++i) {
+    result[i] = static_cast<T>(kAngles[i]);
+  }
+  return result;
+}
+
+template <class T, class Function>
+void benchmarkUnary(benchmark::State& state, bool out_of_range, Function function) {
+  const std::vector<T> kAngles = randomAngles<T>(out_of_range);
+
+  for (auto _ : state) {
+    for (const T kAngle : kAngles) {
+      benchmark::DoNotOptimize(function(kAngle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+template <class T, class Function>
+void benchmarkBinary(benchmark::State& state, bool out_of_range, Function function) {
+  const std::vector<T> kLhs = randomAngles<T>(out_of_range, /*seed=*/42);
+  const std::vector<T> kRhs = randomAngles<T>(out_of_range, /*seed=*/7);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      benchmark::DoNotOptimize(function(kLhs[i], kRhs[i]));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLhs.size()));
+}
+
+// degreesToRadians --------------------------------------------------------------------------------
+template <class T>
+void BM_DegreesToRadians(benchmark::State& state) {
+  benchmarkUnary<T>(state, /*out_of_range=*/false, [](T degrees) {
+    return degreesToRadians(degrees);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_DegreesToRadians, float);
+BENCHMARK_TEMPLATE(BM_DegreesToRadians, double);
+BENCHMARK_TEMPLATE(BM_DegreesToRadians, long double);
+BENCHMARK_TEMPLATE(BM_DegreesToRadians, int);
+
+// radiansToDegrees --------------------------------------------------------------------------------
+template <class T>
+void BM_RadiansToDegrees(benchmark::State& state) {
+  benchmarkUnary<T>(state, /*out_of_range=*/false, [](T radians) {
+    return radiansToDegrees(radians);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_RadiansToDegrees, float);
+BENCHMARK_TEMPLATE(BM_RadiansToDegrees, double);
+BENCHMARK_TEMPLATE(BM_RadiansToDegrees, long double);
+BENCHMARK_TEMPLATE(BM_RadiansToDegrees, int);
+
+// normalizeAngle ----------------------------------------------------------------------------------
+template <class T>
+void BM_NormalizeAngle(benchmark::State& state) {
+  benchmarkUnary<T>(state, state.range(0) != 0, [](T angle) { return normalizeAngle(angle); });
+}
+
+BENCHMARK_TEMPLATE(BM_NormalizeAngle, float)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngle, double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngle, long double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngle, int)->ArgName("out_of_range")->Arg(0)->Arg(1);
+
+// normalizeAngleFast ------------------------------------------------------------------------------
+template <class T>
+void BM_NormalizeAngleFast(benchmark::State& state) {
+  benchmarkUnary<T>(state, state.range(0) != 0, [](T angle) { return normalizeAngleFast(angle); });
+}
+
+BENCHMARK_TEMPLATE(BM_NormalizeAngleFast, float)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngleFast, double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngleFast, long double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngleFast, int)->ArgName("out_of_range")->Arg(0)->Arg(1);
+
+// smallestAngleDiff -------------------------------------------------------------------------------
+template <class T>
+void BM_SmallestAngleDiff(benchmark::State& state) {
+  benchmarkBinary<T>(state, state.range(0) != 0, [](T lhs, T rhs) {
+    return smallestAngleDiff(lhs, rhs);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiff, float)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiff, double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiff, long double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SmallestAngleDiff, int)->ArgName("out_of_range")->Arg(0)->Arg(1);
+
+// absSmallestAngleDiff ----------------------------------------------------------------------------
+template <class T>
+void BM_AbsSmallestAngleDiff(benchmark::State& state) {
+  benchmarkBinary<T>(state, state.range(0) != 0, [](T lhs, T rhs) {
+    return absSmallestAngleDiff(lhs, rhs);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_AbsSmallestAngleDiff, float)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_AbsSmallestAngleDiff, double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_AbsSmallestAngleDiff, long double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_AbsSmallestAngleDiff, int)->ArgName("out_of_range")->Arg(0)->Arg(1);
+
+// normalizeAngles ---------------------------------------------------------------------------------
+template <class T>
+void BM_NormalizeAngles(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>(state.range(0) != 0);
+  std::vector<T> normalized(kAngles.size());
+
+  for (auto _ : state) {
+    normalizeAngles(kAngles, normalized);
+    benchmark::DoNotOptimize(normalized.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_NormalizeAngles, float)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngles, double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_NormalizeAngles, long double)->ArgName("out_of_range")->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace robocin
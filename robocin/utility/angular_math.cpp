@@ -0,0 +1,119 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angular_math.h"
+
+#include <concepts>
+#include <span>
+
+#include "robocin/utility/internal/angular_math_dispatch.h"
+#include "robocin/utility/internal/angular_math_kernels.h"
+
+namespace robocin {
+
+constinit const internal::AngularMathKernelSet internal::kScalarAngularMathKernels =
+    internal::angularMathKernelSet<internal::simd::None>();
+#if defined(__SSE2__)
+constinit const internal::AngularMathKernelSet internal::kSse2AngularMathKernels =
+    internal::angularMathKernelSet<internal::simd::Sse2>();
+#endif
+
+namespace {
+
+namespace simd = internal::simd;
+
+using internal::AngularMathKernels;
+using internal::FastAtan2;
+using internal::FastCos;
+using internal::FastSin;
+
+constexpr internal::SimdKernelTable<internal::AngularMathKernelSet> kKernelTable{
+    &internal::kScalarAngularMathKernels,
+#if defined(__SSE2__)
+    &internal::kSse2AngularMathKernels,
+#else
+    nullptr,
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+    &internal::kAvx2AngularMathKernels,
+    &internal::kAvx512AngularMathKernels,
+#else
+    nullptr,
+    nullptr,
+#endif
+};
+
+// The kernels of the active instruction set, for 'F'.
+template <std::floating_point F>
+const AngularMathKernels<F>& kernels() {
+  const internal::AngularMathKernelSet& kSet = internal::dispatchSimdKernels(kKernelTable);
+  if constexpr (std::same_as<F, float>) {
+    return kSet.for_float;
+  } else {
+    return kSet.for_double;
+  }
+}
+
+} // namespace
+
+// fastSin -----------------------------------------------------------------------------------------
+void fastSin(std::span<const float> angles, std::span<float> sines) {
+  kernels<float>().sin(angles, sines);
+}
+
+void fastSin(std::span<const double> angles, std::span<double> sines) {
+  kernels<double>().sin(angles, sines);
+}
+
+void fastSin(std::span<const long double> angles, std::span<long double> sines) {
+  simd::transform<simd::None, FastSin, long double>(angles, sines);
+}
+
+// fastCos -----------------------------------------------------------------------------------------
+void fastCos(std::span<const float> angles, std::span<float> cosines) {
+  kernels<float>().cos(angles, cosines);
+}
+
+void fastCos(std::span<const double> angles, std::span<double> cosines) {
+  kernels<double>().cos(angles, cosines);
+}
+
+void fastCos(std::span<const long double> angles, std::span<long double> cosines) {
+  simd::transform<simd::None, FastCos, long double>(angles, cosines);
+}
+
+// fastSinCos --------------------------------------------------------------------------------------
+void fastSinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines) {
+  kernels<float>().sin_cos(angles, sines, cosines);
+}
+
+void fastSinCos(std::span<const double> angles,
+                std::span<double> sines,
+                std::span<double> cosines) {
+  kernels<double>().sin_cos(angles, sines, cosines);
+}
+
+void fastSinCos(std::span<const long double> angles,
+                std::span<long double> sines,
+                std::span<long double> cosines) {
+  internal::sinCosKernel<simd::None, long double>(angles, sines, cosines);
+}
+
+// fastAtan2 ---------------------------------------------------------------------------------------
+void fastAtan2(std::span<const float> y, std::span<const float> x, std::span<float> angles) {
+  kernels<float>().atan2(y, x, angles);
+}
+
+void fastAtan2(std::span<const double> y, std::span<const double> x, std::span<double> angles) {
+  kernels<double>().atan2(y, x, angles);
+}
+
+void fastAtan2(std::span<const long double> y,
+               std::span<const long double> x,
+               std::span<long double> angles) {
+  simd::transform<simd::None, FastAtan2, long double>(y, x, angles);
+}
+
+} // namespace robocin
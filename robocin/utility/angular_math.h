@@ -0,0 +1,279 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_ANGULAR_MATH_H
+#define ROBOCIN_UTILITY_ANGULAR_MATH_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/concepts.h"
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/internal/angular_math_polynomials.h"
+
+namespace robocin {
+namespace internal {
+
+// pi / 2 as the unevaluated sum of three doubles (~159 bits).
+inline constexpr std::array<double, 3> kHalfPiParts{
+    0x1.921fb54442d18p+0,
+    0x1.1a62633145c07p-54,
+    -0x1.f1976b7ed8fbcp-110,
+};
+
+// pi / 2, split as 'TwoPi' is, so that quarter turns of up to 'TwoPi<F>::kMaxTurns' are reduced
+// accurately. Unlike 'TwoPi', whose sum is the 2 * pi used by 'normalizeAngle', 'kHigh + kLow' is
+// pi / 2 to twice the precision of 'F', as 'std::sin' and 'std::cos' require.
+template <std::floating_point F>
+struct HalfPi {
+  static constexpr F kValue = std::numbers::pi_v<F> / 2;
+  static constexpr F kInverse = 2 / std::numbers::pi_v<F>;
+
+  static constexpr F kHigh = [] {
+    const F kScaled = (TwoPi<F>::kMaxTurns + 2) * kValue;
+    return kScaled - (kScaled - kValue);
+  }();
+  static constexpr F kLow = static_cast<F>(
+      ((static_cast<long double>(kHalfPiParts[0]) - kHigh) + kHalfPiParts[1]) + kHalfPiParts[2]);
+
+  static constexpr F kMaxReducible = TwoPi<F>::kMaxTurns * kValue;
+};
+
+// Upper bound of the rounding errors of the functions below, in addition to the approximation error
+// of their polynomials.
+template <std::floating_point F>
+inline constexpr F kAngularMathRoundingError = 8 * std::numeric_limits<F>::epsilon();
+
+// The error the polynomials are chosen for: the injected epsilon, if any, but never less than the
+// machine epsilon (i.e. the most accurate the type allows).
+template <std::floating_point F>
+constexpr long double angularMathTargetError() {
+  constexpr long double kMachineEpsilon = std::numeric_limits<F>::epsilon();
+
+  if constexpr (has_epsilon_v<F>) {
+    return std::max(static_cast<long double>(epsilon_v<F> - kAngularMathRoundingError<F>),
+                    kMachineEpsilon);
+  } else {
+    return kMachineEpsilon;
+  }
+}
+
+// The fewest terms whose approximation error is within 'angularMathTargetError<F>()'.
+template <std::floating_point F, template <std::size_t> class Polynomial, std::size_t Terms,
+          std::size_t MaxTerms>
+constexpr std::size_t polynomialTerms() {
+  if constexpr (Terms == MaxTerms or Polynomial<Terms>::kMaxError <= angularMathTargetError<F>()) {
+    return Terms;
+  } else {
+    return polynomialTerms<F, Polynomial, Terms + 1, MaxTerms>();
+  }
+}
+
+template <std::floating_point F>
+constexpr std::size_t sinCosTerms() {
+  return polynomialTerms<F, SinCosPolynomial, kMinSinCosTerms, kMaxSinCosTerms>();
+}
+
+template <std::floating_point F>
+constexpr std::size_t atanTerms() {
+  return polynomialTerms<F, AtanPolynomial, kMinAtanTerms, kMaxAtanTerms>();
+}
+
+// The coefficients of a polynomial, rounded to 'F' at compile time.
+template <std::floating_point F, const auto& Coefficients>
+inline constexpr auto kCoefficientsAs = [] {
+  std::array<F, std::size(Coefficients)> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = static_cast<F>(Coefficients[i]);
+  }
+  return result;
+}();
+
+template <const auto& Coefficients, std::floating_point F>
+constexpr F horner(F value) {
+  constexpr auto& kCoefficients = kCoefficientsAs<F, Coefficients>;
+
+  F result = kCoefficients.back();
+  for (std::size_t i = kCoefficients.size() - 1; i-- > 0;) {
+    result = result * value + kCoefficients[i];
+  }
+  return result;
+}
+
+template <std::floating_point F, std::size_t Terms>
+constexpr std::pair<F, F> fastSinCos(F angle) {
+  using HalfPi = internal::HalfPi<F>;
+  using Polynomial = SinCosPolynomial<Terms>;
+
+  if (not((angle < 0 ? -angle : angle) <= HalfPi::kMaxReducible)) [[unlikely]] {
+    angle = normalizeAngle(angle);
+    if (std::isnan(angle)) {
+      return {angle, angle};
+    }
+  }
+
+  const F kQuadrant = roundToNearest(angle * HalfPi::kInverse);
+  const F kReduced = (angle - kQuadrant * HalfPi::kHigh) - kQuadrant * HalfPi::kLow;
+  const F kSquared = kReduced * kReduced;
+
+  const std::array<F, 2> kSinCos{kReduced * horner<Polynomial::kSin>(kSquared),
+                                 horner<Polynomial::kCos>(kSquared)};
+
+  // quadrants 1 and 3 swap sin and cos, 2 and 3 negate sin, 1 and 2 negate cos. This is done by
+  // indexing and multiplying, since the quadrant of random angles is unpredictable.
+  const auto kIndex = static_cast<std::int64_t>(kQuadrant);
+  const auto kSinSign = static_cast<F>(1 - (kIndex & 2));
+  const auto kCosSign = static_cast<F>(1 - ((kIndex + 1) & 2));
+
+  return {kSinSign * kSinCos[kIndex & 1], kCosSign * kSinCos[(kIndex & 1) ^ 1]};
+}
+
+// 'std::copysign', which is not constexpr until C++23.
+template <std::floating_point F>
+constexpr F copySign(F magnitude, F sign) {
+  if constexpr (std::is_same_v<F, float>) {
+    return __builtin_copysignf(magnitude, sign);
+  } else if constexpr (std::is_same_v<F, double>) {
+    return __builtin_copysign(magnitude, sign);
+  } else if constexpr (std::is_same_v<F, long double>) {
+    return __builtin_copysignl(magnitude, sign);
+  } else {
+    return static_cast<F>(copySign(static_cast<float>(magnitude), static_cast<float>(sign)));
+  }
+}
+
+// The signs of zeros are those of 'std::atan2': the result has the sign of 'y', and a negative
+// zero 'x' is on the negative side (e.g. 'fastAtan2(-0.0, -0.0)' is -pi).
+template <std::floating_point F, std::size_t Terms>
+constexpr F fastAtan2(F y, F x) {
+  using Polynomial = AtanPolynomial<Terms>;
+
+  constexpr F kPi = std::numbers::pi_v<F>;
+  constexpr F kTanPiOver8 = std::numbers::sqrt2_v<F> - 1;
+
+  constexpr F kMaxFinite = std::numeric_limits<F>::max();
+
+  const F kAbsX = x < 0 ? -x : x;
+  const F kAbsY = y < 0 ? -y : y;
+
+  if (not(kAbsX <= kMaxFinite and kAbsY <= kMaxFinite)) [[unlikely]] {
+    return std::atan2(y, x); // NaN or infinity.
+  }
+
+  const F kMax = std::max(kAbsX, kAbsY);
+
+  // atan(t) = pi / 4 + atan((t - 1) / (t + 1)), so that the polynomial is only evaluated in
+  // [0, sqrt(2) - 1].
+  const F kRatio = kMax > 0 ? std::min(kAbsX, kAbsY) / kMax : F{0};
+  const bool kIsReduced = kRatio > kTanPiOver8;
+  const F kReduced = kIsReduced ? (kRatio - 1) / (kRatio + 1) : kRatio;
+
+  F result = kReduced * horner<Polynomial::kAtan>(kReduced * kReduced);
+  if (kIsReduced) {
+    result += kPi / 4;
+  }
+  if (kAbsY > kAbsX) {
+    result = kPi / 2 - result;
+  }
+  if (copySign(F{1}, x) < 0) {
+    result = kPi - result;
+  }
+  return copySign(result, y);
+}
+
+template <class T>
+using angular_math_floating_point_t = std::conditional_t<std::floating_point<T>, T, double>;
+
+} // namespace internal
+
+// Worst-case error of 'fastSin', 'fastCos' and 'fastSinCos' against their exact values, for angles
+// whose magnitude is up to 'fastSinCosMaxAngle<F>'.
+template <std::floating_point F, std::size_t Terms = internal::sinCosTerms<F>()>
+inline constexpr F fastSinCosMaxError = static_cast<F>(internal::SinCosPolynomial<Terms>::kMaxError)
+                                        + internal::kAngularMathRoundingError<F>;
+
+// Largest angle magnitude for which 'fastSinCosMaxError' holds (as 'normalizeAngleFastMaxAngle').
+// Larger angles are normalized by 'normalizeAngle' first.
+template <std::floating_point F>
+inline constexpr F fastSinCosMaxAngle = internal::HalfPi<F>::kMaxReducible;
+
+// Worst-case error of 'fastAtan2' against its exact value, for finite arguments. Zeros keep the
+// signs 'std::atan2' gives them.
+template <std::floating_point F, std::size_t Terms = internal::atanTerms<F>()>
+inline constexpr F fastAtan2MaxError = static_cast<F>(internal::AtanPolynomial<Terms>::kMaxError)
+                                       + internal::kAngularMathRoundingError<F>;
+
+// The following functions approximate 'std::sin', 'std::cos' and 'std::atan2' by minimax
+// polynomials, whose number of terms is chosen at compile time: the fewest that keep the error
+// within 'epsilon_v<F>' (or within the machine epsilon, when no epsilon is provided). 'Terms' may
+// also be given explicitly.
+
+template <arithmetic T,
+          std::size_t Terms = internal::sinCosTerms<internal::angular_math_floating_point_t<T>>()>
+constexpr auto fastSinCos(T angle) {
+  using F = internal::angular_math_floating_point_t<T>;
+
+  return internal::fastSinCos<F, Terms>(static_cast<F>(angle));
+}
+
+template <arithmetic T,
+          std::size_t Terms = internal::sinCosTerms<internal::angular_math_floating_point_t<T>>()>
+constexpr auto fastSin(T angle) {
+  return fastSinCos<T, Terms>(angle).first;
+}
+
+template <arithmetic T,
+          std::size_t Terms = internal::sinCosTerms<internal::angular_math_floating_point_t<T>>()>
+constexpr auto fastCos(T angle) {
+  return fastSinCos<T, Terms>(angle).second;
+}
+
+template <arithmetic T,
+          arithmetic U,
+          class F = internal::angular_math_floating_point_t<std::common_type_t<T, U>>,
+          std::size_t Terms = internal::atanTerms<F>()>
+constexpr auto fastAtan2(T y, U x) {
+  return internal::fastAtan2<F, Terms>(static_cast<F>(y), static_cast<F>(x));
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+// The following functions apply the scalar functions above to every element of the given spans,
+// using vectorized kernels for 'float' and 'double' whenever the target supports them. Their number
+// of terms is chosen by the epsilon configured at build time. Output spans must have the same size
+// as the input spans and may alias them.
+
+void fastSin(std::span<const float> angles, std::span<float> sines);
+void fastSin(std::span<const double> angles, std::span<double> sines);
+void fastSin(std::span<const long double> angles, std::span<long double> sines);
+
+void fastCos(std::span<const float> angles, std::span<float> cosines);
+void fastCos(std::span<const double> angles, std::span<double> cosines);
+void fastCos(std::span<const long double> angles, std::span<long double> cosines);
+
+void fastSinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines);
+void fastSinCos(std::span<const double> angles, std::span<double> sines, std::span<double> cosines);
+void fastSinCos(std::span<const long double> angles,
+                std::span<long double> sines,
+                std::span<long double> cosines);
+
+void fastAtan2(std::span<const float> y, std::span<const float> x, std::span<float> angles);
+void fastAtan2(std::span<const double> y, std::span<const double> x, std::span<double> angles);
+void fastAtan2(std::span<const long double> y,
+               std::span<const long double> x,
+               std::span<long double> angles);
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_ANGULAR_MATH_H
@@ -0,0 +1,38 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The kernels of the batch overloads of 'angular_math.h', compiled for AVX2 (see
+// 'cpu_dispatch.h').
+
+#include "robocin/utility/internal/angular_math_dispatch.h"
+
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#include <immintrin.h>
+
+#include "robocin/utility/type_traits.h"
+
+// As in 'angular_avx2.cpp', every header the kernels depend on is included before the target
+// changes, so that only the kernels themselves are compiled for AVX2.
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define ROBOCIN_SIMD_TARGET_AVX2
+#include "robocin/utility/internal/angular_math_kernels.h"
+#pragma GCC pop_options
+
+namespace robocin {
+
+constinit const internal::AngularMathKernelSet internal::kAvx2AngularMathKernels =
+    internal::angularMathKernelSet<internal::simd::Avx2>();
+
+} // namespace robocin
+#endif
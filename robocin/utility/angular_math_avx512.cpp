@@ -0,0 +1,38 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The kernels of the batch overloads of 'angular_math.h', compiled for AVX-512 (see
+// 'cpu_dispatch.h').
+
+#include "robocin/utility/internal/angular_math_dispatch.h"
+
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#include <immintrin.h>
+
+#include "robocin/utility/type_traits.h"
+
+// As in 'angular_avx512.cpp', every header the kernels depend on is included before the target
+// changes, so that only the kernels themselves are compiled for AVX-512.
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512dq")
+#define ROBOCIN_SIMD_TARGET_AVX512
+#include "robocin/utility/internal/angular_math_kernels.h"
+#pragma GCC pop_options
+
+namespace robocin {
+
+constinit const internal::AngularMathKernelSet internal::kAvx512AngularMathKernels =
+    internal::angularMathKernelSet<internal::simd::Avx512>();
+
+} // namespace robocin
+#endif
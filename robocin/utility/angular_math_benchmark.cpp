@@ -0,0 +1,148 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angular_math.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumValues = 1'024;
+
+template <class T>
+std::vector<T> randomAngles() {
+  return randomValues<T>(-std::numbers::pi_v<T>, std::numbers::pi_v<T>, kNumValues);
+}
+
+template <class T, class Function>
+void benchmarkUnary(benchmark::State& state, Function function) {
+  const std::vector<T> kAngles = randomAngles<T>();
+
+  for (auto _ : state) {
+    for (const T kAngle : kAngles) {
+      benchmark::DoNotOptimize(function(kAngle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+template <class T, class Function>
+void benchmarkAtan2(benchmark::State& state, Function function) {
+  const std::vector<T> kY = randomValues<T>(-10, 10, kNumValues, /*seed=*/42);
+  const std::vector<T> kX = randomValues<T>(-10, 10, kNumValues, /*seed=*/7);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kY.size(); ++i) {
+      benchmark::DoNotOptimize(function(kY[i], kX[i]));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kY.size()));
+}
+
+// sin ---------------------------------------------------------------------------------------------
+template <class T>
+void BM_StdSin(benchmark::State& state) {
+  benchmarkUnary<T>(state, [](T angle) { return std::sin(angle); });
+}
+
+template <class T>
+void BM_FastSin(benchmark::State& state) {
+  benchmarkUnary<T>(state, [](T angle) { return fastSin(angle); });
+}
+
+BENCHMARK_TEMPLATE(BM_StdSin, float);
+BENCHMARK_TEMPLATE(BM_StdSin, double);
+BENCHMARK_TEMPLATE(BM_StdSin, long double);
+BENCHMARK_TEMPLATE(BM_FastSin, float);
+BENCHMARK_TEMPLATE(BM_FastSin, double);
+BENCHMARK_TEMPLATE(BM_FastSin, long double);
+
+// sin and cos -------------------------------------------------------------------------------------
+template <class T>
+void BM_StdSinCos(benchmark::State& state) {
+  benchmarkUnary<T>(state, [](T angle) { return std::sin(angle) + std::cos(angle); });
+}
+
+template <class T>
+void BM_FastSinCos(benchmark::State& state) {
+  benchmarkUnary<T>(state, [](T angle) {
+    const auto [kSin, kCos] = fastSinCos(angle);
+    return kSin + kCos;
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_StdSinCos, float);
+BENCHMARK_TEMPLATE(BM_StdSinCos, double);
+BENCHMARK_TEMPLATE(BM_StdSinCos, long double);
+BENCHMARK_TEMPLATE(BM_FastSinCos, float);
+BENCHMARK_TEMPLATE(BM_FastSinCos, double);
+BENCHMARK_TEMPLATE(BM_FastSinCos, long double);
+
+// atan2 -------------------------------------------------------------------------------------------
+template <class T>
+void BM_StdAtan2(benchmark::State& state) {
+  benchmarkAtan2<T>(state, [](T y, T x) { return std::atan2(y, x); });
+}
+
+template <class T>
+void BM_FastAtan2(benchmark::State& state) {
+  benchmarkAtan2<T>(state, [](T y, T x) { return fastAtan2(y, x); });
+}
+
+BENCHMARK_TEMPLATE(BM_StdAtan2, float);
+BENCHMARK_TEMPLATE(BM_StdAtan2, double);
+BENCHMARK_TEMPLATE(BM_StdAtan2, long double);
+BENCHMARK_TEMPLATE(BM_FastAtan2, float);
+BENCHMARK_TEMPLATE(BM_FastAtan2, double);
+BENCHMARK_TEMPLATE(BM_FastAtan2, long double);
+
+// batch overloads ---------------------------------------------------------------------------------
+template <class T>
+void BM_FastSinCosSpans(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>();
+  std::vector<T> sines(kAngles.size());
+  std::vector<T> cosines(kAngles.size());
+
+  for (auto _ : state) {
+    fastSinCos(kAngles, sines, cosines);
+    benchmark::DoNotOptimize(sines.data());
+    benchmark::DoNotOptimize(cosines.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+template <class T>
+void BM_FastAtan2Spans(benchmark::State& state) {
+  const std::vector<T> kY = randomValues<T>(-10, 10, kNumValues, /*seed=*/42);
+  const std::vector<T> kX = randomValues<T>(-10, 10, kNumValues, /*seed=*/7);
+  std::vector<T> angles(kY.size());
+
+  for (auto _ : state) {
+    fastAtan2(kY, kX, angles);
+    benchmark::DoNotOptimize(angles.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kY.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FastSinCosSpans, float);
+BENCHMARK_TEMPLATE(BM_FastSinCosSpans, double);
+BENCHMARK_TEMPLATE(BM_FastSinCosSpans, long double);
+BENCHMARK_TEMPLATE(BM_FastAtan2Spans, float);
+BENCHMARK_TEMPLATE(BM_FastAtan2Spans, double);
+BENCHMARK_TEMPLATE(BM_FastAtan2Spans, long double);
+
+} // namespace
+} // namespace robocin
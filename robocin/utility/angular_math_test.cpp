@@ -0,0 +1,247 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/angular_math.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// an odd size, so that the scalar tail of the vectorized kernels is also exercised.
+constexpr std::size_t kBatchSize = 1'003;
+
+// fastSin, fastCos and fastSinCos -----------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FastSinCosIsConstexpr) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kMaxError = fastSinCosMaxError<T>;
+
+  static_assert(fastSin(T{0}) == 0);
+  static_assert(std::abs(fastCos(T{0}) - 1) <= kMaxError);
+  static_assert(std::abs(fastSin(kPi / 2) - 1) <= kMaxError);
+  static_assert(std::abs(fastCos(kPi) + 1) <= kMaxError);
+  static_assert(std::abs(fastSinCos(-kPi / 2).first + 1) <= kMaxError);
+}
+
+TYPED_TEST(FloatingPointTest, FastSinCosMaxErrorIsWithinEpsilon) {
+  using T = TypeParam;
+
+  EXPECT_LE(fastSinCosMaxError<T>, epsilon_v<T>);
+  EXPECT_LE(fastAtan2MaxError<T>, epsilon_v<T>);
+  EXPECT_LE((fastSinCosMaxError<T, internal::kMaxSinCosTerms>), fastSinCosMaxError<T>);
+  EXPECT_LE((fastAtan2MaxError<T, internal::kMaxAtanTerms>), fastAtan2MaxError<T>);
+}
+
+TYPED_TEST(FloatingPointTest, FastSinCosWithinMaxErrorOfStd) {
+  using T = TypeParam;
+
+  static constexpr T kMaxAngle = fastSinCosMaxAngle<T>;
+  static constexpr std::size_t kMaxTerms = internal::kMaxSinCosTerms;
+
+  for (const T kAngle : randomValues<T>(-kMaxAngle, kMaxAngle, 100'000)) {
+    const long double kSin = std::sin(static_cast<long double>(kAngle));
+    const long double kCos = std::cos(static_cast<long double>(kAngle));
+    const auto [kFastSin, kFastCos] = fastSinCos(kAngle);
+
+    EXPECT_LE(std::abs(kFastSin - kSin), fastSinCosMaxError<T>);
+    EXPECT_LE(std::abs(kFastCos - kCos), fastSinCosMaxError<T>);
+    EXPECT_EQ(fastSin(kAngle), kFastSin);
+    EXPECT_EQ(fastCos(kAngle), kFastCos);
+
+    EXPECT_LE(std::abs(fastSin<T, kMaxTerms>(kAngle) - kSin), (fastSinCosMaxError<T, kMaxTerms>));
+    EXPECT_LE(std::abs(fastCos<T, kMaxTerms>(kAngle) - kCos), (fastSinCosMaxError<T, kMaxTerms>));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FastSinCosGivenAnglesBeyondMaxAngle) {
+  using T = TypeParam;
+
+  static constexpr T kMaxAngle = fastSinCosMaxAngle<T>;
+
+  for (const T kAngle : randomValues<T>(kMaxAngle, 100 * kMaxAngle, kBatchSize)) {
+    EXPECT_EQ(fastSin(kAngle), fastSin(normalizeAngle(kAngle)));
+    EXPECT_EQ(fastCos(-kAngle), fastCos(normalizeAngle(-kAngle)));
+  }
+  EXPECT_TRUE(std::isnan(fastSin(std::numeric_limits<T>::quiet_NaN())));
+  EXPECT_TRUE(std::isnan(fastCos(std::numeric_limits<T>::infinity())));
+}
+
+TYPED_TEST(FloatingPointTest, FastSinCosGivenSpans) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  std::vector<T> angles = randomValues<T>(-100 * kPi, 100 * kPi, kBatchSize);
+  angles[1] = std::numeric_limits<T>::quiet_NaN();
+  angles[2] = 2 * fastSinCosMaxAngle<T>;
+
+  std::vector<T> sines(angles.size());
+  std::vector<T> cosines(angles.size());
+
+  fastSinCos(angles, sines, cosines);
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    if (std::isnan(angles[i])) {
+      EXPECT_TRUE(std::isnan(sines[i]) and std::isnan(cosines[i]));
+      continue;
+    }
+    EXPECT_NEAR(sines[i], std::sin(angles[i]), kEpsilon);
+    EXPECT_NEAR(cosines[i], std::cos(angles[i]), kEpsilon);
+  }
+
+  std::vector<T> sinesOnly(angles.size());
+  std::vector<T> cosinesOnly(angles.size());
+
+  fastSin(angles, sinesOnly);
+  fastCos(angles, cosinesOnly);
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    if (not std::isnan(angles[i])) {
+      EXPECT_EQ(sinesOnly[i], sines[i]);
+      EXPECT_EQ(cosinesOnly[i], cosines[i]);
+    }
+  }
+}
+
+// fastAtan2 ---------------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FastAtan2IsConstexpr) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kMaxError = fastAtan2MaxError<T>;
+
+  static_assert(fastAtan2(T{0}, T{0}) == 0);
+  static_assert(fastAtan2(T{0}, T{1}) == 0);
+  static_assert(std::abs(fastAtan2(T{0}, T{-1}) - kPi) <= kMaxError);
+  static_assert(std::abs(fastAtan2(T{1}, T{0}) - kPi / 2) <= kMaxError);
+  static_assert(std::abs(fastAtan2(T{-1}, T{-1}) + 3 * kPi / 4) <= kMaxError);
+}
+
+TYPED_TEST(FloatingPointTest, FastAtan2KeepsTheSignsOfZeros) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kMaxError = fastAtan2MaxError<T>;
+
+  // the result has the sign of 'y', and a negative zero 'x' is on the negative side.
+  static_assert(std::abs(fastAtan2(T{-0.0}, T{-1}) + kPi) <= kMaxError);
+  static_assert(std::abs(fastAtan2(T{0}, T{-0.0}) - kPi) <= kMaxError);
+  static_assert(std::abs(fastAtan2(T{-0.0}, T{-0.0}) + kPi) <= kMaxError);
+
+  const std::vector<T> kY{0, -0.0, 0, -0.0, 0, -0.0, 0, -0.0, 0};
+  const std::vector<T> kX{0, 0, -0.0, -0.0, 1, 1, -1, -1, -0.0};
+  std::vector<T> angles(kY.size());
+  fastAtan2(kY, kX, angles);
+
+  for (std::size_t i = 0; i < kY.size(); ++i) {
+    const T kAtan2 = std::atan2(kY[i], kX[i]);
+
+    EXPECT_EQ(std::signbit(fastAtan2(kY[i], kX[i])), std::signbit(kAtan2)) << i;
+    EXPECT_LE(std::abs(fastAtan2(kY[i], kX[i]) - kAtan2), kMaxError) << i;
+    EXPECT_EQ(std::signbit(angles[i]), std::signbit(kAtan2)) << i;
+    EXPECT_LE(std::abs(angles[i] - kAtan2), kMaxError) << i;
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FastAtan2WithinMaxErrorOfStd) {
+  using T = TypeParam;
+
+  static constexpr std::size_t kMaxTerms = internal::kMaxAtanTerms;
+
+  const std::vector<T> kY = randomValues<T>(-10, 10, 100'000, /*seed=*/42);
+  const std::vector<T> kX = randomValues<T>(-10, 10, 100'000, /*seed=*/7);
+
+  for (std::size_t i = 0; i < kY.size(); ++i) {
+    const long double kAtan2 =
+        std::atan2(static_cast<long double>(kY[i]), static_cast<long double>(kX[i]));
+
+    EXPECT_LE(std::abs(fastAtan2(kY[i], kX[i]) - kAtan2), fastAtan2MaxError<T>);
+    EXPECT_LE(std::abs(fastAtan2<T, T, T, kMaxTerms>(kY[i], kX[i]) - kAtan2),
+              (fastAtan2MaxError<T, kMaxTerms>));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FastAtan2GivenSpans) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::vector<T> y = randomValues<T>(-10, 10, kBatchSize, /*seed=*/42);
+  std::vector<T> x = randomValues<T>(-10, 10, kBatchSize, /*seed=*/7);
+  y[0] = x[0] = 0;
+  y[1] = x[2] = std::numeric_limits<T>::infinity();
+  y[3] = std::numeric_limits<T>::quiet_NaN();
+
+  std::vector<T> angles(y.size());
+
+  fastAtan2(y, x, angles);
+  for (std::size_t i = 0; i < y.size(); ++i) {
+    if (std::isnan(y[i])) {
+      EXPECT_TRUE(std::isnan(angles[i]));
+      continue;
+    }
+    EXPECT_NEAR(angles[i], std::atan2(y[i], x[i]), kEpsilon);
+  }
+}
+
+// dispatched kernels ------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, BatchOverloadsOfEverySupportedSimdIsaMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  std::vector<T> angles = randomValues<T>(-100 * kPi, 100 * kPi, kBatchSize);
+  angles[1] = 2 * fastSinCosMaxAngle<T>;
+  const std::vector<T> kX = randomValues<T>(-10, 10, kBatchSize, /*seed=*/7);
+
+  for (const SimdIsa kIsa : kSimdIsas) {
+    if (not isSimdIsaSupported(kIsa)) {
+      continue;
+    }
+    const ScopedSimdIsa kScope{kIsa};
+
+    std::vector<T> sines(angles.size());
+    fastSin(angles, sines);
+    std::vector<T> cosines(angles.size());
+    fastCos(angles, cosines);
+    std::vector<T> pairedSines(angles.size());
+    std::vector<T> pairedCosines(angles.size());
+    fastSinCos(angles, pairedSines, pairedCosines);
+    std::vector<T> atan2s(angles.size());
+    fastAtan2(angles, kX, atan2s);
+
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+      ASSERT_NEAR(sines[i], fastSin(angles[i]), kEpsilon) << simdIsaName(kIsa);
+      ASSERT_NEAR(cosines[i], fastCos(angles[i]), kEpsilon) << simdIsaName(kIsa);
+      ASSERT_EQ(pairedSines[i], sines[i]) << simdIsaName(kIsa);
+      ASSERT_EQ(pairedCosines[i], cosines[i]) << simdIsaName(kIsa);
+      ASSERT_NEAR(atan2s[i], fastAtan2(angles[i], kX[i]), kEpsilon) << simdIsaName(kIsa);
+    }
+  }
+}
+
+} // namespace
+} // namespace robocin
@@ -5,12 +5,19 @@
 
 #include "robocin/utility/angular.h"
 
+#include <array>
+#include <concepts>
+#include <cstddef>
 #include <numbers>
 #include <ranges>
+#include <span>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "robocin/utility/cpu_dispatch.h"
 #include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
 
 namespace robocin {
 namespace {
@@ -24,6 +31,9 @@ template <class>
 class FloatingPointTest : public Test {};
 TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
 
+// an odd size, so that the scalar tail of the vectorized kernels is also exercised.
+constexpr std::size_t kBatchSize = 1'003;
+
 // degreesToRadians --------------------------------------------------------------------------------
 TYPED_TEST(FloatingPointTest, DegreesToRadiansGivenPiFractions) {
   using T = TypeParam;
@@ -92,6 +102,52 @@ TYPED_TEST(FloatingPointTest, NormalizeAngleGivenAnglesLessThanMinusPi) {
   EXPECT_NEAR(normalizeAngle<T>(11 * kPi / 3), -kPi / 3, kEpsilon); // 660.0 degrees
 }
 
+// normalizeAngleFast ------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, NormalizeAngleFastIsConstexpr) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  static_assert(normalizeAngleFast<T>(0.0) == 0.0);
+  static_assert(normalizeAngleFast<T>(kPi / 2) == kPi / 2);
+  static_assert(normalizeAngleFast<T>(-kPi / 2) == -kPi / 2);
+  static_assert(normalizeAngleFast<T>(5 * kPi / 2) > 0);
+  static_assert(normalizeAngleFast<T>(-5 * kPi / 2) < 0);
+}
+
+TYPED_TEST(FloatingPointTest, NormalizeAngleFastGivenAnglesOutsidePiAndMinusPi) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  EXPECT_NEAR(normalizeAngleFast<T>(5 * kPi / 4), -3 * kPi / 4, kEpsilon); // 225.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(-5 * kPi / 4), 3 * kPi / 4, kEpsilon); // -225.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(7 * kPi / 3), kPi / 3, kEpsilon);      // 420.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(-7 * kPi / 3), -kPi / 3, kEpsilon);    // -420.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(-9 * kPi / 4), -kPi / 4, kEpsilon);    // -405.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(9 * kPi / 4), kPi / 4, kEpsilon);      // 405.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(-11 * kPi / 3), kPi / 3, kEpsilon);    // -660.0 degrees
+  EXPECT_NEAR(normalizeAngleFast<T>(11 * kPi / 3), -kPi / 3, kEpsilon);    // 660.0 degrees
+}
+
+TYPED_TEST(FloatingPointTest, NormalizeAngleFastWithinMaxErrorOfNormalizeAngle) {
+  using T = TypeParam;
+  using L = long double;
+
+  static constexpr L k2Pi = 2 * std::numbers::pi_v<L>;
+
+  for (const T kMaxAngle : {T{4}, T{100}, normalizeAngleFastMaxAngle<T>}) {
+    for (const T kAngle : randomValues<T>(-kMaxAngle, kMaxAngle, 100'000)) {
+      L diff = static_cast<L>(normalizeAngleFast(kAngle)) - static_cast<L>(normalizeAngle(kAngle));
+      // pi and -pi are the same angle.
+      diff = std::remainder(diff, k2Pi);
+
+      EXPECT_LE(std::abs(diff), normalizeAngleFastMaxError<T>) << "angle: " << kAngle;
+    }
+  }
+}
+
 // smallestAngleDiff -------------------------------------------------------------------------------
 TYPED_TEST(FloatingPointTest, SmallestAngleDiffGivenAnglesBetweenPiAndMinusPi) {
   using T = TypeParam;
@@ -166,5 +222,227 @@ TYPED_TEST(FloatingPointTest, AbsSmallestAngleDiffGivenAnglesOutsidePiAndMinusPi
   EXPECT_NEAR((absSmallestAngleDiff<T, T>(3 * kPi / 2, -5 * kPi / 2)), 0.0, kEpsilon);
 }
 
+// batch overloads ---------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, DegreesToRadiansAndRadiansToDegreesGivenSpans) {
+  using T = TypeParam;
+
+  const std::vector<T> kDegrees = randomValues<T>(-720, 720, kBatchSize);
+
+  std::vector<T> radians(kDegrees.size());
+  degreesToRadians(kDegrees, radians);
+
+  std::vector<T> degrees(kDegrees.size());
+  radiansToDegrees(radians, degrees);
+
+  for (std::size_t i = 0; i < kDegrees.size(); ++i) {
+    EXPECT_EQ(radians[i], degreesToRadians(kDegrees[i]));
+    EXPECT_EQ(degrees[i], radiansToDegrees(radians[i]));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, NormalizeAnglesGivenSpans) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  for (const T kTurns : {T{1}, T{10}, T{1'000}}) {
+    const std::vector<T> kAngles = randomValues<T>(-kTurns * kPi, kTurns * kPi, kBatchSize);
+
+    std::vector<T> normalized(kAngles.size());
+    normalizeAngles(kAngles, normalized);
+
+    std::vector<T> inPlace = kAngles;
+    normalizeAngles(inPlace);
+
+    for (std::size_t i = 0; i < kAngles.size(); ++i) {
+      EXPECT_NEAR(normalized[i], normalizeAngle(kAngles[i]), kEpsilon);
+      EXPECT_EQ(inPlace[i], normalized[i]);
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, NormalizeAnglesGivenSpansWithHugeAngles) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kAngles = randomValues<T>(-1e7, 1e7, kBatchSize);
+
+  std::vector<T> normalized(kAngles.size());
+  normalizeAngles(kAngles, normalized);
+
+  for (std::size_t i = 0; i < kAngles.size(); ++i) {
+    EXPECT_NEAR(normalized[i], normalizeAngle(kAngles[i]), kEpsilon);
+  }
+}
+
+TYPED_TEST(FloatingPointTest, SmallestAngleDiffsAndAbsSmallestAngleDiffsGivenSpans) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kLhs = randomValues<T>(-4 * kPi, 4 * kPi, kBatchSize);
+  const std::vector<T> kRhs = randomValues<T>(-kPi, kPi, kBatchSize);
+
+  std::vector<T> diffs(kLhs.size());
+  smallestAngleDiffs(kLhs, kRhs, diffs);
+
+  std::vector<T> absDiffs(kLhs.size());
+  absSmallestAngleDiffs(kLhs, kRhs, absDiffs);
+
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_NEAR(diffs[i], (smallestAngleDiff<T, T>(kLhs[i], kRhs[i])), kEpsilon);
+    EXPECT_NEAR(absDiffs[i], (absSmallestAngleDiff<T, T>(kLhs[i], kRhs[i])), kEpsilon);
+  }
+}
+
+// dispatched kernels ------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, BatchOverloadsOfEverySupportedSimdIsaMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  // angles within a few turns, and beyond the ones the vectorized reduction handles.
+  for (const T kTurns : {T{4}, T{1e6}}) {
+    const std::vector<T> kLhs = randomValues<T>(-kTurns * kPi, kTurns * kPi, kBatchSize);
+    const std::vector<T> kRhs = randomValues<T>(-kPi, kPi, kBatchSize);
+
+    for (const SimdIsa kIsa : kSimdIsas) {
+      if (not isSimdIsaSupported(kIsa)) {
+        continue;
+      }
+      const ScopedSimdIsa kScope{kIsa};
+
+      std::vector<T> radians(kLhs.size());
+      degreesToRadians(kLhs, radians);
+      std::vector<T> degrees(kLhs.size());
+      radiansToDegrees(kLhs, degrees);
+      std::vector<T> normalized = kLhs;
+      normalizeAngles(normalized);
+      std::vector<T> diffs(kLhs.size());
+      smallestAngleDiffs(kLhs, kRhs, diffs);
+      std::vector<T> absDiffs(kLhs.size());
+      absSmallestAngleDiffs(kLhs, kRhs, absDiffs);
+
+      for (std::size_t i = 0; i < kLhs.size(); ++i) {
+        ASSERT_EQ(radians[i], degreesToRadians(kLhs[i])) << simdIsaName(kIsa);
+        ASSERT_EQ(degrees[i], radiansToDegrees(kLhs[i])) << simdIsaName(kIsa);
+        ASSERT_NEAR(normalized[i], normalizeAngle(kLhs[i]), kEpsilon) << simdIsaName(kIsa);
+        ASSERT_NEAR(diffs[i], (smallestAngleDiff<T, T>(kLhs[i], kRhs[i])), kEpsilon)
+            << simdIsaName(kIsa);
+        ASSERT_NEAR(absDiffs[i], (absSmallestAngleDiff<T, T>(kLhs[i], kRhs[i])), kEpsilon)
+            << simdIsaName(kIsa);
+      }
+    }
+  }
+}
+
+// range overloads ---------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, RangeOverloadsMatchTheBatchOverloads) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomValues<T>(-4 * kPi, 4 * kPi, kBatchSize);
+  const std::vector<T> kTargets = randomValues<T>(-kPi, kPi, kBatchSize);
+
+  std::vector<T> expected(kAngles.size());
+  std::vector<T> actual(kAngles.size());
+
+  normalizeAngles(kAngles, expected);
+  normalizeAngle(kAngles, actual);
+  EXPECT_EQ(actual, expected);
+
+  // in place, given a span.
+  actual = kAngles;
+  normalizeAngle(std::span<T>{actual});
+  EXPECT_EQ(actual, expected);
+
+  degreesToRadians(std::span<const T>{kAngles}, std::span<T>{expected});
+  actual = kAngles;
+  degreesToRadians(actual);
+  EXPECT_EQ(actual, expected);
+
+  radiansToDegrees(std::span<const T>{kAngles}, std::span<T>{expected});
+  radiansToDegrees(kAngles, actual);
+  EXPECT_EQ(actual, expected);
+
+  smallestAngleDiffs(kAngles, kTargets, expected);
+  smallestAngleDiff(kAngles, kTargets, actual);
+  EXPECT_EQ(actual, expected);
+
+  absSmallestAngleDiffs(kAngles, kTargets, expected);
+  absSmallestAngleDiff(kAngles, kTargets, actual);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(AngularTest, RangeOverloadsGivenMixedTypesMatchTheScalarFunctions) {
+  const std::array<int, 5> kDegrees{-540, -90, 0, 180, 720};
+  std::vector<double> radians(kDegrees.size());
+  degreesToRadians(kDegrees, radians);
+  for (std::size_t i = 0; i < kDegrees.size(); ++i) {
+    EXPECT_EQ(radians[i], degreesToRadians(kDegrees[i]));
+  }
+
+  const std::vector<float> kLhs = randomValues<float>(-10, 10, kBatchSize);
+  const std::vector<double> kRhs = randomValues<double>(-10, 10, kBatchSize);
+  std::vector<double> diffs(kLhs.size());
+  smallestAngleDiff(kLhs, kRhs, diffs);
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_EQ(diffs[i], smallestAngleDiff(kLhs[i], kRhs[i]));
+  }
+}
+
+// Half precision ----------------------------------------------------------------------------------
+#if defined(ROBOCIN_HAS_FLOAT16)
+TEST(AngularTest, Float16ScalarFunctionsAreComputedInFloat) {
+  static constexpr auto kPi = static_cast<float16_t>(std::numbers::pi_v<float>);
+
+  static_assert(std::same_as<decltype(normalizeAngle(kPi)), float16_t>);
+  static_assert(std::same_as<decltype(absSmallestAngleDiff(kPi, kPi)), float16_t>);
+
+  for (const float kAngle : randomValues<float>(-100, 100, kBatchSize)) {
+    const auto kNormalized = normalizeAngle(static_cast<float16_t>(kAngle));
+
+    EXPECT_TRUE(-kPi <= kNormalized and kNormalized <= kPi) << kAngle;
+    EXPECT_EQ(kNormalized, static_cast<float16_t>(normalizeAngle(static_cast<float>(
+                               static_cast<float16_t>(kAngle)))));
+  }
+  EXPECT_EQ(smallestAngleDiff(static_cast<float16_t>(3), static_cast<float16_t>(-3)),
+            static_cast<float16_t>(smallestAngleDiff(3.0F, -3.0F)));
+}
+
+TEST(AngularTest, Float16BatchOverloadsMatchTheScalarFunctions) {
+  static constexpr float16_t kEpsilon = epsilon_v<float16_t>;
+
+  std::vector<float16_t> angles;
+  std::vector<float16_t> targets;
+  for (const float kAngle : randomValues<float>(-100, 100, kBatchSize)) {
+    angles.push_back(static_cast<float16_t>(kAngle));
+    targets.push_back(static_cast<float16_t>(-kAngle / 3));
+  }
+
+  std::vector<float16_t> expected(angles.size());
+  std::vector<float16_t> actual(angles.size());
+
+  normalizeAngles(angles, expected);
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_NEAR(expected[i], normalizeAngle(angles[i]), kEpsilon) << static_cast<float>(angles[i]);
+  }
+  normalizeAngle(angles, actual);
+  EXPECT_EQ(actual, expected);
+
+  absSmallestAngleDiffs(angles, targets, expected);
+  for (std::size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_NEAR(expected[i], absSmallestAngleDiff(angles[i], targets[i]), kEpsilon);
+  }
+  absSmallestAngleDiff(angles, targets, actual);
+  EXPECT_EQ(actual, expected);
+}
+#endif
+
 } // namespace
 } // namespace robocin
@@ -0,0 +1,14 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/circular_stats.h"
+
+namespace robocin {
+
+template class CircularStats<float>;
+template class CircularStats<double>;
+template class CircularStats<long double>;
+
+} // namespace robocin
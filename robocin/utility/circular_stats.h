@@ -0,0 +1,138 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_CIRCULAR_STATS_H
+#define ROBOCIN_UTILITY_CIRCULAR_STATS_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "robocin/utility/angular_math.h"
+
+namespace robocin {
+
+// Accumulates the statistics of a set of (optionally weighted) angles, e.g. the orientations of a
+// robot given by several cameras, through the sum of their unit vectors (the resultant vector), so
+// that angles on both sides of the -pi / pi seam average correctly, and no angle is normalized.
+//
+// Each angle is added in O(1), by 'fastSinCos', and accumulators are merged by adding their sums,
+// so that partial results (e.g. per thread, or per time window) can be reduced in any order.
+template <std::floating_point F>
+class CircularStats {
+ public:
+  using value_type = F;
+
+  constexpr CircularStats() = default;
+
+  constexpr void add(value_type angle) { add(angle, value_type{1}); }
+
+  constexpr void add(value_type angle, value_type weight) {
+    const auto [kSin, kCos] = fastSinCos(angle);
+
+    sum_cos_ += weight * kCos;
+    sum_sin_ += weight * kSin;
+    sum_weights_ += weight;
+  }
+
+  // Batch overloads: add every angle of a span, with the weights of another span, if given, whose
+  // sines and cosines are computed by the batch 'fastSinCos'.
+  void add(std::span<const value_type> angles) { addAll(angles, {}); }
+
+  void add(std::span<const value_type> angles, std::span<const value_type> weights) {
+    assert(angles.size() == weights.size());
+
+    addAll(angles, weights);
+  }
+
+  constexpr CircularStats& merge(const CircularStats& other) {
+    sum_cos_ += other.sum_cos_;
+    sum_sin_ += other.sum_sin_;
+    sum_weights_ += other.sum_weights_;
+    return *this;
+  }
+
+  constexpr CircularStats& operator+=(const CircularStats& other) { return merge(other); }
+  friend constexpr CircularStats operator+(CircularStats lhs, const CircularStats& rhs) {
+    return lhs.merge(rhs);
+  }
+
+  [[nodiscard]] constexpr bool empty() const { return sum_weights_ == 0; }
+
+  // The sum of the weights, i.e. the number of angles when unweighted.
+  [[nodiscard]] constexpr value_type weight() const { return sum_weights_; }
+
+  // The sum of the unit vectors of the angles, scaled by their weights.
+  [[nodiscard]] constexpr value_type resultantX() const { return sum_cos_; }
+  [[nodiscard]] constexpr value_type resultantY() const { return sum_sin_; }
+
+  // The length of the mean resultant vector, in [0, 1]: 1 when every angle is the same, and close
+  // to 0 when they are spread around the circle. NaN when empty.
+  [[nodiscard]] value_type meanResultantLength() const {
+    return std::min(std::hypot(sum_cos_, sum_sin_) / sum_weights_, value_type{1});
+  }
+
+  // The direction of the resultant vector, in [-pi, pi]. NaN when empty, and meaningless when the
+  // mean resultant length is close to 0.
+  [[nodiscard]] value_type mean() const {
+    return empty() ? std::numeric_limits<value_type>::quiet_NaN() : std::atan2(sum_sin_, sum_cos_);
+  }
+
+  // '1 - meanResultantLength()', in [0, 1].
+  [[nodiscard]] value_type variance() const { return 1 - meanResultantLength(); }
+
+  // 'sqrt(-2 * ln(meanResultantLength()))', in radians, which approaches the standard deviation of
+  // the angles when they are concentrated (e.g. normally distributed around their mean).
+  [[nodiscard]] value_type standardDeviation() const {
+    return std::sqrt(-2 * std::log(meanResultantLength()));
+  }
+
+  constexpr void reset() { *this = CircularStats{}; }
+
+ private:
+  static constexpr std::size_t kChunkSize = 256;
+
+  // adds the angles in chunks, whose sines and cosines are computed by the batch kernel into the
+  // stack, so that it never allocates.
+  void addAll(std::span<const value_type> angles, std::span<const value_type> weights) {
+    std::array<value_type, kChunkSize> sines; // NOLINT(*-member-init)
+    std::array<value_type, kChunkSize> cosines; // NOLINT(*-member-init)
+
+    for (std::size_t first = 0; first < angles.size(); first += kChunkSize) {
+      const std::size_t kSize = std::min(kChunkSize, angles.size() - first);
+
+      fastSinCos(angles.subspan(first, kSize),
+                 std::span{sines}.first(kSize),
+                 std::span{cosines}.first(kSize));
+
+      if (weights.empty()) {
+        for (std::size_t i = 0; i < kSize; ++i) {
+          sum_cos_ += cosines[i];
+          sum_sin_ += sines[i];
+        }
+        sum_weights_ += static_cast<value_type>(kSize);
+      } else {
+        for (std::size_t i = 0; i < kSize; ++i) {
+          sum_cos_ += weights[first + i] * cosines[i];
+          sum_sin_ += weights[first + i] * sines[i];
+          sum_weights_ += weights[first + i];
+        }
+      }
+    }
+  }
+
+  value_type sum_cos_ = 0;
+  value_type sum_sin_ = 0;
+  value_type sum_weights_ = 0;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_CIRCULAR_STATS_H
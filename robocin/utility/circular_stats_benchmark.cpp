@@ -0,0 +1,79 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/circular_stats.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+template <class T>
+std::vector<T> randomAngles(std::size_t size) {
+  return randomValues<T>(-std::numbers::pi_v<T>, std::numbers::pi_v<T>, size);
+}
+
+// The mean the accumulator replaces: the resultant vector, by 'std::sin' and 'std::cos'.
+template <class T>
+void BM_StdSinCosMean(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    T sum_cos = 0;
+    T sum_sin = 0;
+    for (const T kAngle : kAngles) {
+      sum_cos += std::cos(kAngle);
+      sum_sin += std::sin(kAngle);
+    }
+    benchmark::DoNotOptimize(std::atan2(sum_sin, sum_cos));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_StdSinCosMean, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_StdSinCosMean, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_CircularStatsAdd(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    CircularStats<T> stats;
+    for (const T kAngle : kAngles) {
+      stats.add(kAngle);
+    }
+    benchmark::DoNotOptimize(stats.mean());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_CircularStatsAdd, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_CircularStatsAdd, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_CircularStatsBatchAdd(benchmark::State& state) {
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    CircularStats<T> stats;
+    stats.add(kAngles);
+    benchmark::DoNotOptimize(stats.mean());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_CircularStatsBatchAdd, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_CircularStatsBatchAdd, double)->Arg(16)->Arg(4'096);
+
+} // namespace
+} // namespace robocin
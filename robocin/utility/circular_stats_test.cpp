@@ -0,0 +1,177 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/circular_stats.h"
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+TYPED_TEST(FloatingPointTest, EmptyGivesNaN) {
+  using T = TypeParam;
+
+  const CircularStats<T> kStats;
+  EXPECT_TRUE(kStats.empty());
+  EXPECT_EQ(kStats.weight(), 0);
+  EXPECT_TRUE(std::isnan(kStats.mean()));
+  EXPECT_TRUE(std::isnan(kStats.meanResultantLength()));
+  EXPECT_TRUE(std::isnan(kStats.variance()));
+}
+
+TYPED_TEST(FloatingPointTest, MeanAcrossTheSeam) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  // pairs of angles symmetric around a center next to the seam, given in any range, whose mean is
+  // the (normalized) center, although their arithmetic mean is close to 0.
+  for (const T kCenter : {kPi * 15 / 16, -kPi * 15 / 16, kPi, kPi * 31 / 16 + 10 * kPi}) {
+    CircularStats<T> stats;
+    for (const T kOffset : randomValues<T>(0, kPi / 4, 50)) {
+      stats.add(kCenter + kOffset);
+      stats.add(normalizeAngle(kCenter - kOffset));
+    }
+    EXPECT_EQ(stats.weight(), 100);
+    EXPECT_LE(absSmallestAngleDiff(stats.mean(), normalizeAngle(kCenter)), epsilon_v<T>) << kCenter;
+  }
+}
+
+TYPED_TEST(FloatingPointTest, ResultantLengthVarianceAndStandardDeviation) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // every angle the same.
+  CircularStats<T> same;
+  for (int i = 0; i < 10; ++i) {
+    same.add(kPi * 3 / 4);
+  }
+  EXPECT_NEAR(same.meanResultantLength(), 1, kEpsilon);
+  EXPECT_NEAR(same.variance(), 0, kEpsilon);
+
+  // two angles 'kSpread' apart from their mean, whose resultant length is 'cos(kSpread)'.
+  static constexpr T kSpread = kPi / 6;
+  CircularStats<T> pair;
+  pair.add(kPi - kSpread / 2 + kSpread);
+  pair.add(kPi - kSpread / 2 - kSpread);
+  EXPECT_NEAR(pair.meanResultantLength(), std::cos(kSpread), kEpsilon);
+  EXPECT_NEAR(pair.variance(), 1 - std::cos(kSpread), kEpsilon);
+  EXPECT_NEAR(pair.standardDeviation(), std::sqrt(-2 * std::log(std::cos(kSpread))), kEpsilon);
+
+  // angles evenly spread around the circle, whose resultant vector is zero.
+  CircularStats<T> spread;
+  for (int i = 0; i < 12; ++i) {
+    spread.add(static_cast<T>(i) * kPi / 6);
+  }
+  EXPECT_NEAR(spread.meanResultantLength(), 0, kEpsilon);
+  EXPECT_NEAR(spread.variance(), 1, kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, WeightsActAsRepetitions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  CircularStats<T> weighted;
+  weighted.add(T{3}, T{3});
+  weighted.add(T{-2.5}, T{1});
+  weighted.add(T{1}, T{0});
+
+  CircularStats<T> repeated;
+  repeated.add(T{3});
+  repeated.add(T{3});
+  repeated.add(T{3});
+  repeated.add(T{-2.5});
+
+  EXPECT_EQ(weighted.weight(), repeated.weight());
+  EXPECT_NEAR(weighted.mean(), repeated.mean(), kEpsilon);
+  EXPECT_NEAR(weighted.meanResultantLength(), repeated.meanResultantLength(), kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, MergeMatchesASingleAccumulator) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kAngles = randomValues<T>(kPi / 2, kPi * 7 / 4, 300);
+
+  CircularStats<T> all;
+  std::vector<CircularStats<T>> parts(3);
+  for (std::size_t i = 0; i < kAngles.size(); ++i) {
+    all.add(kAngles[i]);
+    parts[i % parts.size()].add(kAngles[i]);
+  }
+
+  // in any order.
+  const CircularStats<T> kMerged = (parts[2] + parts[0]) + parts[1];
+  CircularStats<T> merged = parts[1];
+  merged += parts[2];
+  merged.merge(parts[0]);
+
+  for (const CircularStats<T>& stats : {kMerged, merged}) {
+    EXPECT_EQ(stats.weight(), all.weight());
+    EXPECT_NEAR(stats.mean(), all.mean(), kEpsilon);
+    EXPECT_NEAR(stats.meanResultantLength(), all.meanResultantLength(), kEpsilon);
+  }
+
+  merged.reset();
+  EXPECT_TRUE(merged.empty());
+}
+
+TYPED_TEST(FloatingPointTest, BatchMatchesTheScalarAdd) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // several chunks, the last one partial, and angles in any range.
+  const std::vector<T> kAngles = randomValues<T>(-kPi / 4, kPi * 9 / 4, 1'001);
+  const std::vector<T> kWeights = randomValues<T>(0, 2, 1'001, /*seed=*/7);
+
+  CircularStats<T> scalar;
+  CircularStats<T> weightedScalar;
+  for (std::size_t i = 0; i < kAngles.size(); ++i) {
+    scalar.add(kAngles[i]);
+    weightedScalar.add(kAngles[i], kWeights[i]);
+  }
+
+  CircularStats<T> batch;
+  batch.add(kAngles);
+  EXPECT_EQ(batch.weight(), scalar.weight());
+  EXPECT_NEAR(batch.resultantX(), scalar.resultantX(), kEpsilon * batch.weight());
+  EXPECT_NEAR(batch.resultantY(), scalar.resultantY(), kEpsilon * batch.weight());
+  EXPECT_NEAR(batch.mean(), scalar.mean(), kEpsilon);
+
+  CircularStats<T> weightedBatch;
+  weightedBatch.add(kAngles, kWeights);
+  EXPECT_NEAR(weightedBatch.weight(), weightedScalar.weight(), kEpsilon);
+  EXPECT_NEAR(weightedBatch.mean(), weightedScalar.mean(), kEpsilon);
+  EXPECT_NEAR(weightedBatch.meanResultantLength(),
+              weightedScalar.meanResultantLength(),
+              kEpsilon);
+}
+
+} // namespace
+} // namespace robocin
@@ -7,11 +7,40 @@
 #define ROBOCIN_UTILITY_CONCEPTS_H
 
 #include <concepts>
+#include <ranges>
+#include <type_traits>
+
+#include "robocin/utility/type_traits.h"
 
 namespace robocin {
 
+// The half precision types of 'type_traits.h' (e.g. 'float16_t'), which are not
+// 'std::floating_point' before C++23.
+template <class T>
+concept narrow_floating_point = is_narrow_floating_point_v<T>;
+
+template <class T>
+concept floating_point = std::floating_point<T> or narrow_floating_point<T>;
+
 template <class T>
-concept arithmetic = std::is_arithmetic_v<T>;
+concept arithmetic = std::is_arithmetic_v<T> or narrow_floating_point<T>;
+
+// A contiguous range of arithmetic values (e.g. 'std::vector<double>', 'std::array<int, N>' or
+// 'std::span<const float>'), which may be viewed as a 'std::span' of them.
+template <class R>
+concept contiguous_arithmetic_range = std::ranges::contiguous_range<R>
+                                      and std::ranges::sized_range<R>
+                                      and arithmetic<std::ranges::range_value_t<R>>;
+
+template <class R>
+concept contiguous_floating_point_range =
+    contiguous_arithmetic_range<R> and floating_point<std::ranges::range_value_t<R>>;
+
+// A 'contiguous_arithmetic_range' whose elements may be written (e.g. not a 'const' vector).
+template <class R>
+concept output_contiguous_arithmetic_range =
+    contiguous_arithmetic_range<R>
+    and std::ranges::output_range<R, std::ranges::range_value_t<R>>;
 
 } // namespace robocin
 
@@ -0,0 +1,73 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/cpu_dispatch.h"
+
+#include <cassert>
+
+namespace robocin {
+namespace {
+
+// The widest instruction set the CPU supports, among the ones the kernels are compiled for.
+SimdIsa detectSimdIsa() {
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+  // reads cpuid (and xgetbv, so that the registers saved by the operating system are accounted for)
+  // if the startup code of libgcc has not done so yet.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512dq")) {
+    return SimdIsa::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdIsa::kAvx2;
+  }
+#endif
+#if defined(__SSE2__)
+  return SimdIsa::kSse2;
+#else
+  return SimdIsa::kScalar;
+#endif
+}
+
+} // namespace
+
+std::string_view simdIsaName(SimdIsa isa) {
+  switch (isa) {
+    case SimdIsa::kScalar: return "scalar";
+    case SimdIsa::kSse2: return "sse2";
+    case SimdIsa::kAvx2: return "avx2";
+    case SimdIsa::kAvx512: return "avx512";
+  }
+  return "unknown";
+}
+
+bool isSimdIsaSupported(SimdIsa isa) { return isa <= supportedSimdIsa(); }
+
+SimdIsa supportedSimdIsa() {
+  static const SimdIsa kSupported = detectSimdIsa();
+  return kSupported;
+}
+
+SimdIsa activeSimdIsa() {
+  const SimdIsa kActive = internal::active_simd_isa.load(std::memory_order_relaxed);
+  return kActive != internal::kUnresolvedSimdIsa ? kActive : internal::resolveSimdIsa();
+}
+
+ScopedSimdIsa::ScopedSimdIsa(SimdIsa isa) : previous_{activeSimdIsa()} {
+  assert(isSimdIsaSupported(isa));
+  internal::active_simd_isa.store(isa, std::memory_order_relaxed);
+}
+
+ScopedSimdIsa::~ScopedSimdIsa() {
+  internal::active_simd_isa.store(previous_, std::memory_order_relaxed);
+}
+
+SimdIsa internal::resolveSimdIsa() {
+  SimdIsa expected = kUnresolvedSimdIsa;
+  // a 'ScopedSimdIsa' may have been constructed meanwhile, by another thread.
+  active_simd_isa.compare_exchange_strong(expected, supportedSimdIsa(), std::memory_order_relaxed);
+  return active_simd_isa.load(std::memory_order_relaxed);
+}
+
+} // namespace robocin
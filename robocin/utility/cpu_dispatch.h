@@ -0,0 +1,107 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_CPU_DISPATCH_H
+#define ROBOCIN_UTILITY_CPU_DISPATCH_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Runtime dispatch of the vectorized kernels of the batch overloads (e.g. 'normalizeAngles' and
+// 'fuzzyCmpEqualMask'), so that a single binary, compiled for the baseline of the target, runs the
+// widest kernels the CPU it runs on supports:
+//
+//   supportedSimdIsa(); // e.g. SimdIsa::kAvx2 on a laptop, SimdIsa::kSse2 on an older computer.
+//
+// The features of the CPU are read (by cpuid) once, before the first kernel runs, and every batch
+// overload then calls the kernel of that instruction set through a table of function pointers. The
+// kernels are compiled for AVX2 and AVX-512 by GCC on x86-64, which defines
+// 'ROBOCIN_HAS_SIMD_DISPATCH'; elsewhere, only for the baseline.
+//
+// 'simd_lanes_v' still describes the kernels of the baseline: the ones dispatched at runtime may
+// process more values at once.
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define ROBOCIN_HAS_SIMD_DISPATCH
+#endif
+
+namespace robocin {
+
+// The instruction sets the kernels are compiled for, from the narrowest to the widest. The kernels
+// of 'kScalar' run the scalar functions only, and are the reference of the others.
+enum class SimdIsa : std::uint8_t { kScalar, kSse2, kAvx2, kAvx512 };
+
+inline constexpr std::array kSimdIsas{
+    SimdIsa::kScalar,
+    SimdIsa::kSse2,
+    SimdIsa::kAvx2,
+    SimdIsa::kAvx512,
+};
+
+// The name of 'isa', e.g. "avx2".
+std::string_view simdIsaName(SimdIsa isa);
+
+// Whether the kernels of 'isa' are compiled and supported by the CPU (and its operating system).
+bool isSimdIsaSupported(SimdIsa isa);
+
+// The widest instruction set for which 'isSimdIsaSupported' holds.
+SimdIsa supportedSimdIsa();
+
+// The instruction set the kernels are dispatched to: 'supportedSimdIsa()', unless forced by a
+// 'ScopedSimdIsa'.
+SimdIsa activeSimdIsa();
+
+// Dispatches the kernels of 'isa', which must be supported, for its lifetime, e.g. to test or to
+// benchmark each of them. Unlike 'EpsilonScope', it applies to every thread, hence the kernels of
+// other threads may run either instruction set meanwhile. The previous instruction set is restored
+// on destruction, so scopes must be destroyed in the reverse order of their construction.
+class ScopedSimdIsa {
+ public:
+  explicit ScopedSimdIsa(SimdIsa isa);
+
+  ScopedSimdIsa(const ScopedSimdIsa&) = delete;
+  ScopedSimdIsa& operator=(const ScopedSimdIsa&) = delete;
+
+  ~ScopedSimdIsa();
+
+ private:
+  SimdIsa previous_;
+};
+
+namespace internal {
+
+inline constexpr auto kUnresolvedSimdIsa = static_cast<SimdIsa>(kSimdIsas.size());
+
+// The instruction set the kernels are dispatched to, or 'kUnresolvedSimdIsa' before the features of
+// the CPU are read. 'constinit', so that it is read by a single load, without any guard, even
+// during the dynamic initialization of other files.
+inline constinit std::atomic<SimdIsa> active_simd_isa{ // NOLINT(readability-identifier-naming)
+                                                      kUnresolvedSimdIsa};
+
+// Reads the features of the CPU, and dispatches the kernels of 'supportedSimdIsa()'.
+SimdIsa resolveSimdIsa();
+
+// The kernels of a module, per instruction set: the i-th holds the ones of 'kSimdIsas[i]', or null
+// when they are not compiled. Those of 'kScalar' are always compiled.
+template <class Kernels>
+using SimdKernelTable = std::array<const Kernels*, kSimdIsas.size()>;
+
+// The kernels of the active instruction set.
+template <class Kernels>
+const Kernels& dispatchSimdKernels(const SimdKernelTable<Kernels>& table) {
+  SimdIsa isa = active_simd_isa.load(std::memory_order_relaxed);
+  if (isa == kUnresolvedSimdIsa) [[unlikely]] {
+    isa = resolveSimdIsa();
+  }
+  return *table[static_cast<std::size_t>(isa)];
+}
+
+} // namespace internal
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_CPU_DISPATCH_H
@@ -0,0 +1,86 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/cpu_dispatch.h"
+
+#include <set>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace robocin {
+namespace {
+
+TEST(CpuDispatchTest, ScalarAndBaselineAreAlwaysSupported) {
+  EXPECT_TRUE(isSimdIsaSupported(SimdIsa::kScalar));
+#if defined(__SSE2__)
+  EXPECT_TRUE(isSimdIsaSupported(SimdIsa::kSse2));
+#endif
+#if !defined(ROBOCIN_HAS_SIMD_DISPATCH)
+  EXPECT_FALSE(isSimdIsaSupported(SimdIsa::kAvx2));
+  EXPECT_FALSE(isSimdIsaSupported(SimdIsa::kAvx512));
+#endif
+}
+
+TEST(CpuDispatchTest, SupportedSimdIsaIsTheWidestSupported) {
+  for (const SimdIsa kIsa : kSimdIsas) {
+    EXPECT_EQ(isSimdIsaSupported(kIsa), kIsa <= supportedSimdIsa()) << simdIsaName(kIsa);
+  }
+}
+
+TEST(CpuDispatchTest, SupportedSimdIsaMatchesTheCpuFeatures) {
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+  EXPECT_EQ(isSimdIsaSupported(SimdIsa::kAvx2), __builtin_cpu_supports("avx2") != 0);
+  EXPECT_EQ(isSimdIsaSupported(SimdIsa::kAvx512),
+            __builtin_cpu_supports("avx512f") != 0 and __builtin_cpu_supports("avx512dq") != 0);
+#else
+  GTEST_SKIP() << "the kernels are compiled for the baseline only.";
+#endif
+}
+
+TEST(CpuDispatchTest, ActiveSimdIsaIsTheSupportedOneByDefault) {
+  EXPECT_EQ(activeSimdIsa(), supportedSimdIsa());
+}
+
+TEST(CpuDispatchTest, ScopedSimdIsaForcesAnInstructionSetUntilDestroyed) {
+  {
+    const ScopedSimdIsa kScalar{SimdIsa::kScalar};
+    EXPECT_EQ(activeSimdIsa(), SimdIsa::kScalar);
+    {
+      const ScopedSimdIsa kSupported{supportedSimdIsa()};
+      EXPECT_EQ(activeSimdIsa(), supportedSimdIsa());
+    }
+    EXPECT_EQ(activeSimdIsa(), SimdIsa::kScalar);
+  }
+  EXPECT_EQ(activeSimdIsa(), supportedSimdIsa());
+}
+
+TEST(CpuDispatchTest, DispatchesTheKernelsOfTheActiveSimdIsa) {
+  static constexpr internal::SimdKernelTable<SimdIsa> kTable{
+      &kSimdIsas[0],
+      &kSimdIsas[1],
+      &kSimdIsas[2],
+      &kSimdIsas[3],
+  };
+
+  for (const SimdIsa kIsa : kSimdIsas) {
+    if (isSimdIsaSupported(kIsa)) {
+      const ScopedSimdIsa kScope{kIsa};
+      EXPECT_EQ(internal::dispatchSimdKernels(kTable), kIsa) << simdIsaName(kIsa);
+    }
+  }
+}
+
+TEST(CpuDispatchTest, SimdIsaNamesAreDistinct) {
+  std::set<std::string_view> names;
+  for (const SimdIsa kIsa : kSimdIsas) {
+    names.insert(simdIsaName(kIsa));
+  }
+  EXPECT_EQ(names.size(), kSimdIsas.size());
+  EXPECT_EQ(simdIsaName(SimdIsa::kAvx2), "avx2");
+}
+
+} // namespace
+} // namespace robocin
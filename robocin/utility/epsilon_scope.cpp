@@ -0,0 +1,14 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/epsilon_scope.h"
+
+namespace robocin {
+
+template class EpsilonScope<float>;
+template class EpsilonScope<double>;
+template class EpsilonScope<long double>;
+
+} // namespace robocin
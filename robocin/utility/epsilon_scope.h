@@ -0,0 +1,90 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_EPSILON_SCOPE_H
+#define ROBOCIN_UTILITY_EPSILON_SCOPE_H
+
+#include <cassert>
+#include <concepts>
+#include <utility>
+
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+// 'epsilon_v' is fixed at build time. The following classes let a thread override it at runtime
+// (e.g. each worker of a parameter sweep, running in the same process, with its own epsilon), for
+// the comparisons that opt in through 'ScopedComparison'. The remaining ones, including every
+// comparison using the default policy, keep reading 'epsilon_v' at compile time.
+
+namespace robocin {
+namespace internal {
+
+// The epsilon of the innermost 'EpsilonScope' of the calling thread, or 0 outside any. 'constinit',
+// so that it is read by a single load, without the guard of a dynamically initialized thread_local.
+template <std::floating_point F>
+inline constinit thread_local F scoped_epsilon = 0; // NOLINT(readability-identifier-naming)
+
+} // namespace internal
+
+// Overrides the epsilon of the calling thread, for its lifetime. Scopes may be nested, and the
+// previous epsilon is restored on destruction, so they must be destroyed in the reverse order of
+// their construction (as automatic variables are).
+template <std::floating_point F>
+class EpsilonScope {
+ public:
+  explicit EpsilonScope(F epsilon) :
+      previous_{std::exchange(internal::scoped_epsilon<F>, epsilon)} {
+    assert(epsilon > 0);
+  }
+
+  EpsilonScope(const EpsilonScope&) = delete;
+  EpsilonScope& operator=(const EpsilonScope&) = delete;
+
+  ~EpsilonScope() { internal::scoped_epsilon<F> = previous_; }
+
+ private:
+  F previous_;
+};
+
+template <std::floating_point F>
+EpsilonScope(F) -> EpsilonScope<F>;
+
+// The epsilon of the innermost 'EpsilonScope' of the calling thread, or the injected epsilon
+// outside any.
+template <std::floating_point F>
+  requires(has_epsilon_v<F>)
+F scopedEpsilon() {
+  const F kEpsilon = internal::scoped_epsilon<F>;
+  return kEpsilon > 0 ? kEpsilon : epsilon_v<F>;
+}
+
+// A comparison policy which compares as 'Policy' does, but whose default tolerance is
+// 'scopedEpsilon<F>()', read on every call (or, for the functors, on construction).
+template <fuzzy_comparison_policy Policy = AbsoluteComparison>
+struct ScopedComparison {
+  static_assert(not std::same_as<Policy, UlpComparison>, "ULPs are not an epsilon.");
+
+  template <std::floating_point F>
+  static F tolerance()
+    requires(has_epsilon_v<F>)
+  {
+    return scopedEpsilon<F>();
+  }
+
+  template <arithmetic T, arithmetic U, std::floating_point V>
+  static constexpr bool equal(T lhs, U rhs, V epsilon) {
+    return Policy::equal(lhs, rhs, epsilon);
+  }
+
+  template <arithmetic T, arithmetic U, std::floating_point V>
+    requires requires(T lhs, U rhs, V epsilon) { Policy::ratio(lhs, rhs, epsilon); }
+  static constexpr auto ratio(T lhs, U rhs, V epsilon) {
+    return Policy::ratio(lhs, rhs, epsilon);
+  }
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_EPSILON_SCOPE_H
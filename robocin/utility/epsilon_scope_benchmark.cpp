@@ -0,0 +1,92 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/epsilon_scope.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumValues = 1'024;
+
+// pairs in which roughly half of the right-hand side values are within epsilon of the left-hand
+// side ones, as in the fuzzy_compare benchmark.
+template <class F>
+std::pair<std::vector<F>, std::vector<F>> randomPairs() {
+  static constexpr F kEpsilon = epsilon_v<F>;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<F> value{-100, 100};
+  std::uniform_real_distribution<F> offset{-2 * kEpsilon, 2 * kEpsilon};
+
+  std::vector<F> lhs(kNumValues);
+  std::vector<F> rhs(kNumValues);
+  for (std::size_t i = 0; i < kNumValues; ++i) {
+    lhs[i] = value(generator);
+    rhs[i] = lhs[i] + offset(generator);
+  }
+  return {std::move(lhs), std::move(rhs)};
+}
+
+template <class F, class Policy>
+void BM_FuzzyCmpEqual(benchmark::State& state) {
+  const auto [kLhs, kRhs] = randomPairs<F>();
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      benchmark::DoNotOptimize(fuzzyCmpEqual<Policy>(kLhs[i], kRhs[i]));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLhs.size()));
+}
+
+// The compile-time epsilon, as the baseline of the thread-local lookup.
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, float, AbsoluteComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, double, AbsoluteComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, float, ScopedComparison<>);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, double, ScopedComparison<>);
+
+template <class F>
+void BM_FuzzyCmpEqualWithinScope(benchmark::State& state) {
+  const EpsilonScope kScope{2 * epsilon_v<F>};
+  BM_FuzzyCmpEqual<F, ScopedComparison<>>(state);
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualWithinScope, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualWithinScope, double);
+
+template <class F>
+void BM_ScopedEpsilon(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scopedEpsilon<F>());
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ScopedEpsilon, float);
+BENCHMARK_TEMPLATE(BM_ScopedEpsilon, double);
+BENCHMARK_TEMPLATE(BM_ScopedEpsilon, long double);
+
+template <class F>
+void BM_EpsilonScope(benchmark::State& state) {
+  for (auto _ : state) {
+    const EpsilonScope kScope{2 * epsilon_v<F>};
+    benchmark::DoNotOptimize(scopedEpsilon<F>());
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_EpsilonScope, float);
+BENCHMARK_TEMPLATE(BM_EpsilonScope, double);
+BENCHMARK_TEMPLATE(BM_EpsilonScope, long double);
+
+} // namespace
+} // namespace robocin
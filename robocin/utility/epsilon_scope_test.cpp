@@ -0,0 +1,119 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/epsilon_scope.h"
+
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+TYPED_TEST(FloatingPointTest, ScopedEpsilonOutsideAnyScope) {
+  using T = TypeParam;
+
+  EXPECT_EQ(scopedEpsilon<T>(), epsilon_v<T>);
+}
+
+TYPED_TEST(FloatingPointTest, ScopedEpsilonGivenNestedScopes) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  {
+    const EpsilonScope kOuter{2 * kEpsilon};
+    EXPECT_EQ(scopedEpsilon<T>(), 2 * kEpsilon);
+    {
+      const EpsilonScope kInner{kEpsilon / 2};
+      EXPECT_EQ(scopedEpsilon<T>(), kEpsilon / 2);
+    }
+    EXPECT_EQ(scopedEpsilon<T>(), 2 * kEpsilon);
+  }
+  EXPECT_EQ(scopedEpsilon<T>(), kEpsilon);
+}
+
+TYPED_TEST(FloatingPointTest, ScopesOfOtherTypesAreIndependent) {
+  using T = TypeParam;
+  using U = std::conditional_t<std::same_as<T, float>, double, float>;
+
+  const EpsilonScope kScope{2 * epsilon_v<U>};
+  EXPECT_EQ(scopedEpsilon<T>(), epsilon_v<T>);
+}
+
+TYPED_TEST(FloatingPointTest, ScopedComparisonGivenScope) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kValue = kEpsilon * 3 / 2;
+
+  EXPECT_FALSE(fuzzyCmpEqual<ScopedComparison<>>(T{0}, kValue));
+  EXPECT_FALSE(fuzzyIsZero<ScopedComparison<>>(kValue));
+  {
+    const EpsilonScope kScope{2 * kEpsilon};
+
+    EXPECT_TRUE(fuzzyCmpEqual<ScopedComparison<>>(T{0}, kValue));
+    EXPECT_TRUE(fuzzyIsZero<ScopedComparison<>>(kValue));
+    EXPECT_FALSE(fuzzyCmpLess<ScopedComparison<>>(T{0}, kValue));
+    EXPECT_TRUE(fuzzyCmpEqual<ScopedComparison<RelativeComparison>>(T{1}, 1 + kValue));
+
+    // the default policy keeps the injected epsilon.
+    EXPECT_FALSE(fuzzyCmpEqual(T{0}, kValue));
+
+    // functors read the scoped epsilon on construction.
+    const FuzzyEqualTo<T, ScopedComparison<>> kEqualTo;
+    EXPECT_TRUE(kEqualTo(T{0}, kValue));
+  }
+  EXPECT_FALSE(fuzzyCmpEqual<ScopedComparison<>>(T{0}, kValue));
+}
+
+TYPED_TEST(FloatingPointTest, ScopesOfOtherThreadsAreIndependent) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr std::size_t kNumThreads = 4;
+
+  const EpsilonScope kScope{kEpsilon / 4};
+
+  std::vector<T> outside(kNumThreads);
+  std::vector<T> inside(kNumThreads);
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&outside, &inside, i] {
+      outside[i] = scopedEpsilon<T>();
+
+      const EpsilonScope kWorkerScope{static_cast<T>(i + 1) * kEpsilon};
+      inside[i] = scopedEpsilon<T>();
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(outside[i], kEpsilon);
+    EXPECT_EQ(inside[i], static_cast<T>(i + 1) * kEpsilon);
+  }
+  EXPECT_EQ(scopedEpsilon<T>(), kEpsilon / 4);
+}
+
+} // namespace
+} // namespace robocin
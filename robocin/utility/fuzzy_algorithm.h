@@ -0,0 +1,157 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_FUZZY_ALGORITHM_H
+#define ROBOCIN_UTILITY_FUZZY_ALGORITHM_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+// 'FuzzyLess' and 'FuzzyThreeWay' are not transitive (a ~ b and b ~ c does not imply a ~ c), so
+// they are not strict weak orderings and must not be given to 'std::sort' or 'std::unique'. The
+// algorithms below sort exactly, and then collapse the runs of values within epsilon in a single
+// pass, in O(n log n) overall.
+//
+// Clusters are chains (single linkage): two consecutive values of the sorted range belong to the
+// same cluster if they are equal within epsilon. Hence, every cluster is well-defined regardless of
+// the input order, but it may span more than epsilon (e.g. 0, 0.8 and 1.6, with an epsilon of 1).
+// Values must not be NaN.
+
+namespace robocin {
+namespace internal {
+
+template <class R, class Proj>
+using fuzzy_projected_t =
+    std::remove_cvref_t<std::invoke_result_t<Proj&, std::ranges::range_reference_t<R>>>;
+
+// The end of the cluster that begins at 'first'.
+template <std::forward_iterator It, std::sentinel_for<It> S, std::floating_point F, class Proj>
+constexpr It fuzzyClusterEnd(It first, S last, F epsilon, Proj proj) {
+  auto previous = std::invoke(proj, *first);
+  for (++first; first != last; ++first) {
+    auto current = std::invoke(proj, *first);
+    if (not fuzzyCmpEqual(previous, current, epsilon)) {
+      break;
+    }
+    previous = std::move(current);
+  }
+  return first;
+}
+
+} // namespace internal
+
+// Writes every cluster of an already sorted range, as a 'std::ranges::subrange', to 'out' ---------
+template <std::ranges::forward_range R,
+          std::floating_point F,
+          std::output_iterator<std::ranges::subrange<std::ranges::iterator_t<R>>> Out,
+          class Proj = std::identity>
+  requires std::ranges::borrowed_range<R>
+constexpr Out fuzzyUniqueClusters(R&& range, F epsilon, Out out, Proj proj = {}) {
+  auto first = std::ranges::begin(range);
+  const auto last = std::ranges::end(range);
+
+  while (first != last) {
+    auto next = internal::fuzzyClusterEnd(first, last, epsilon, proj);
+    *out = std::ranges::subrange{first, next};
+    ++out;
+    first = next;
+  }
+  return out;
+}
+
+// As above, using the injected epsilon ------------------------------------------------------------
+template <std::ranges::forward_range R,
+          std::output_iterator<std::ranges::subrange<std::ranges::iterator_t<R>>> Out,
+          class Proj = std::identity,
+          class F = internal::fuzzy_projected_t<R, Proj>>
+  requires(std::ranges::borrowed_range<R> and has_epsilon_v<F>)
+constexpr Out fuzzyUniqueClusters(R&& range, Out out, Proj proj = {}) {
+  return fuzzyUniqueClusters(std::forward<R>(range), epsilon_v<F>, out, std::move(proj));
+}
+
+// Sorts a range and keeps the first (i.e. smallest) element of every cluster ----------------------
+// Returns the new end of the range, as 'std::unique' does.
+template <std::ranges::random_access_range R, std::floating_point F, class Proj = std::identity>
+  requires std::sortable<std::ranges::iterator_t<R>, std::ranges::less, Proj>
+constexpr std::ranges::borrowed_iterator_t<R> fuzzySortUnique(R&& range,
+                                                              F epsilon,
+                                                              Proj proj = {}) {
+  std::ranges::sort(range, std::ranges::less{}, proj);
+
+  auto first = std::ranges::begin(range);
+  const auto last = std::ranges::end(range);
+
+  auto result = first;
+  while (first != last) {
+    auto next = internal::fuzzyClusterEnd(first, last, epsilon, proj);
+    if (result != first) {
+      *result = std::ranges::iter_move(first);
+    }
+    ++result;
+    first = next;
+  }
+  return result;
+}
+
+// As above, using the injected epsilon ------------------------------------------------------------
+template <std::ranges::random_access_range R,
+          class Proj = std::identity,
+          class F = internal::fuzzy_projected_t<R, Proj>>
+  requires(std::sortable<std::ranges::iterator_t<R>, std::ranges::less, Proj> and has_epsilon_v<F>)
+constexpr std::ranges::borrowed_iterator_t<R> fuzzySortUnique(R&& range, Proj proj = {}) {
+  return fuzzySortUnique(std::forward<R>(range), epsilon_v<F>, std::move(proj));
+}
+
+// Sorts a range of values and replaces every cluster by its centroid (mean) -----------------------
+// Returns the new end of the range, as 'std::unique' does.
+template <std::ranges::random_access_range R, std::floating_point F>
+  requires(std::floating_point<std::ranges::range_value_t<R>>
+           and std::sortable<std::ranges::iterator_t<R>>)
+constexpr std::ranges::borrowed_iterator_t<R> fuzzyMerge(R&& range, F epsilon) {
+  using T = std::ranges::range_value_t<R>;
+
+  std::ranges::sort(range);
+
+  auto first = std::ranges::begin(range);
+  const auto last = std::ranges::end(range);
+
+  auto result = first;
+  while (first != last) {
+    auto next = internal::fuzzyClusterEnd(first, last, epsilon, std::identity{});
+
+    // offsets from the first value, so that large values do not cancel out the small differences.
+    const T kFirst = *first;
+    T offsets{0};
+    for (auto it = std::next(first); it != next; ++it) {
+      offsets += *it - kFirst;
+    }
+    *result = kFirst + offsets / static_cast<T>(std::ranges::distance(first, next));
+
+    ++result;
+    first = next;
+  }
+  return result;
+}
+
+// As above, using the injected epsilon ------------------------------------------------------------
+template <std::ranges::random_access_range R, class F = std::ranges::range_value_t<R>>
+  requires(std::floating_point<F> and std::sortable<std::ranges::iterator_t<R>>
+           and has_epsilon_v<F>)
+constexpr std::ranges::borrowed_iterator_t<R> fuzzyMerge(R&& range) {
+  return fuzzyMerge(std::forward<R>(range), epsilon_v<F>);
+}
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_FUZZY_ALGORITHM_H
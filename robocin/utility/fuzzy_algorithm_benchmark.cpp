@@ -0,0 +1,69 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_algorithm.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+// The pairwise loop these algorithms replace: O(n * unique values).
+template <class F>
+std::vector<F> pairwiseUnique(const std::vector<F>& values) {
+  std::vector<F> result;
+  for (const F kValue : values) {
+    if (std::ranges::none_of(result, [&](F unique) { return fuzzyCmpEqual(unique, kValue); })) {
+      result.push_back(kValue);
+    }
+  }
+  return result;
+}
+
+template <class F, class Function>
+void benchmarkUnique(benchmark::State& state, Function function) {
+  // values in [0, size * epsilon), so that roughly half of them have a neighbour within epsilon.
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<F> kValues = randomValues<F>(0, static_cast<F>(kSize) * epsilon_v<F>, kSize);
+
+  for (auto _ : state) {
+    std::vector<F> values = kValues;
+    benchmark::DoNotOptimize(function(values));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kValues.size()));
+}
+
+template <class F>
+void BM_PairwiseUnique(benchmark::State& state) {
+  benchmarkUnique<F>(state, [](std::vector<F>& values) { return pairwiseUnique(values).size(); });
+}
+
+template <class F>
+void BM_FuzzySortUnique(benchmark::State& state) {
+  benchmarkUnique<F>(state, [](std::vector<F>& values) { return fuzzySortUnique(values); });
+}
+
+template <class F>
+void BM_FuzzyMerge(benchmark::State& state) {
+  benchmarkUnique<F>(state, [](std::vector<F>& values) { return fuzzyMerge(values); });
+}
+
+BENCHMARK_TEMPLATE(BM_PairwiseUnique, float)->RangeMultiplier(8)->Range(64, 4'096);
+BENCHMARK_TEMPLATE(BM_PairwiseUnique, double)->RangeMultiplier(8)->Range(64, 4'096);
+BENCHMARK_TEMPLATE(BM_FuzzySortUnique, float)->RangeMultiplier(8)->Range(64, 4'096);
+BENCHMARK_TEMPLATE(BM_FuzzySortUnique, double)->RangeMultiplier(8)->Range(64, 4'096);
+BENCHMARK_TEMPLATE(BM_FuzzyMerge, float)->RangeMultiplier(8)->Range(64, 4'096);
+BENCHMARK_TEMPLATE(BM_FuzzyMerge, double)->RangeMultiplier(8)->Range(64, 4'096);
+
+} // namespace
+} // namespace robocin
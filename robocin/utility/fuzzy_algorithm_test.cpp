@@ -0,0 +1,171 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_algorithm.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// Values within epsilon / 6 of the given centers, in a random order.
+template <class T>
+std::vector<T> randomClusters(const std::vector<T>& centers, std::size_t size, unsigned seed) {
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::mt19937 generator{seed};
+  std::uniform_int_distribution<std::size_t> center{0, centers.size() - 1};
+  std::uniform_real_distribution<T> offset{-kEpsilon / 6, kEpsilon / 6};
+
+  std::vector<T> result(size);
+  for (T& value : result) {
+    value = centers[center(generator)] + offset(generator);
+  }
+  return result;
+}
+
+// fuzzyUniqueClusters -----------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FuzzyUniqueClustersGivenChainedValues) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // 0, 0.75 and 1.5 are chained, although 0 and 1.5 are not equal within epsilon.
+  const std::vector<T> kValues{0, kEpsilon * 3 / 4, kEpsilon * 3 / 2, 4 * kEpsilon, 10 * kEpsilon};
+
+  std::vector<std::ranges::subrange<typename std::vector<T>::const_iterator>> clusters;
+  fuzzyUniqueClusters(kValues, kEpsilon, std::back_inserter(clusters));
+
+  ASSERT_EQ(clusters.size(), 3);
+  EXPECT_EQ(clusters[0].begin(), kValues.begin());
+  EXPECT_EQ(clusters[0].size(), 3);
+  EXPECT_EQ(clusters[1].size(), 1);
+  EXPECT_EQ(clusters[2].size(), 1);
+  EXPECT_EQ(clusters[2].end(), kValues.end());
+
+  std::vector<std::ranges::subrange<typename std::vector<T>::const_iterator>> injected;
+  fuzzyUniqueClusters(kValues, std::back_inserter(injected));
+  EXPECT_EQ(injected.size(), clusters.size());
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyUniqueClustersGivenEmptyRange) {
+  using T = TypeParam;
+
+  const std::span<const T> kEmpty;
+
+  std::vector<std::ranges::subrange<typename std::span<const T>::iterator>> clusters;
+  fuzzyUniqueClusters(kEmpty, epsilon_v<T>, std::back_inserter(clusters));
+
+  EXPECT_TRUE(clusters.empty());
+}
+
+// fuzzySortUnique ---------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FuzzySortUniqueKeepsTheSmallestValueOfEachCluster) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::vector<T> values{3 * kEpsilon, 0, kEpsilon / 2, -kEpsilon, 3 * kEpsilon, kEpsilon * 7 / 2};
+  values.erase(fuzzySortUnique(values, kEpsilon), values.end());
+
+  EXPECT_EQ(values, (std::vector<T>{-kEpsilon, 3 * kEpsilon}));
+}
+
+TYPED_TEST(FloatingPointTest, FuzzySortUniqueDoesNotDependOnTheInputOrder) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kCenters{-7 * kEpsilon, 0, 2 * kEpsilon, 5 * kEpsilon, 100 * kEpsilon};
+  std::vector<T> values = randomClusters(kCenters, 1'000, /*seed=*/42);
+
+  std::vector<T> expected = values;
+  expected.erase(fuzzySortUnique(expected), expected.end());
+  ASSERT_EQ(expected.size(), kCenters.size());
+
+  std::mt19937 generator{7}; // NOLINT(cert-msc*-cpp)
+  for (int i = 0; i < 10; ++i) {
+    std::ranges::shuffle(values, generator);
+
+    std::vector<T> unique = values;
+    unique.erase(fuzzySortUnique(unique, kEpsilon), unique.end());
+    EXPECT_EQ(unique, expected);
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FuzzySortUniqueGivenProjection) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  struct Detection {
+    int id;
+    T x;
+  };
+
+  std::vector<Detection> detections{
+      {0, 5 * kEpsilon},
+      {1, 0},
+      {2, kEpsilon / 2},
+      {3, 5 * kEpsilon},
+  };
+  detections.erase(fuzzySortUnique(detections, kEpsilon, &Detection::x), detections.end());
+
+  ASSERT_EQ(detections.size(), 2);
+  EXPECT_EQ(detections[0].id, 1);
+  EXPECT_EQ(detections[1].x, 5 * kEpsilon);
+}
+
+// fuzzyMerge --------------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FuzzyMergeReplacesEachClusterByItsCentroid) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::vector<T> values{1 + kEpsilon / 2, 1, 8 * kEpsilon, 1 + kEpsilon, -1};
+  values.erase(fuzzyMerge(values, kEpsilon), values.end());
+
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], -1);
+  EXPECT_EQ(values[1], 8 * kEpsilon);
+  EXPECT_NEAR(values[2], 1 + kEpsilon / 2, kEpsilon / 100);
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyMergeGivenRandomClusters) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kCenters{-1, 0, 10 * kEpsilon, 42};
+  std::vector<T> values = randomClusters(kCenters, 500, /*seed=*/42);
+  values.erase(fuzzyMerge(values), values.end());
+
+  ASSERT_EQ(values.size(), kCenters.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_TRUE(fuzzyCmpEqual(values[i], kCenters[i], kEpsilon / 6)) << values[i];
+  }
+}
+
+} // namespace
+} // namespace robocin
@@ -5,6 +5,11 @@
 
 #include "robocin/utility/fuzzy_compare.h"
 
+#include <array>
+
+#include "robocin/utility/internal/fuzzy_compare_dispatch.h"
+#include "robocin/utility/internal/fuzzy_compare_kernels.h"
+
 namespace robocin {
 
 template class FuzzyIsZero<float>;
@@ -39,4 +44,356 @@ template class FuzzyGreaterEqual<float>;
 template class FuzzyGreaterEqual<double>;
 template class FuzzyGreaterEqual<long double>;
 
+#if defined(ROBOCIN_HAS_FLOAT16)
+template class FuzzyIsZero<float16_t>;
+template class FuzzyEqualTo<float16_t>;
+template class FuzzyNotEqualTo<float16_t>;
+template class FuzzyThreeWay<float16_t>;
+template class FuzzyLess<float16_t>;
+template class FuzzyLessEqual<float16_t>;
+template class FuzzyGreater<float16_t>;
+template class FuzzyGreaterEqual<float16_t>;
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+template class FuzzyIsZero<bfloat16_t>;
+template class FuzzyEqualTo<bfloat16_t>;
+template class FuzzyNotEqualTo<bfloat16_t>;
+template class FuzzyThreeWay<bfloat16_t>;
+template class FuzzyLess<bfloat16_t>;
+template class FuzzyLessEqual<bfloat16_t>;
+template class FuzzyGreater<bfloat16_t>;
+template class FuzzyGreaterEqual<bfloat16_t>;
+#endif
+
+// 'simd_lanes_v' is public, hence it mirrors the 'Native' vectors of the baseline instead of
+// reading them.
+template <class F>
+inline constexpr bool kMirrorsNativeLanes =
+    std::same_as<internal::simd::Native, internal::simd::None>
+    or simd_lanes_v<F> == internal::simd::Vector<internal::simd::Native, F>::kLanes;
+
+static_assert(kMirrorsNativeLanes<float> and kMirrorsNativeLanes<double>);
+
+constinit const internal::FuzzyCompareKernelSet internal::kScalarFuzzyCompareKernels =
+    internal::fuzzyCompareKernelSet<internal::simd::None>();
+#if defined(__SSE2__)
+constinit const internal::FuzzyCompareKernelSet internal::kSse2FuzzyCompareKernels =
+    internal::fuzzyCompareKernelSet<internal::simd::Sse2>();
+#endif
+
+namespace {
+
+namespace simd = internal::simd;
+
+using internal::CmpEqual;
+using internal::CmpLess;
+using internal::FuzzyCompareKernels;
+
+constexpr internal::SimdKernelTable<internal::FuzzyCompareKernelSet> kKernelTable{
+    &internal::kScalarFuzzyCompareKernels,
+#if defined(__SSE2__)
+    &internal::kSse2FuzzyCompareKernels,
+#else
+    nullptr,
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+    &internal::kAvx2FuzzyCompareKernels,
+    &internal::kAvx512FuzzyCompareKernels,
+#else
+    nullptr,
+    nullptr,
+#endif
+};
+
+// The kernels of the active instruction set, for 'F'.
+template <std::floating_point F>
+const FuzzyCompareKernels<F>& kernels() {
+  const internal::FuzzyCompareKernelSet& kSet = internal::dispatchSimdKernels(kKernelTable);
+  if constexpr (std::same_as<F, float>) {
+    return kSet.for_float;
+  } else {
+    return kSet.for_double;
+  }
+}
+
+// Half precision ----------------------------------------------------------------------------------
+// The values are widened to 'float' a mask word at a time, into the stack, and given to the 'float'
+// kernels, so that the results are the ones of the scalar functions, which widen them as well.
+
+using WordBuffer = std::array<float, simd::kMaskWordBits>;
+
+// widens the values of the given mask word.
+template <narrow_floating_point N>
+std::span<const float> widenWord(std::span<const N> values, std::size_t word, WordBuffer& buffer) {
+  const std::size_t kFirst = word * simd::kMaskWordBits;
+  const std::size_t kCount = std::min(simd::kMaskWordBits, values.size() - kFirst);
+
+  for (std::size_t i = 0; i < kCount; ++i) {
+    buffer[i] = static_cast<float>(values[kFirst + i]);
+  }
+  return std::span{buffer}.first(kCount);
+}
+
+template <narrow_floating_point N>
+void widenedIsZeroMask(std::span<const N> values, N epsilon, std::span<std::uint64_t> mask) {
+  assert(mask.size() >= simd::maskWords(values.size()));
+
+  const auto kIsZeroMask = kernels<float>().is_zero_mask;
+
+  WordBuffer buffer; // NOLINT(*-member-init)
+  for (std::size_t word = 0; word < simd::maskWords(values.size()); ++word) {
+    kIsZeroMask(widenWord(values, word, buffer),
+                static_cast<float>(epsilon),
+                mask.subspan(word, 1));
+  }
+}
+
+using FloatKernels = FuzzyCompareKernels<float>;
+
+template <FloatKernels::BinaryMask FloatKernels::*kKernel, narrow_floating_point N>
+void widenedCmpMask(std::span<const N> lhs,
+                    std::span<const N> rhs,
+                    N epsilon,
+                    std::span<std::uint64_t> mask) {
+  assert(lhs.size() == rhs.size() and mask.size() >= simd::maskWords(lhs.size()));
+
+  const auto kCmpMask = kernels<float>().*kKernel;
+
+  WordBuffer lhs_buffer; // NOLINT(*-member-init)
+  WordBuffer rhs_buffer; // NOLINT(*-member-init)
+  for (std::size_t word = 0; word < simd::maskWords(lhs.size()); ++word) {
+    kCmpMask(widenWord(lhs, word, lhs_buffer),
+             widenWord(rhs, word, rhs_buffer),
+             static_cast<float>(epsilon),
+             mask.subspan(word, 1));
+  }
+}
+
+template <FloatKernels::ValueMask FloatKernels::*kKernel, narrow_floating_point N>
+void widenedCmpMask(std::span<const N> lhs, N rhs, N epsilon, std::span<std::uint64_t> mask) {
+  assert(mask.size() >= simd::maskWords(lhs.size()));
+
+  const auto kCmpMask = kernels<float>().*kKernel;
+
+  WordBuffer buffer; // NOLINT(*-member-init)
+  for (std::size_t word = 0; word < simd::maskWords(lhs.size()); ++word) {
+    kCmpMask(widenWord(lhs, word, buffer),
+             static_cast<float>(rhs),
+             static_cast<float>(epsilon),
+             mask.subspan(word, 1));
+  }
+}
+
+template <narrow_floating_point N>
+std::size_t widenedCount(std::span<const N> values, N value, N epsilon) {
+  const auto kCount = kernels<float>().count;
+
+  std::size_t result = 0;
+
+  WordBuffer buffer; // NOLINT(*-member-init)
+  for (std::size_t word = 0; word < simd::maskWords(values.size()); ++word) {
+    result += kCount(widenWord(values, word, buffer),
+                     static_cast<float>(value),
+                     static_cast<float>(epsilon));
+  }
+  return result;
+}
+
+} // namespace
+
+void fuzzyIsZeroMask(std::span<const float> values, float epsilon, std::span<std::uint64_t> mask) {
+  kernels<float>().is_zero_mask(values, epsilon, mask);
+}
+
+void fuzzyIsZeroMask(std::span<const double> values,
+                     double epsilon,
+                     std::span<std::uint64_t> mask) {
+  kernels<double>().is_zero_mask(values, epsilon, mask);
+}
+
+void fuzzyIsZeroMask(std::span<const long double> values,
+                     long double epsilon,
+                     std::span<std::uint64_t> mask) {
+  internal::isZeroMask<simd::None>(values, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const float> lhs,
+                       std::span<const float> rhs,
+                       float epsilon,
+                       std::span<std::uint64_t> mask) {
+  kernels<float>().cmp_equal_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const double> lhs,
+                       std::span<const double> rhs,
+                       double epsilon,
+                       std::span<std::uint64_t> mask) {
+  kernels<double>().cmp_equal_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const long double> lhs,
+                       std::span<const long double> rhs,
+                       long double epsilon,
+                       std::span<std::uint64_t> mask) {
+  internal::cmpMask<simd::None, CmpEqual>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const float> lhs,
+                       float rhs,
+                       float epsilon,
+                       std::span<std::uint64_t> mask) {
+  kernels<float>().cmp_equal_value_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const double> lhs,
+                       double rhs,
+                       double epsilon,
+                       std::span<std::uint64_t> mask) {
+  kernels<double>().cmp_equal_value_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const long double> lhs,
+                       long double rhs,
+                       long double epsilon,
+                       std::span<std::uint64_t> mask) {
+  internal::cmpMask<simd::None, CmpEqual>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const float> lhs,
+                      std::span<const float> rhs,
+                      float epsilon,
+                      std::span<std::uint64_t> mask) {
+  kernels<float>().cmp_less_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const double> lhs,
+                      std::span<const double> rhs,
+                      double epsilon,
+                      std::span<std::uint64_t> mask) {
+  kernels<double>().cmp_less_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const long double> lhs,
+                      std::span<const long double> rhs,
+                      long double epsilon,
+                      std::span<std::uint64_t> mask) {
+  internal::cmpMask<simd::None, CmpLess>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const float> lhs,
+                      float rhs,
+                      float epsilon,
+                      std::span<std::uint64_t> mask) {
+  kernels<float>().cmp_less_value_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const double> lhs,
+                      double rhs,
+                      double epsilon,
+                      std::span<std::uint64_t> mask) {
+  kernels<double>().cmp_less_value_mask(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const long double> lhs,
+                      long double rhs,
+                      long double epsilon,
+                      std::span<std::uint64_t> mask) {
+  internal::cmpMask<simd::None, CmpLess>(lhs, rhs, epsilon, mask);
+}
+
+std::size_t fuzzyCount(std::span<const float> values, float value, float epsilon) {
+  return kernels<float>().count(values, value, epsilon);
+}
+
+std::size_t fuzzyCount(std::span<const double> values, double value, double epsilon) {
+  return kernels<double>().count(values, value, epsilon);
+}
+
+std::size_t fuzzyCount(std::span<const long double> values,
+                       long double value,
+                       long double epsilon) {
+  return internal::count<simd::None>(values, value, epsilon);
+}
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+void fuzzyIsZeroMask(std::span<const float16_t> values,
+                     float16_t epsilon,
+                     std::span<std::uint64_t> mask) {
+  widenedIsZeroMask(values, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const float16_t> lhs,
+                       std::span<const float16_t> rhs,
+                       float16_t epsilon,
+                       std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_equal_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const float16_t> lhs,
+                       float16_t rhs,
+                       float16_t epsilon,
+                       std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_equal_value_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const float16_t> lhs,
+                      std::span<const float16_t> rhs,
+                      float16_t epsilon,
+                      std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_less_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const float16_t> lhs,
+                      float16_t rhs,
+                      float16_t epsilon,
+                      std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_less_value_mask>(lhs, rhs, epsilon, mask);
+}
+
+std::size_t fuzzyCount(std::span<const float16_t> values, float16_t value, float16_t epsilon) {
+  return widenedCount(values, value, epsilon);
+}
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+void fuzzyIsZeroMask(std::span<const bfloat16_t> values,
+                     bfloat16_t epsilon,
+                     std::span<std::uint64_t> mask) {
+  widenedIsZeroMask(values, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const bfloat16_t> lhs,
+                       std::span<const bfloat16_t> rhs,
+                       bfloat16_t epsilon,
+                       std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_equal_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpEqualMask(std::span<const bfloat16_t> lhs,
+                       bfloat16_t rhs,
+                       bfloat16_t epsilon,
+                       std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_equal_value_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const bfloat16_t> lhs,
+                      std::span<const bfloat16_t> rhs,
+                      bfloat16_t epsilon,
+                      std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_less_mask>(lhs, rhs, epsilon, mask);
+}
+
+void fuzzyCmpLessMask(std::span<const bfloat16_t> lhs,
+                      bfloat16_t rhs,
+                      bfloat16_t epsilon,
+                      std::span<std::uint64_t> mask) {
+  widenedCmpMask<&FloatKernels::cmp_less_value_mask>(lhs, rhs, epsilon, mask);
+}
+
+std::size_t fuzzyCount(std::span<const bfloat16_t> values, bfloat16_t value, bfloat16_t epsilon) {
+  return widenedCount(values, value, epsilon);
+}
+#endif
+
 } // namespace robocin
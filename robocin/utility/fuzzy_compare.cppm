@@ -0,0 +1,85 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The 'robocin.utility.fuzzy_compare' module interface, built when 'ROBOCIN_CPP_MODULES' is set. It
+// exports the declarations of 'fuzzy_compare.h', which is included in the global module fragment
+// along with the configured 'epsilon.h', so that importers see the epsilons the library was built
+// with (e.g. 'epsilon_v<double>'), as the includers of the header do.
+
+module;
+
+#include "robocin/utility/fuzzy_compare.h"
+
+export module robocin.utility.fuzzy_compare;
+
+export namespace robocin {
+
+// concepts.h / type_traits.h.
+using robocin::arithmetic;
+using robocin::common_floating_point_for_comparison;
+using robocin::common_floating_point_for_comparison_t;
+using robocin::contiguous_arithmetic_range;
+using robocin::contiguous_floating_point_range;
+using robocin::floating_point;
+using robocin::narrow_floating_point;
+using robocin::output_contiguous_arithmetic_range;
+using robocin::range_scalar;
+using robocin::range_scalar_t;
+using robocin::widened_floating_point;
+using robocin::widened_floating_point_t;
+#if defined(ROBOCIN_HAS_FLOAT16)
+using robocin::float16_t;
+#endif
+#if defined(ROBOCIN_HAS_BFLOAT16)
+using robocin::bfloat16_t;
+#endif
+
+// epsilon.h.
+using robocin::epsilon_v;
+using robocin::has_epsilon;
+using robocin::has_epsilon_v;
+
+// fuzzy_instrumentation.h.
+using robocin::dumpFuzzyInstrumentation;
+using robocin::FuzzyCallSite;
+using robocin::FuzzyCallSiteHistogram;
+using robocin::fuzzyInstrumentationSnapshot;
+using robocin::kFuzzyInstrumentationEnabled;
+using robocin::kFuzzyRatioBins;
+using robocin::kFuzzyRatioBounds;
+
+// fuzzy_compare.h.
+using robocin::AbsoluteComparison;
+using robocin::AbsoluteOrRelativeComparison;
+using robocin::RelativeComparison;
+using robocin::UlpComparison;
+using robocin::fuzzy_comparison_policy;
+using robocin::has_default_tolerance_v;
+
+using robocin::fuzzyCmpEqual;
+using robocin::fuzzyCmpGreater;
+using robocin::fuzzyCmpGreaterEqual;
+using robocin::fuzzyCmpLess;
+using robocin::fuzzyCmpLessEqual;
+using robocin::fuzzyCmpNotEqual;
+using robocin::fuzzyCmpThreeWay;
+using robocin::fuzzyIsZero;
+
+using robocin::FuzzyEqualTo;
+using robocin::FuzzyGreater;
+using robocin::FuzzyGreaterEqual;
+using robocin::FuzzyIsZero;
+using robocin::FuzzyLess;
+using robocin::FuzzyLessEqual;
+using robocin::FuzzyNotEqualTo;
+using robocin::FuzzyThreeWay;
+
+using robocin::fuzzyCmpEqualMask;
+using robocin::fuzzyCmpLessMask;
+using robocin::fuzzyCount;
+using robocin::fuzzyIsZeroMask;
+using robocin::fuzzyMaskSize;
+
+} // namespace robocin
@@ -6,310 +6,1258 @@
 #ifndef ROBOCIN_UTILITY_FUZZY_COMPARE_H
 #define ROBOCIN_UTILITY_FUZZY_COMPARE_H
 
+#include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cmath>
 #include <compare>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
 #include "robocin/utility/concepts.h"
 #include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_instrumentation.h"
 #include "robocin/utility/type_traits.h"
 
 namespace robocin {
+namespace internal {
+
+// widens the half precision types to 'float' (see 'widened_floating_point'), in which they are
+// compared, leaving any other type unchanged, so that the usual arithmetic conversions apply.
+template <arithmetic T>
+constexpr auto widen(T value) {
+  return static_cast<widened_floating_point_t<T>>(value);
+}
+
+} // namespace internal
+
+// Comparison policies -----------------------------------------------------------------------------
+// A policy defines when two values are equal within a tolerance, by a static 'equal(lhs, rhs,
+// tolerance)', and may provide the tolerance used when none is given, by a static 'tolerance<F>()'.
+// The remaining comparisons are derived from 'equal': 'lhs' is less than 'rhs' if it is not equal
+// to it and 'lhs < rhs'. Every policy is branch-free, so that it vectorizes.
+//
+// A policy may also provide how far apart two values are, in tolerances, by a static 'ratio(lhs,
+// rhs, tolerance)', which is at most 1 if they are equal. It is recorded by the instrumentation of
+// 'fuzzy_instrumentation.h', when enabled.
+
+// Equal if 'abs(lhs - rhs) <= epsilon'. The default policy.
+struct AbsoluteComparison {
+  template <floating_point F>
+  static constexpr F tolerance()
+    requires(has_epsilon_v<F>)
+  {
+    return epsilon_v<F>;
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr bool equal(T lhs, U rhs, V epsilon) {
+    return std::abs(internal::widen(lhs) - internal::widen(rhs)) <= internal::widen(epsilon);
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr auto ratio(T lhs, U rhs, V epsilon) {
+    const auto kDistance = std::abs(internal::widen(lhs) - internal::widen(rhs));
+    return kDistance == 0 ? decltype(kDistance){0} : kDistance / internal::widen(epsilon);
+  }
+};
+
+// Equal if 'abs(lhs - rhs) <= epsilon * max(abs(lhs), abs(rhs))', i.e. if they agree in their most
+// significant digits, regardless of their magnitude (e.g. timestamps). Only zero is equal to zero.
+struct RelativeComparison {
+  template <floating_point F>
+  static constexpr F tolerance()
+    requires(has_epsilon_v<F>)
+  {
+    return epsilon_v<F>;
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr bool equal(T lhs, U rhs, V epsilon) {
+    using W = widened_floating_point_t<V>;
+
+    const auto kLhs = static_cast<W>(lhs);
+    const auto kRhs = static_cast<W>(rhs);
+
+    return std::abs(kLhs - kRhs)
+           <= static_cast<W>(epsilon) * std::max(std::abs(kLhs), std::abs(kRhs));
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr auto ratio(T lhs, U rhs, V epsilon) {
+    using W = widened_floating_point_t<V>;
+
+    const auto kLhs = static_cast<W>(lhs);
+    const auto kRhs = static_cast<W>(rhs);
+    const W kDistance = std::abs(kLhs - kRhs);
+    const W kScale = std::max(std::abs(kLhs), std::abs(kRhs));
+
+    return kDistance == 0 ? W{0} : kDistance / (static_cast<W>(epsilon) * kScale);
+  }
+};
+
+// Equal if 'abs(lhs - rhs) <= epsilon * max(1, abs(lhs), abs(rhs))': absolute for values up to 1 in
+// magnitude, and relative beyond it (e.g. field coordinates, in millimetres).
+struct AbsoluteOrRelativeComparison {
+  template <floating_point F>
+  static constexpr F tolerance()
+    requires(has_epsilon_v<F>)
+  {
+    return epsilon_v<F>;
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr bool equal(T lhs, U rhs, V epsilon) {
+    using W = widened_floating_point_t<V>;
+
+    const auto kLhs = static_cast<W>(lhs);
+    const auto kRhs = static_cast<W>(rhs);
+
+    return std::abs(kLhs - kRhs)
+           <= static_cast<W>(epsilon) * std::max({W{1}, std::abs(kLhs), std::abs(kRhs)});
+  }
+
+  template <arithmetic T, arithmetic U, floating_point V>
+  static constexpr auto ratio(T lhs, U rhs, V epsilon) {
+    using W = widened_floating_point_t<V>;
+
+    const auto kLhs = static_cast<W>(lhs);
+    const auto kRhs = static_cast<W>(rhs);
+    const W kDistance = std::abs(kLhs - kRhs);
+    const W kScale = std::max({W{1}, std::abs(kLhs), std::abs(kRhs)});
+
+    return kDistance == 0 ? W{0} : kDistance / (static_cast<W>(epsilon) * kScale);
+  }
+};
+
+namespace internal {
+
+template <class F>
+concept ulp_comparable =
+    std::floating_point<F> and std::numeric_limits<F>::is_iec559
+    and (sizeof(F) == sizeof(std::int32_t) or sizeof(F) == sizeof(std::int64_t));
+
+// The bits of a floating point value, as an integer whose order is the order of the values: the
+// sign-magnitude representation is mapped to two's complement, in which both zeros are 0.
+template <ulp_comparable F>
+constexpr auto orderedBits(F value) {
+  using Int = std::conditional_t<sizeof(F) == sizeof(std::int32_t), std::int32_t, std::int64_t>;
+
+  const auto kBits = std::bit_cast<Int>(value);
+  return kBits < 0 ? std::numeric_limits<Int>::min() - kBits : kBits;
+}
+
+// The number of representable values between 'lhs' and 'rhs', as an unsigned integer.
+template <ulp_comparable F>
+constexpr auto ulpDistance(F lhs, F rhs) {
+  const auto kLhsBits = orderedBits(lhs);
+  const auto kRhsBits = orderedBits(rhs);
+
+  using UInt = std::make_unsigned_t<decltype(kLhsBits)>;
+  return kLhsBits < kRhsBits ? static_cast<UInt>(kRhsBits) - static_cast<UInt>(kLhsBits) :
+                               static_cast<UInt>(kLhsBits) - static_cast<UInt>(kRhsBits);
+}
+
+} // namespace internal
+
+// Equal if at most 'max_ulps' representable values lie between 'lhs' and 'rhs' (i.e. units in the
+// last place, computed from their bits), where 'max_ulps' is given as the tolerance. NaNs are never
+// equal. Only 'float' and 'double' (as 'V') are supported.
+struct UlpComparison {
+  static constexpr std::uint64_t kDefaultMaxUlps = 4;
+
+  template <floating_point F>
+  static constexpr F tolerance() {
+    return static_cast<F>(kDefaultMaxUlps);
+  }
+
+  template <arithmetic T, arithmetic U, internal::ulp_comparable V>
+  static constexpr bool equal(T lhs, U rhs, V max_ulps) {
+    const auto kLhs = static_cast<V>(lhs);
+    const auto kRhs = static_cast<V>(rhs);
+
+    const auto kDistance = internal::ulpDistance(kLhs, kRhs);
+
+    return (kLhs == kLhs) & (kRhs == kRhs)
+           & (kDistance <= static_cast<decltype(kDistance)>(max_ulps));
+  }
+
+  // NaNs are infinitely far apart from any value.
+  template <arithmetic T, arithmetic U, internal::ulp_comparable V>
+  static constexpr V ratio(T lhs, U rhs, V max_ulps) {
+    const auto kLhs = static_cast<V>(lhs);
+    const auto kRhs = static_cast<V>(rhs);
+
+    if (kLhs != kLhs or kRhs != kRhs) {
+      return std::numeric_limits<V>::infinity();
+    }
+    return static_cast<V>(internal::ulpDistance(kLhs, kRhs)) / max_ulps;
+  }
+};
+
+template <class Policy>
+concept fuzzy_comparison_policy = requires(double lhs, double rhs, double tolerance) {
+  { Policy::equal(lhs, rhs, tolerance) } -> std::same_as<bool>;
+};
+
+// Whether 'Policy' provides a tolerance for 'F', used when none is given.
+template <class Policy, class F>
+inline constexpr bool has_default_tolerance_v = requires {
+  { Policy::template tolerance<F>() } -> std::same_as<F>;
+};
+
+namespace internal {
+
+// records the ratio of a comparison at its call site, when the instrumentation is enabled and the
+// policy provides it. Compiled out otherwise, as in constant evaluation.
+template <class Policy, arithmetic T, arithmetic U, floating_point V>
+constexpr void recordFuzzyComparison([[maybe_unused]] T lhs,
+                                     [[maybe_unused]] U rhs,
+                                     [[maybe_unused]] V tolerance,
+                                     [[maybe_unused]] const FuzzyCallSite& site) {
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+  if constexpr (requires { Policy::ratio(lhs, rhs, tolerance); }) {
+    if (not std::is_constant_evaluated()) {
+      recordFuzzyRatio(site.location(), static_cast<double>(Policy::ratio(lhs, rhs, tolerance)));
+    }
+  }
+#endif
+}
+
+} // namespace internal
+
+// Scalar functions --------------------------------------------------------------------------------
+// The trailing 'FuzzyCallSite' of the following functions captures their call site, at which the
+// comparison is recorded when the instrumentation of 'fuzzy_instrumentation.h' is enabled (it is
+// empty otherwise). Wrappers may forward their own, so that the comparisons are recorded at their
+// callers.
+
+// Compare if a given value is zero, using a policy and a given tolerance --------------------------
+template <fuzzy_comparison_policy Policy, arithmetic T, floating_point U>
+constexpr bool fuzzyIsZero(T value, U tolerance, FuzzyCallSite site = {}) {
+  internal::recordFuzzyComparison<Policy>(value, T{0}, tolerance, site);
+  return Policy::equal(value, T{0}, tolerance);
+}
+
+// Compare if a given value is zero, using a policy and its tolerance ------------------------------
+template <fuzzy_comparison_policy Policy, arithmetic T, floating_point U = T>
+constexpr bool fuzzyIsZero(T value, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, U>)
+{
+  return fuzzyIsZero<Policy>(value, Policy::template tolerance<U>(), site);
+}
 
 // Compare if a given value is zero, using a given epsilon -----------------------------------------
-template <arithmetic T, std::floating_point U>
-constexpr bool fuzzyIsZero(T value, U epsilon) {
-  return std::abs(value) <= epsilon;
+template <arithmetic T, floating_point U>
+constexpr bool fuzzyIsZero(T value, U epsilon, FuzzyCallSite site = {}) {
+  return fuzzyIsZero<AbsoluteComparison>(value, epsilon, site);
 }
 
 // Compare if a given value is zero, using the injected epsilon ------------------------------------
-template <arithmetic T, std::floating_point U = T>
-constexpr bool fuzzyIsZero(T value)
+template <arithmetic T, floating_point U = T>
+constexpr bool fuzzyIsZero(T value, FuzzyCallSite site = {})
   requires(has_epsilon_v<U>)
 {
-  return fuzzyIsZero(value, epsilon_v<U>);
+  return fuzzyIsZero(value, epsilon_v<U>, site);
+}
+
+// Compare if two given values are equal, using a policy and a given tolerance ---------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  internal::recordFuzzyComparison<Policy>(lhs, rhs, tolerance, site);
+  return Policy::equal(lhs, rhs, tolerance);
+}
+
+// Compare if two given values are equal, using a policy and its tolerance -------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpEqual<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if two given values are equal, using a given epsilon ------------------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpEqual(T lhs, U rhs, V epsilon) {
-  return std::abs(lhs - rhs) <= epsilon;
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpEqual<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if two given values are equal, using the injected epsilon -------------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpEqual(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpEqual(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpEqual(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Compare if two given values are not equal, using a policy and a given tolerance -----------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpNotEqual(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  return not fuzzyCmpEqual<Policy>(lhs, rhs, tolerance, site);
+}
+
+// Compare if two given values are not equal, using a policy and its tolerance ---------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpNotEqual(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpNotEqual<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if two given values are not equal, using a given epsilon --------------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpNotEqual(T lhs, U rhs, V epsilon) {
-  return not fuzzyCmpEqual(lhs, rhs, epsilon);
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpNotEqual(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpNotEqual<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if two given values are not equal, using the injected epsilon ---------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpNotEqual(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpNotEqual(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return not fuzzyCmpEqual(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpNotEqual(lhs, rhs, epsilon_v<V>, site);
 }
 
-// Three-way compare two given values, using a given epsilon ---------------------------------------
-template <arithmetic T,
+// Three-way compare two given values, using a policy and a given tolerance ------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs, U rhs, V epsilon) {
-  if (fuzzyCmpEqual(lhs, rhs, epsilon)) {
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs,
+                                                U rhs,
+                                                V tolerance,
+                                                FuzzyCallSite site = {}) {
+  if (fuzzyCmpEqual<Policy>(lhs, rhs, tolerance, site)) {
     return std::strong_ordering::equal;
   }
-  return (lhs < rhs) ? std::strong_ordering::less : std::strong_ordering::greater;
+  return (internal::widen(lhs) < internal::widen(rhs)) ? std::strong_ordering::less :
+                                                         std::strong_ordering::greater;
+}
+
+// Three-way compare two given values, using a policy and its tolerance ----------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpThreeWay<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
+}
+
+// Three-way compare two given values, using a given epsilon ---------------------------------------
+template <arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpThreeWay<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Three-way compare two given values, using the injected epsilon ----------------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpThreeWay(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpThreeWay(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Compare if the first given value is lt the second, using a policy and a given tolerance ---------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLess(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  return std::is_lt(fuzzyCmpThreeWay<Policy>(lhs, rhs, tolerance, site));
+}
+
+// Compare if the first given value is lt the second, using a policy and its tolerance -------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLess(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpLess<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if the first given value is lt the second, using a given epsilon ------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpLess(T lhs, U rhs, V epsilon) {
-  return std::is_lt(fuzzyCmpThreeWay(lhs, rhs, epsilon));
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLess(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpLess<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if the first given value lt the second, using the injected epsilon ----------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpLess(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLess(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpLess(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpLess(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Compare if the first given value is lteq to the second, using a policy and a given tolerance ----
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLessEqual(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  return std::is_lteq(fuzzyCmpThreeWay<Policy>(lhs, rhs, tolerance, site));
+}
+
+// Compare if the first given value is lteq to the second, using a policy and its tolerance --------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLessEqual(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpLessEqual<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if the first given value is lteq to the second, using a given epsilon -------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpLessEqual(T lhs, U rhs, V epsilon) {
-  return std::is_lteq(fuzzyCmpThreeWay(lhs, rhs, epsilon));
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLessEqual(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpLessEqual<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if the first given value is lteq to the second, using the injected epsilon --------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpLessEqual(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpLessEqual(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpLessEqual(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpLessEqual(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Compare if the first given value is gt the second, using a policy and a given tolerance ---------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreater(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  return std::is_gt(fuzzyCmpThreeWay<Policy>(lhs, rhs, tolerance, site));
+}
+
+// Compare if the first given value is gt the second, using a policy and its tolerance -------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreater(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpGreater<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if the first given value is gt the second, using a given epsilon ------------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpGreater(T lhs, U rhs, V epsilon) {
-  return std::is_gt(fuzzyCmpThreeWay(lhs, rhs, epsilon));
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreater(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpGreater<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if the first given value is gt the second, using the injected epsilon -------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpGreater(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreater(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpGreater(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpGreater(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Compare if the first given value is gteq to the second, using a policy and a given tolerance ----
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs, V tolerance, FuzzyCallSite site = {}) {
+  return std::is_gteq(fuzzyCmpThreeWay<Policy>(lhs, rhs, tolerance, site));
+}
+
+// Compare if the first given value is gteq to the second, using a policy and its tolerance --------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpGreaterEqual<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
 }
 
 // Compare if the first given value is gteq to the second, using a given epsilon -------------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs, V epsilon) {
-  return std::is_gteq(fuzzyCmpThreeWay(lhs, rhs, epsilon));
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpGreaterEqual<AbsoluteComparison>(lhs, rhs, epsilon, site);
 }
 
 // Compare if the first given value is gteq to the second, using the injected epsilon --------------
 template <arithmetic T,
           arithmetic U,
-          std::floating_point V = common_floating_point_for_comparison_t<T, U>>
-constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs)
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpGreaterEqual(T lhs, U rhs, FuzzyCallSite site = {})
   requires(has_epsilon_v<V>)
 {
-  return fuzzyCmpGreaterEqual(lhs, rhs, epsilon_v<V>);
+  return fuzzyCmpGreaterEqual(lhs, rhs, epsilon_v<V>, site);
 }
 
 // Functors ----------------------------------------------------------------------------------------
-template <std::floating_point F>
+// The tolerance is given on construction or, by default, the one of the policy (i.e. the injected
+// epsilon, for 'AbsoluteComparison'). The default constructors are templates, so that the explicit
+// instantiations below do not look up the epsilon, which may be injected after this header.
+//
+// The comparisons of a functor are recorded, by the instrumentation, at the call site of its
+// constructor (e.g. where it is given to an algorithm).
+
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyIsZero {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyIsZero()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyIsZero(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyIsZero(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyIsZero(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
-  constexpr bool operator()(value_type value) const { return fuzzyIsZero(value, epsilon_); }
+  constexpr bool operator()(value_type value) const {
+    return fuzzyIsZero<Policy>(value, epsilon_, site_);
+  }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyEqualTo {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyEqualTo()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyEqualTo(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyEqualTo(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyEqualTo(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpEqual(lhs, rhs, epsilon_);
+    return fuzzyCmpEqual<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyNotEqualTo {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyNotEqualTo()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyNotEqualTo(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyNotEqualTo(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyNotEqualTo(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpNotEqual(lhs, rhs, epsilon_);
+    return fuzzyCmpNotEqual<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyThreeWay {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyThreeWay()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyThreeWay(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyThreeWay(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyThreeWay(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr std::strong_ordering operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpThreeWay(lhs, rhs, epsilon_);
+    return fuzzyCmpThreeWay<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyLess {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyLess()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyLess(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyLess(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyLess(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpLess(lhs, rhs, epsilon_);
+    return fuzzyCmpLess<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyLessEqual {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyLessEqual()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyLessEqual(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyLessEqual(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyLessEqual(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpLessEqual(lhs, rhs, epsilon_);
+    return fuzzyCmpLessEqual<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyGreater {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyGreater()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyGreater(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyGreater(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyGreater(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpGreater(lhs, rhs, epsilon_);
+    return fuzzyCmpGreater<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
-template <std::floating_point F>
+template <floating_point F, fuzzy_comparison_policy Policy = AbsoluteComparison>
 class FuzzyGreaterEqual {
  public:
   using value_type = F;
+  using policy_type = Policy;
 
-  constexpr FuzzyGreaterEqual()
-    requires(has_epsilon_v<value_type>)
-      : epsilon_{epsilon_v<value_type>} {}
+  template <class P = Policy>
+    requires(has_default_tolerance_v<P, value_type>)
+  constexpr FuzzyGreaterEqual(FuzzyCallSite site = {}) : // NOLINT(google-explicit-constructor)
+      epsilon_{P::template tolerance<value_type>()},
+      site_{site} {}
 
-  constexpr explicit FuzzyGreaterEqual(value_type epsilon) : epsilon_{epsilon} {}
+  constexpr explicit FuzzyGreaterEqual(value_type epsilon, FuzzyCallSite site = {}) :
+      epsilon_{epsilon},
+      site_{site} {}
 
   constexpr bool operator()(value_type lhs, value_type rhs) const {
-    return fuzzyCmpGreaterEqual(lhs, rhs, epsilon_);
+    return fuzzyCmpGreaterEqual<Policy>(lhs, rhs, epsilon_, site_);
   }
 
  private:
   value_type epsilon_;
+  [[no_unique_address]] FuzzyCallSite site_;
 };
 
+// The functors are instantiated, with the default policy, by 'fuzzy_compare.cpp', so that the
+// translation units that use them do not instantiate them again.
+
+extern template class FuzzyIsZero<float>;
+extern template class FuzzyIsZero<double>;
+extern template class FuzzyIsZero<long double>;
+
+extern template class FuzzyEqualTo<float>;
+extern template class FuzzyEqualTo<double>;
+extern template class FuzzyEqualTo<long double>;
+
+extern template class FuzzyNotEqualTo<float>;
+extern template class FuzzyNotEqualTo<double>;
+extern template class FuzzyNotEqualTo<long double>;
+
+extern template class FuzzyThreeWay<float>;
+extern template class FuzzyThreeWay<double>;
+extern template class FuzzyThreeWay<long double>;
+
+extern template class FuzzyLess<float>;
+extern template class FuzzyLess<double>;
+extern template class FuzzyLess<long double>;
+
+extern template class FuzzyLessEqual<float>;
+extern template class FuzzyLessEqual<double>;
+extern template class FuzzyLessEqual<long double>;
+
+extern template class FuzzyGreater<float>;
+extern template class FuzzyGreater<double>;
+extern template class FuzzyGreater<long double>;
+
+extern template class FuzzyGreaterEqual<float>;
+extern template class FuzzyGreaterEqual<double>;
+extern template class FuzzyGreaterEqual<long double>;
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+extern template class FuzzyIsZero<float16_t>;
+extern template class FuzzyEqualTo<float16_t>;
+extern template class FuzzyNotEqualTo<float16_t>;
+extern template class FuzzyThreeWay<float16_t>;
+extern template class FuzzyLess<float16_t>;
+extern template class FuzzyLessEqual<float16_t>;
+extern template class FuzzyGreater<float16_t>;
+extern template class FuzzyGreaterEqual<float16_t>;
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+extern template class FuzzyIsZero<bfloat16_t>;
+extern template class FuzzyEqualTo<bfloat16_t>;
+extern template class FuzzyNotEqualTo<bfloat16_t>;
+extern template class FuzzyThreeWay<bfloat16_t>;
+extern template class FuzzyLess<bfloat16_t>;
+extern template class FuzzyLessEqual<bfloat16_t>;
+extern template class FuzzyGreater<bfloat16_t>;
+extern template class FuzzyGreaterEqual<bfloat16_t>;
+#endif
+
+// Batch overloads ---------------------------------------------------------------------------------
+// The following functions apply 'fuzzyIsZero', 'fuzzyCmpEqual' and 'fuzzyCmpLess' to every element
+// of the given spans (or to every element and a given value), using vectorized kernels for 'float'
+// and 'double' whenever the target supports them. Their results are bit-identical to the scalar
+// functions and are written as packed bitmasks: bit 'i % 64' of 'mask[i / 64]' holds the result
+// for the i-th element, and the unused bits of the last word are cleared. 'mask' must have at least
+// 'fuzzyMaskSize(size)' words.
+
+constexpr std::size_t fuzzyMaskSize(std::size_t size) { return (size + 63) / 64; }
+
+void fuzzyIsZeroMask(std::span<const float> values, float epsilon, std::span<std::uint64_t> mask);
+void fuzzyIsZeroMask(std::span<const double> values, double epsilon, std::span<std::uint64_t> mask);
+void fuzzyIsZeroMask(std::span<const long double> values,
+                     long double epsilon,
+                     std::span<std::uint64_t> mask);
+
+void fuzzyCmpEqualMask(std::span<const float> lhs,
+                       std::span<const float> rhs,
+                       float epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const double> lhs,
+                       std::span<const double> rhs,
+                       double epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const long double> lhs,
+                       std::span<const long double> rhs,
+                       long double epsilon,
+                       std::span<std::uint64_t> mask);
+
+void fuzzyCmpEqualMask(std::span<const float> lhs,
+                       float rhs,
+                       float epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const double> lhs,
+                       double rhs,
+                       double epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const long double> lhs,
+                       long double rhs,
+                       long double epsilon,
+                       std::span<std::uint64_t> mask);
+
+void fuzzyCmpLessMask(std::span<const float> lhs,
+                      std::span<const float> rhs,
+                      float epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const double> lhs,
+                      std::span<const double> rhs,
+                      double epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const long double> lhs,
+                      std::span<const long double> rhs,
+                      long double epsilon,
+                      std::span<std::uint64_t> mask);
+
+void fuzzyCmpLessMask(std::span<const float> lhs,
+                      float rhs,
+                      float epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const double> lhs,
+                      double rhs,
+                      double epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const long double> lhs,
+                      long double rhs,
+                      long double epsilon,
+                      std::span<std::uint64_t> mask);
+
+// Number of values equal to a given one, using a given epsilon.
+std::size_t fuzzyCount(std::span<const float> values, float value, float epsilon);
+std::size_t fuzzyCount(std::span<const double> values, double value, double epsilon);
+std::size_t fuzzyCount(std::span<const long double> values, long double value, long double epsilon);
+
+// Half precision overloads: the values are widened to 'float' a mask word at a time, on the stack,
+// and compared by the 'float' kernels, hence as the scalar functions compare them.
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+void fuzzyIsZeroMask(std::span<const float16_t> values,
+                     float16_t epsilon,
+                     std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const float16_t> lhs,
+                       std::span<const float16_t> rhs,
+                       float16_t epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const float16_t> lhs,
+                       float16_t rhs,
+                       float16_t epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const float16_t> lhs,
+                      std::span<const float16_t> rhs,
+                      float16_t epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const float16_t> lhs,
+                      float16_t rhs,
+                      float16_t epsilon,
+                      std::span<std::uint64_t> mask);
+std::size_t fuzzyCount(std::span<const float16_t> values, float16_t value, float16_t epsilon);
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+void fuzzyIsZeroMask(std::span<const bfloat16_t> values,
+                     bfloat16_t epsilon,
+                     std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const bfloat16_t> lhs,
+                       std::span<const bfloat16_t> rhs,
+                       bfloat16_t epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpEqualMask(std::span<const bfloat16_t> lhs,
+                       bfloat16_t rhs,
+                       bfloat16_t epsilon,
+                       std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const bfloat16_t> lhs,
+                      std::span<const bfloat16_t> rhs,
+                      bfloat16_t epsilon,
+                      std::span<std::uint64_t> mask);
+void fuzzyCmpLessMask(std::span<const bfloat16_t> lhs,
+                      bfloat16_t rhs,
+                      bfloat16_t epsilon,
+                      std::span<std::uint64_t> mask);
+std::size_t fuzzyCount(std::span<const bfloat16_t> values, bfloat16_t value, bfloat16_t epsilon);
+#endif
+
+// As above, using the injected epsilon.
+
+template <std::ranges::contiguous_range R, class F = std::ranges::range_value_t<R>>
+void fuzzyIsZeroMask(const R& values, std::span<std::uint64_t> mask)
+  requires(has_epsilon_v<F>)
+{
+  fuzzyIsZeroMask(std::span<const F>{values}, epsilon_v<F>, mask);
+}
+
+template <std::ranges::contiguous_range R, class U, class F = std::ranges::range_value_t<R>>
+void fuzzyCmpEqualMask(const R& lhs, const U& rhs, std::span<std::uint64_t> mask)
+  requires(has_epsilon_v<F>)
+{
+  if constexpr (std::ranges::contiguous_range<U>) {
+    fuzzyCmpEqualMask(std::span<const F>{lhs}, std::span<const F>{rhs}, epsilon_v<F>, mask);
+  } else {
+    fuzzyCmpEqualMask(std::span<const F>{lhs}, static_cast<F>(rhs), epsilon_v<F>, mask);
+  }
+}
+
+template <std::ranges::contiguous_range R, class U, class F = std::ranges::range_value_t<R>>
+void fuzzyCmpLessMask(const R& lhs, const U& rhs, std::span<std::uint64_t> mask)
+  requires(has_epsilon_v<F>)
+{
+  if constexpr (std::ranges::contiguous_range<U>) {
+    fuzzyCmpLessMask(std::span<const F>{lhs}, std::span<const F>{rhs}, epsilon_v<F>, mask);
+  } else {
+    fuzzyCmpLessMask(std::span<const F>{lhs}, static_cast<F>(rhs), epsilon_v<F>, mask);
+  }
+}
+
+template <std::ranges::contiguous_range R, class F = std::ranges::range_value_t<R>>
+std::size_t fuzzyCount(const R& values, std::type_identity_t<F> value)
+  requires(has_epsilon_v<F>)
+{
+  return fuzzyCount(std::span<const F>{values}, value, epsilon_v<F>);
+}
+
+// Range overloads ---------------------------------------------------------------------------------
+// The following overloads compare every element of a contiguous range to the corresponding element
+// of another one, or to a scalar (e.g. 'fuzzyCmpEqual(lhs, rhs, mask)' given vectors), writing
+// packed bitmasks as the batch overloads above do. Their epsilon type, when not given, is the one
+// of the scalar functions: 'common_floating_point_for_comparison_t' of the value types.
+//
+// When the ranges (or the scalar) and the epsilon have the same floating point type, they call
+// the batch overloads, hence the vectorized kernels; otherwise (e.g. mixed types or integers), they
+// loop over the scalar functions, so that no value is narrowed and the masks match theirs.
+// Their comparisons are recorded at the call site of the overload (the batch overloads are not
+// instrumented).
+
+namespace internal {
+
+template <class T>
+constexpr auto fuzzyElement(const T& values, std::size_t index) {
+  if constexpr (std::ranges::range<T>) {
+    return std::ranges::data(values)[index];
+  } else {
+    return values;
+  }
+}
+
+// whether a range, a range (or a scalar) and an epsilon may be given to the batch overloads as they
+// are, i.e. without converting any of them.
+template <class L, class R, class V, class F = std::ranges::range_value_t<L>>
+inline constexpr bool kFuzzyBatchable =
+    floating_point<F> and std::same_as<range_scalar_t<R>, F> and std::same_as<V, F>;
+
+// calls 'batch(lhs, rhs, epsilon, mask)' with spans (and a scalar) when 'kFuzzyBatchable', and
+// writes the mask of 'scalar(lhs[i], rhs[i], epsilon)' otherwise.
+template <class Batch, class Scalar, class L, class R, floating_point V>
+void fuzzyRangeMask(Batch batch,
+                    Scalar scalar,
+                    const L& lhs,
+                    const R& rhs,
+                    V epsilon,
+                    std::span<std::uint64_t> mask) {
+  const std::size_t kSize = std::ranges::size(lhs);
+  if constexpr (std::ranges::range<R>) {
+    assert(std::ranges::size(rhs) == kSize);
+  }
+  assert(mask.size() >= fuzzyMaskSize(kSize));
+
+  if constexpr (kFuzzyBatchable<L, R, V>) {
+    using F = std::ranges::range_value_t<L>;
+
+    if constexpr (std::ranges::range<R>) {
+      batch(std::span<const F>{lhs}, std::span<const F>{rhs}, epsilon, mask);
+    } else {
+      batch(std::span<const F>{lhs}, rhs, epsilon, mask);
+    }
+  } else {
+    std::ranges::fill(mask.first(fuzzyMaskSize(kSize)), std::uint64_t{0});
+    for (std::size_t i = 0; i < kSize; ++i) {
+      const bool kBit = scalar(fuzzyElement(lhs, i), fuzzyElement(rhs, i), epsilon);
+      mask[i / 64] |= static_cast<std::uint64_t>(kBit) << (i % 64);
+    }
+  }
+}
+
+// negates the mask of 'size' elements, keeping the unused bits of its last word cleared.
+inline void fuzzyComplementMask(std::size_t size, std::span<std::uint64_t> mask) {
+  for (std::size_t i = 0; i < fuzzyMaskSize(size); ++i) {
+    mask[i] = ~mask[i];
+  }
+  if (size % 64 != 0) {
+    mask[size / 64] &= (std::uint64_t{1} << (size % 64)) - 1;
+  }
+}
+
+// 'fuzzyCmpGreater' of a span and a span (or a scalar), as neither less nor equal (i.e. unordered
+// values are greater, as in 'fuzzyCmpThreeWay'), computing the equal mask a word at a time, so that
+// no buffer is needed besides 'mask'.
+template <floating_point F, class R>
+void fuzzyCmpGreaterMask(std::span<const F> lhs, R rhs, F epsilon, std::span<std::uint64_t> mask) {
+  fuzzyCmpLessMask(lhs, rhs, epsilon, mask);
+  for (std::size_t i = 0; i < fuzzyMaskSize(lhs.size()); ++i) {
+    const std::size_t kFirst = 64 * i;
+    const std::size_t kCount = std::min<std::size_t>(64, lhs.size() - kFirst);
+
+    std::uint64_t equal = 0;
+    if constexpr (std::same_as<R, F>) {
+      fuzzyCmpEqualMask(lhs.subspan(kFirst, kCount), rhs, epsilon, std::span{&equal, 1});
+    } else {
+      fuzzyCmpEqualMask(lhs.subspan(kFirst, kCount),
+                        rhs.subspan(kFirst, kCount),
+                        epsilon,
+                        std::span{&equal, 1});
+    }
+    mask[i] |= equal;
+  }
+  fuzzyComplementMask(lhs.size(), mask);
+}
+
+template <class L, class R>
+using fuzzy_range_epsilon_t =
+    common_floating_point_for_comparison_t<range_scalar_t<L>, range_scalar_t<R>>;
+
+} // namespace internal
+
+// Compare if every value of a range is zero, using a given epsilon --------------------------------
+template <contiguous_arithmetic_range R, floating_point V>
+void fuzzyIsZero(const R& values,
+                 V epsilon,
+                 std::span<std::uint64_t> mask,
+                 FuzzyCallSite site = {}) {
+  internal::fuzzyRangeMask(
+      [](auto lhs, auto /*zero*/, auto eps, auto out) { fuzzyIsZeroMask(lhs, eps, out); },
+      [site](auto lhs, auto /*zero*/, auto eps) { return fuzzyIsZero(lhs, eps, site); },
+      values,
+      std::ranges::range_value_t<R>{0},
+      epsilon,
+      mask);
+}
+
+// Compare if every value of a range is zero, using the injected epsilon ---------------------------
+template <contiguous_arithmetic_range R,
+          floating_point V = common_floating_point_for_comparison_t<range_scalar_t<R>>>
+void fuzzyIsZero(const R& values, std::span<std::uint64_t> mask, FuzzyCallSite site = {})
+  requires(has_epsilon_v<V>)
+{
+  fuzzyIsZero(values, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is equal to another value, using a given epsilon --------------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpEqual(const R& lhs,
+                   const U& rhs,
+                   V epsilon,
+                   std::span<std::uint64_t> mask,
+                   FuzzyCallSite site = {}) {
+  internal::fuzzyRangeMask([](auto... args) { fuzzyCmpEqualMask(args...); },
+                           [site](auto... args) { return fuzzyCmpEqual(args..., site); },
+                           lhs,
+                           rhs,
+                           epsilon,
+                           mask);
+}
+
+// Compare if every value of a range is equal to another value, using the injected epsilon ---------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpEqual(const R& lhs,
+                   const U& rhs,
+                   std::span<std::uint64_t> mask,
+                   FuzzyCallSite site = {}) {
+  fuzzyCmpEqual(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is not equal to another value, using a given epsilon ----------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpNotEqual(const R& lhs,
+                      const U& rhs,
+                      V epsilon,
+                      std::span<std::uint64_t> mask,
+                      FuzzyCallSite site = {}) {
+  fuzzyCmpEqual(lhs, rhs, epsilon, mask, site);
+  internal::fuzzyComplementMask(std::ranges::size(lhs), mask);
+}
+
+// Compare if every value of a range is not equal to another value, using the injected epsilon -----
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpNotEqual(const R& lhs,
+                      const U& rhs,
+                      std::span<std::uint64_t> mask,
+                      FuzzyCallSite site = {}) {
+  fuzzyCmpNotEqual(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is less than another value, using a given epsilon -------------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpLess(const R& lhs,
+                  const U& rhs,
+                  V epsilon,
+                  std::span<std::uint64_t> mask,
+                  FuzzyCallSite site = {}) {
+  internal::fuzzyRangeMask([](auto... args) { fuzzyCmpLessMask(args...); },
+                           [site](auto... args) { return fuzzyCmpLess(args..., site); },
+                           lhs,
+                           rhs,
+                           epsilon,
+                           mask);
+}
+
+// Compare if every value of a range is less than another value, using the injected epsilon --------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpLess(const R& lhs,
+                  const U& rhs,
+                  std::span<std::uint64_t> mask,
+                  FuzzyCallSite site = {}) {
+  fuzzyCmpLess(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is greater than another value, using a given epsilon ----------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpGreater(const R& lhs,
+                     const U& rhs,
+                     V epsilon,
+                     std::span<std::uint64_t> mask,
+                     FuzzyCallSite site = {}) {
+  internal::fuzzyRangeMask([](auto... args) { internal::fuzzyCmpGreaterMask(args...); },
+                           [site](auto... args) { return fuzzyCmpGreater(args..., site); },
+                           lhs,
+                           rhs,
+                           epsilon,
+                           mask);
+}
+
+// Compare if every value of a range is greater than another value, using the injected epsilon -----
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpGreater(const R& lhs,
+                     const U& rhs,
+                     std::span<std::uint64_t> mask,
+                     FuzzyCallSite site = {}) {
+  fuzzyCmpGreater(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is less or equal to another, using a given epsilon ------------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpLessEqual(const R& lhs,
+                       const U& rhs,
+                       V epsilon,
+                       std::span<std::uint64_t> mask,
+                       FuzzyCallSite site = {}) {
+  fuzzyCmpGreater(lhs, rhs, epsilon, mask, site);
+  internal::fuzzyComplementMask(std::ranges::size(lhs), mask);
+}
+
+// Compare if every value of a range is less or equal to another, using the injected epsilon -------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpLessEqual(const R& lhs,
+                       const U& rhs,
+                       std::span<std::uint64_t> mask,
+                       FuzzyCallSite site = {}) {
+  fuzzyCmpLessEqual(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
+// Compare if every value of a range is greater or equal to another, using a given epsilon ---------
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires(contiguous_arithmetic_range<U> or arithmetic<U>)
+void fuzzyCmpGreaterEqual(const R& lhs,
+                          const U& rhs,
+                          V epsilon,
+                          std::span<std::uint64_t> mask,
+                          FuzzyCallSite site = {}) {
+  fuzzyCmpLess(lhs, rhs, epsilon, mask, site);
+  internal::fuzzyComplementMask(std::ranges::size(lhs), mask);
+}
+
+// Compare if every value of a range is greater or equal to another, using the injected epsilon ----
+template <contiguous_arithmetic_range R,
+          class U,
+          floating_point V = internal::fuzzy_range_epsilon_t<R, U>>
+  requires((contiguous_arithmetic_range<U> or arithmetic<U>) and has_epsilon_v<V>)
+void fuzzyCmpGreaterEqual(const R& lhs,
+                          const U& rhs,
+                          std::span<std::uint64_t> mask,
+                          FuzzyCallSite site = {}) {
+  fuzzyCmpGreaterEqual(lhs, rhs, epsilon_v<V>, mask, site);
+}
+
 } // namespace robocin
 
 #endif // ROBOCIN_UTILITY_FUZZY_COMPARE_H
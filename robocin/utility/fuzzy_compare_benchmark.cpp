@@ -0,0 +1,376 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_compare.h"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumValues = 1'024;
+
+template <class T>
+using FloatingPoint = common_floating_point_for_comparison_t<T>;
+
+// values in [-max, max]; integer values are drawn from [-3, 3], so that they are often equal.
+template <class T>
+std::vector<T> randomInputs(FloatingPoint<T> max, unsigned seed = 42) {
+  using F = FloatingPoint<T>;
+
+  std::vector<T> result(kNumValues);
+  std::ranges::transform(randomValues<F>(-max, max, kNumValues, seed),
+                         result.begin(),
+                         [max](F value) {
+                           return static_cast<T>(std::floating_point<T> ? value : 3 * value / max);
+                         });
+  return result;
+}
+
+// pairs in which roughly half of the right-hand side values are within epsilon of the left-hand
+// side ones, so that the comparisons are not trivially predictable.
+template <class T>
+std::pair<std::vector<T>, std::vector<T>> randomPairs() {
+  using F = FloatingPoint<T>;
+
+  static constexpr F kEpsilon = epsilon_v<F>;
+
+  std::vector<T> lhs = randomInputs<T>(100);
+  std::vector<T> rhs = randomInputs<T>(2 * kEpsilon, /*seed=*/7);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    rhs[i] = std::floating_point<T> ? lhs[i] + rhs[i] : rhs[i];
+  }
+  return {std::move(lhs), std::move(rhs)};
+}
+
+template <class T, class Function>
+void benchmarkBinary(benchmark::State& state, Function function) {
+  const auto [kLhs, kRhs] = randomPairs<T>();
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      benchmark::DoNotOptimize(function(kLhs[i], kRhs[i]));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLhs.size()));
+}
+
+// fuzzyIsZero -------------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyIsZero(benchmark::State& state) {
+  using F = FloatingPoint<T>;
+
+  const std::vector<T> kValues = randomInputs<T>(2 * epsilon_v<F>);
+
+  for (auto _ : state) {
+    for (const T kValue : kValues) {
+      benchmark::DoNotOptimize(fuzzyIsZero<T, F>(kValue));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kValues.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyIsZero, float);
+BENCHMARK_TEMPLATE(BM_FuzzyIsZero, double);
+BENCHMARK_TEMPLATE(BM_FuzzyIsZero, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyIsZero, int);
+
+// fuzzyCmpEqual -----------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpEqual(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpEqual(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqual, int);
+
+// Comparison policies -----------------------------------------------------------------------------
+template <class T, class Policy>
+void BM_FuzzyCmpEqualGivenPolicy(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpEqual<Policy>(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, float, RelativeComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, double, RelativeComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, float, AbsoluteOrRelativeComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, double, AbsoluteOrRelativeComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, float, UlpComparison);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualGivenPolicy, double, UlpComparison);
+
+// fuzzyCmpNotEqual --------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpNotEqual(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpNotEqual(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpNotEqual, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpNotEqual, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpNotEqual, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpNotEqual, int);
+
+// fuzzyCmpThreeWay --------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpThreeWay(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpThreeWay(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpThreeWay, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpThreeWay, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpThreeWay, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpThreeWay, int);
+
+// fuzzyCmpLess ------------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpLess(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpLess(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLess, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLess, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLess, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLess, int);
+
+// fuzzyCmpLessEqual -------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpLessEqual(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpLessEqual(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessEqual, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessEqual, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessEqual, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessEqual, int);
+
+// fuzzyCmpGreater ---------------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpGreater(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpGreater(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreater, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreater, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreater, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreater, int);
+
+// fuzzyCmpGreaterEqual ----------------------------------------------------------------------------
+template <class T>
+void BM_FuzzyCmpGreaterEqual(benchmark::State& state) {
+  benchmarkBinary<T>(state, [](T lhs, T rhs) { return fuzzyCmpGreaterEqual(lhs, rhs); });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreaterEqual, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreaterEqual, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreaterEqual, long double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpGreaterEqual, int);
+
+// Functors ----------------------------------------------------------------------------------------
+// values are spread over a grid whose step is greater than epsilon, so that 'FuzzyLess' behaves as
+// a strict weak ordering and can be safely used with 'std::sort'.
+template <class F, class Compare>
+void benchmarkSort(benchmark::State& state, Compare compare) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+
+  std::vector<F> values(kSize);
+  for (std::size_t i = 0; i < kSize; ++i) {
+    values[i] = static_cast<F>(i) * 4 * epsilon_v<F>;
+  }
+  std::shuffle(values.begin(), values.end(), std::mt19937{42}); // NOLINT(cert-msc*-cpp)
+
+  std::vector<F> sorted(kSize);
+  for (auto _ : state) {
+    std::copy(values.begin(), values.end(), sorted.begin());
+    std::sort(sorted.begin(), sorted.end(), compare);
+    benchmark::DoNotOptimize(sorted.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSize));
+}
+
+template <class F>
+void BM_SortWithStdLess(benchmark::State& state) {
+  benchmarkSort<F>(state, std::less<F>{});
+}
+
+BENCHMARK_TEMPLATE(BM_SortWithStdLess, float)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithStdLess, double)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithStdLess, long double)->Arg(64)->Arg(4'096);
+
+template <class F>
+void BM_SortWithFuzzyLess(benchmark::State& state) {
+  benchmarkSort<F>(state, FuzzyLess<F>{});
+}
+
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyLess, float)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyLess, double)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyLess, long double)->Arg(64)->Arg(4'096);
+
+template <class F>
+void BM_SortWithFuzzyGreater(benchmark::State& state) {
+  benchmarkSort<F>(state, FuzzyGreater<F>{});
+}
+
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyGreater, float)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyGreater, double)->Arg(64)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SortWithFuzzyGreater, long double)->Arg(64)->Arg(4'096);
+
+// the searched value is absent, so that the whole range is scanned.
+template <class F, class Predicate>
+void benchmarkFindIf(benchmark::State& state, Predicate predicate) {
+  const std::vector<F> kValues = randomInputs<F>(100);
+  const std::vector<F> kNonZeroValues = [&] {
+    std::vector<F> result = kValues;
+    for (F& value : result) {
+      value = value < 0 ? value - 1 : value + 1;
+    }
+    return result;
+  }();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::find_if(kNonZeroValues.begin(), kNonZeroValues.end(), predicate));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNonZeroValues.size()));
+}
+
+template <class F>
+void BM_FindIfWithFuzzyIsZero(benchmark::State& state) {
+  benchmarkFindIf<F>(state, FuzzyIsZero<F>{});
+}
+
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyIsZero, float);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyIsZero, double);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyIsZero, long double);
+
+template <class F>
+void BM_FindIfWithFuzzyEqualTo(benchmark::State& state) {
+  benchmarkFindIf<F>(state, [equalTo = FuzzyEqualTo<F>{}](F value) { return equalTo(value, 0); });
+}
+
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyEqualTo, float);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyEqualTo, double);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyEqualTo, long double);
+
+template <class F>
+void BM_FindIfWithFuzzyNotEqualTo(benchmark::State& state) {
+  benchmarkFindIf<F>(state, [notEqualTo = FuzzyNotEqualTo<F>{}](F value) {
+    return not notEqualTo(value, 0);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyNotEqualTo, float);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyNotEqualTo, double);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyNotEqualTo, long double);
+
+template <class F>
+void BM_FindIfWithFuzzyThreeWay(benchmark::State& state) {
+  benchmarkFindIf<F>(state, [threeWay = FuzzyThreeWay<F>{}](F value) {
+    return std::is_eq(threeWay(value, 0));
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyThreeWay, float);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyThreeWay, double);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyThreeWay, long double);
+
+template <class F>
+void BM_FindIfWithFuzzyLessEqualAndGreaterEqual(benchmark::State& state) {
+  const FuzzyLessEqual<F> kLessEqual;
+  const FuzzyGreaterEqual<F> kGreaterEqual;
+
+  benchmarkFindIf<F>(state, [&](F value) {
+    return kLessEqual(value, 0) and kGreaterEqual(value, 0);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyLessEqualAndGreaterEqual, float);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyLessEqualAndGreaterEqual, double);
+BENCHMARK_TEMPLATE(BM_FindIfWithFuzzyLessEqualAndGreaterEqual, long double);
+
+// Batch overloads ---------------------------------------------------------------------------------
+// Compared to the scalar loops above, on the same values.
+
+template <class F>
+void BM_FuzzyIsZeroMask(benchmark::State& state) {
+  const std::vector<F> kValues = randomInputs<F>(2 * epsilon_v<F>);
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kValues.size()));
+
+  for (auto _ : state) {
+    fuzzyIsZeroMask(kValues, mask);
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kValues.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyIsZeroMask, float);
+BENCHMARK_TEMPLATE(BM_FuzzyIsZeroMask, double);
+BENCHMARK_TEMPLATE(BM_FuzzyIsZeroMask, long double);
+
+template <class F, class Function>
+void benchmarkBinaryMask(benchmark::State& state, Function function) {
+  const auto [kLhs, kRhs] = randomPairs<F>();
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kLhs.size()));
+
+  for (auto _ : state) {
+    function(kLhs, kRhs, mask);
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLhs.size()));
+}
+
+template <class F>
+void BM_FuzzyCmpEqualMask(benchmark::State& state) {
+  benchmarkBinaryMask<F>(state, [](const auto& lhs, const auto& rhs, auto& mask) {
+    fuzzyCmpEqualMask(lhs, std::span<const F>{rhs}, mask);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualMask, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualMask, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpEqualMask, long double);
+
+template <class F>
+void BM_FuzzyCmpLessMask(benchmark::State& state) {
+  benchmarkBinaryMask<F>(state, [](const auto& lhs, const auto& rhs, auto& mask) {
+    fuzzyCmpLessMask(lhs, std::span<const F>{rhs}, mask);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessMask, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessMask, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCmpLessMask, long double);
+
+template <class F>
+void BM_FuzzyCount(benchmark::State& state) {
+  const std::vector<F> kValues = randomInputs<F>(2 * epsilon_v<F>);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(fuzzyCount(kValues, F{0}));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kValues.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyCount, float);
+BENCHMARK_TEMPLATE(BM_FuzzyCount, double);
+BENCHMARK_TEMPLATE(BM_FuzzyCount, long double);
+
+} // namespace
+} // namespace robocin
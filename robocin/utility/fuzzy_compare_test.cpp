@@ -5,8 +5,18 @@
 
 #include "robocin/utility/fuzzy_compare.h"
 
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "robocin/utility/cpu_dispatch.h"
 #include "robocin/utility/internal/test/epsilon_injector.h"
 
 namespace robocin {
@@ -21,6 +31,37 @@ template <class>
 class FloatingPointTest : public Test {};
 TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
 
+// an odd size, so that the scalar tail of the vectorized kernels is also exercised.
+constexpr std::size_t kBatchSize = 1'003;
+
+// Random multiples of 'epsilon', mixed with values on the epsilon boundaries, NaNs and infinities.
+template <class T>
+std::vector<T> epsilonBoundaryValues(T epsilon, std::size_t size = kBatchSize) {
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{-4 * epsilon, 4 * epsilon};
+
+  const std::vector<T> kSpecialValues{
+      0,
+      epsilon,
+      -epsilon,
+      2 * epsilon,
+      std::numeric_limits<T>::quiet_NaN(),
+      std::numeric_limits<T>::infinity(),
+      -std::numeric_limits<T>::infinity(),
+  };
+
+  std::vector<T> result(size);
+  for (T& value : result) {
+    const std::size_t kIndex = generator() % (2 * kSpecialValues.size());
+    value = kIndex < kSpecialValues.size() ? kSpecialValues[kIndex] : distribution(generator);
+  }
+  return result;
+}
+
+bool maskBit(const std::vector<std::uint64_t>& mask, std::size_t index) {
+  return ((mask[index / 64] >> (index % 64)) & 1) != 0;
+}
+
 // fuzzyIsZero -------------------------------------------------------------------------------------
 TYPED_TEST(FloatingPointTest, FuzzyIsZeroGivenZeroValues) {
   using T = TypeParam;
@@ -732,5 +773,444 @@ TYPED_TEST(FloatingPointTest, FuzzyGreaterEqualFunctorGivenZeros) {
   EXPECT_TRUE(kDefaultGreaterEqual(-0, -0));
 }
 
+// Comparison policies -----------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, AbsoluteComparisonIsTheDefaultPolicy) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  static_assert(std::same_as<typename FuzzyEqualTo<T>::policy_type, AbsoluteComparison>);
+
+  for (const T kLhs : {T{0}, kEpsilon / 2, -kEpsilon, T{1}, T{1'000'000}}) {
+    for (const T kRhs : {T{0}, kEpsilon, T{1} + kEpsilon / 2, T{1'000'001}}) {
+      EXPECT_EQ(fuzzyCmpEqual<AbsoluteComparison>(kLhs, kRhs, kEpsilon),
+                fuzzyCmpEqual(kLhs, kRhs, kEpsilon));
+      EXPECT_EQ(fuzzyCmpEqual<AbsoluteComparison>(kLhs, kRhs), fuzzyCmpEqual(kLhs, kRhs));
+      EXPECT_EQ(fuzzyCmpThreeWay<AbsoluteComparison>(kLhs, kRhs), fuzzyCmpThreeWay(kLhs, kRhs));
+    }
+    EXPECT_EQ(fuzzyIsZero<AbsoluteComparison>(kLhs), fuzzyIsZero(kLhs));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, RelativeComparisonScalesWithTheMagnitude) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kLarge = 1'000;
+
+  EXPECT_TRUE(fuzzyCmpEqual<RelativeComparison>(kLarge, kLarge * (1 + kEpsilon / 2), kEpsilon));
+  EXPECT_TRUE(fuzzyCmpEqual<RelativeComparison>(-kLarge, -kLarge * (1 + kEpsilon / 2)));
+  EXPECT_FALSE(fuzzyCmpEqual<RelativeComparison>(kLarge, kLarge * (1 + 2 * kEpsilon)));
+
+  // only zero is equal to zero.
+  EXPECT_TRUE(fuzzyIsZero<RelativeComparison>(T{0}));
+  EXPECT_FALSE(fuzzyIsZero<RelativeComparison>(kEpsilon / 2));
+  EXPECT_FALSE(fuzzyCmpEqual<RelativeComparison>(kEpsilon / 2, -kEpsilon / 2));
+
+  EXPECT_TRUE(fuzzyCmpLess<RelativeComparison>(kLarge, kLarge * (1 + 2 * kEpsilon)));
+  EXPECT_FALSE(fuzzyCmpLess<RelativeComparison>(kLarge, kLarge * (1 + kEpsilon / 2)));
+  EXPECT_TRUE(fuzzyCmpGreaterEqual<RelativeComparison>(kLarge, kLarge * (1 + kEpsilon / 2)));
+}
+
+TYPED_TEST(FloatingPointTest, AbsoluteOrRelativeComparisonGivenSmallAndLargeValues) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kLarge = 1'000;
+
+  // absolute, up to 1.
+  EXPECT_TRUE(fuzzyIsZero<AbsoluteOrRelativeComparison>(kEpsilon / 2));
+  EXPECT_TRUE(fuzzyCmpEqual<AbsoluteOrRelativeComparison>(kEpsilon / 2, -kEpsilon / 2));
+  EXPECT_FALSE(fuzzyCmpEqual<AbsoluteOrRelativeComparison>(T{0}, 2 * kEpsilon));
+
+  // relative, beyond 1.
+  static constexpr T kHalfEpsilonAway = kLarge * (1 + kEpsilon / 2);
+  static constexpr T kTwoEpsilonAway = kLarge * (1 + 2 * kEpsilon);
+
+  EXPECT_TRUE(fuzzyCmpEqual<AbsoluteOrRelativeComparison>(kLarge, kHalfEpsilonAway));
+  EXPECT_FALSE(fuzzyCmpEqual<AbsoluteOrRelativeComparison>(kLarge, kTwoEpsilonAway));
+  EXPECT_TRUE(fuzzyCmpNotEqual<AbsoluteOrRelativeComparison>(kLarge, kTwoEpsilonAway));
+}
+
+TYPED_TEST(FloatingPointTest, UlpComparisonGivenAdjacentValues) {
+  using T = TypeParam;
+
+  if constexpr (internal::ulp_comparable<T>) {
+    static constexpr T kInfinity = std::numeric_limits<T>::infinity();
+    static constexpr T kNaN = std::numeric_limits<T>::quiet_NaN();
+
+    for (const T kValue : {T{1}, T{-1}, T{1'000'000}, std::numeric_limits<T>::min()}) {
+      T four_ulps_away = kValue;
+      for (int i = 0; i < 4; ++i) {
+        four_ulps_away = std::nextafter(four_ulps_away, kInfinity);
+      }
+      EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(kValue, four_ulps_away));
+      EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(four_ulps_away, kValue, T{4}));
+      EXPECT_FALSE(fuzzyCmpEqual<UlpComparison>(kValue, four_ulps_away, T{3}));
+      EXPECT_TRUE(fuzzyCmpLess<UlpComparison>(kValue, four_ulps_away, T{3}));
+    }
+
+    // both zeros are the same value, and the smallest subnormals are one ulp away from them.
+    EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(T{0}, -T{0}, T{0}));
+    EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(std::numeric_limits<T>::denorm_min(),
+                                             -std::numeric_limits<T>::denorm_min(),
+                                             T{2}));
+    EXPECT_FALSE(fuzzyIsZero<UlpComparison>(T{1e-30}));
+
+    EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(kInfinity, kInfinity));
+    EXPECT_TRUE(fuzzyCmpEqual<UlpComparison>(kInfinity, std::numeric_limits<T>::max(), T{1}));
+    EXPECT_FALSE(fuzzyCmpEqual<UlpComparison>(kInfinity, -kInfinity));
+    EXPECT_FALSE(fuzzyCmpEqual<UlpComparison>(kNaN, kNaN));
+    EXPECT_FALSE(fuzzyCmpEqual<UlpComparison>(kNaN, T{1}));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FunctorsGivenPolicies) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+  static constexpr T kLarge = 1'000;
+
+  const FuzzyEqualTo<T, RelativeComparison> kEqualTo;
+  const FuzzyLess<T, RelativeComparison> kLess(kEpsilon);
+  const FuzzyIsZero<T, AbsoluteOrRelativeComparison> kIsZero;
+
+  EXPECT_TRUE(kEqualTo(kLarge, kLarge * (1 + kEpsilon / 2)));
+  EXPECT_FALSE(kLess(kLarge, kLarge * (1 + kEpsilon / 2)));
+  EXPECT_TRUE(kLess(kLarge, kLarge * (1 + 2 * kEpsilon)));
+  EXPECT_TRUE(kIsZero(kEpsilon / 2));
+
+  if constexpr (internal::ulp_comparable<T>) {
+    const FuzzyEqualTo<T, UlpComparison> kUlpEqualTo;
+    EXPECT_TRUE(kUlpEqualTo(T{1}, std::nextafter(T{1}, T{2})));
+    EXPECT_FALSE(kUlpEqualTo(T{1}, T{1} + kEpsilon));
+  }
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+TYPED_TEST(FloatingPointTest, FuzzyIsZeroMaskMatchesTheScalarFunction) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kValues = epsilonBoundaryValues<T>(kEpsilon);
+
+  // the unused bits of the last word must be cleared.
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kValues.size()), ~std::uint64_t{0});
+  fuzzyIsZeroMask(std::span<const T>{kValues}, kEpsilon, mask);
+
+  std::vector<std::uint64_t> injected(fuzzyMaskSize(kValues.size()));
+  fuzzyIsZeroMask(kValues, injected);
+
+  for (std::size_t i = 0; i < kValues.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), (fuzzyIsZero<T, T>(kValues[i], kEpsilon))) << kValues[i];
+  }
+  EXPECT_EQ(mask.back() >> (kValues.size() % 64), 0);
+  EXPECT_EQ(injected, mask);
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyCmpEqualMaskMatchesTheScalarFunction) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kLhs = epsilonBoundaryValues<T>(kEpsilon);
+  const std::vector<T> kRhs = epsilonBoundaryValues<T>(kEpsilon, kBatchSize + 1);
+
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+  fuzzyCmpEqualMask(std::span<const T>{kLhs}, std::span<const T>{kRhs}.first(kLhs.size()),
+                    kEpsilon, mask);
+
+  std::vector<std::uint64_t> zeroMask(fuzzyMaskSize(kLhs.size()));
+  fuzzyCmpEqualMask(std::span<const T>{kLhs}, T{0}, kEpsilon, zeroMask);
+
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), (fuzzyCmpEqual<T, T, T>(kLhs[i], kRhs[i], kEpsilon)));
+    EXPECT_EQ(maskBit(zeroMask, i), (fuzzyCmpEqual<T, T, T>(kLhs[i], 0, kEpsilon)));
+  }
+  EXPECT_EQ(mask.back() >> (kLhs.size() % 64), 0);
+
+  std::vector<std::uint64_t> injected(fuzzyMaskSize(kLhs.size()));
+  fuzzyCmpEqualMask(kLhs, std::span<const T>{kRhs}.first(kLhs.size()), injected);
+  EXPECT_EQ(injected, mask);
+
+  fuzzyCmpEqualMask(kLhs, 0, injected);
+  EXPECT_EQ(injected, zeroMask);
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyCmpLessMaskMatchesTheScalarFunction) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kLhs = epsilonBoundaryValues<T>(kEpsilon);
+  const std::vector<T> kRhs = epsilonBoundaryValues<T>(kEpsilon, kBatchSize + 1);
+
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+  fuzzyCmpLessMask(std::span<const T>{kLhs}, std::span<const T>{kRhs}.first(kLhs.size()),
+                   kEpsilon, mask);
+
+  std::vector<std::uint64_t> epsilonMask(fuzzyMaskSize(kLhs.size()));
+  fuzzyCmpLessMask(std::span<const T>{kLhs}, kEpsilon, kEpsilon, epsilonMask);
+
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), (fuzzyCmpLess<T, T, T>(kLhs[i], kRhs[i], kEpsilon)));
+    EXPECT_EQ(maskBit(epsilonMask, i), (fuzzyCmpLess<T, T, T>(kLhs[i], kEpsilon, kEpsilon)));
+  }
+  EXPECT_EQ(mask.back() >> (kLhs.size() % 64), 0);
+
+  std::vector<std::uint64_t> injected(fuzzyMaskSize(kLhs.size()));
+  fuzzyCmpLessMask(kLhs, std::span<const T>{kRhs}.first(kLhs.size()), injected);
+  EXPECT_EQ(injected, mask);
+
+  fuzzyCmpLessMask(kLhs, kEpsilon, injected);
+  EXPECT_EQ(injected, epsilonMask);
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyCountMatchesTheScalarFunction) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kValues = epsilonBoundaryValues<T>(kEpsilon);
+
+  for (const T kValue : {T{0}, kEpsilon, 3 * kEpsilon, std::numeric_limits<T>::infinity()}) {
+    std::size_t expected = 0;
+    for (const T kElement : kValues) {
+      expected += fuzzyCmpEqual<T, T, T>(kElement, kValue, kEpsilon) ? 1 : 0;
+    }
+    EXPECT_EQ(fuzzyCount(std::span<const T>{kValues}, kValue, kEpsilon), expected);
+    EXPECT_EQ(fuzzyCount(kValues, kValue), expected);
+  }
+  EXPECT_EQ(fuzzyCount(std::span<const T>{}, T{0}, kEpsilon), 0);
+
+  // the value is converted to the value type of the range, as 'fuzzyCmpLessMask' converts it.
+  const std::vector<T> kZeros{0, kEpsilon / 2, 1, -kEpsilon / 2};
+  EXPECT_EQ(fuzzyCount(kZeros, 0), 3);
+  EXPECT_EQ(fuzzyCount(kZeros, 0.0), 3);
+}
+
+TYPED_TEST(FloatingPointTest, BatchOverloadsOfEverySupportedSimdIsaMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kLhs = epsilonBoundaryValues<T>(kEpsilon);
+  const std::vector<T> kRhs = epsilonBoundaryValues<T>(kEpsilon, kBatchSize + 1);
+  const std::span<const T> kRhsSpan = std::span<const T>{kRhs}.first(kLhs.size());
+
+  for (const SimdIsa kIsa : kSimdIsas) {
+    if (not isSimdIsaSupported(kIsa)) {
+      continue;
+    }
+    const ScopedSimdIsa kScope{kIsa};
+
+    std::vector<std::uint64_t> isZero(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+    fuzzyIsZeroMask(std::span<const T>{kLhs}, kEpsilon, isZero);
+    std::vector<std::uint64_t> equal(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+    fuzzyCmpEqualMask(std::span<const T>{kLhs}, kRhsSpan, kEpsilon, equal);
+    std::vector<std::uint64_t> equalToEpsilon(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+    fuzzyCmpEqualMask(std::span<const T>{kLhs}, kEpsilon, kEpsilon, equalToEpsilon);
+    std::vector<std::uint64_t> less(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+    fuzzyCmpLessMask(std::span<const T>{kLhs}, kRhsSpan, kEpsilon, less);
+    std::vector<std::uint64_t> lessThanEpsilon(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+    fuzzyCmpLessMask(std::span<const T>{kLhs}, kEpsilon, kEpsilon, lessThanEpsilon);
+
+    std::size_t equalToZero = 0;
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      ASSERT_EQ(maskBit(isZero, i), (fuzzyIsZero<T, T>(kLhs[i], kEpsilon))) << simdIsaName(kIsa);
+      ASSERT_EQ(maskBit(equal, i), (fuzzyCmpEqual<T, T, T>(kLhs[i], kRhs[i], kEpsilon)))
+          << simdIsaName(kIsa);
+      ASSERT_EQ(maskBit(equalToEpsilon, i), (fuzzyCmpEqual<T, T, T>(kLhs[i], kEpsilon, kEpsilon)))
+          << simdIsaName(kIsa);
+      ASSERT_EQ(maskBit(less, i), (fuzzyCmpLess<T, T, T>(kLhs[i], kRhs[i], kEpsilon)))
+          << simdIsaName(kIsa);
+      ASSERT_EQ(maskBit(lessThanEpsilon, i), (fuzzyCmpLess<T, T, T>(kLhs[i], kEpsilon, kEpsilon)))
+          << simdIsaName(kIsa);
+      equalToZero += fuzzyCmpEqual<T, T, T>(kLhs[i], 0, kEpsilon) ? 1 : 0;
+    }
+    EXPECT_EQ(isZero.back() >> (kLhs.size() % 64), 0) << simdIsaName(kIsa);
+    EXPECT_EQ(fuzzyCount(std::span<const T>{kLhs}, T{0}, kEpsilon), equalToZero)
+        << simdIsaName(kIsa);
+  }
+}
+
+// Range overloads ---------------------------------------------------------------------------------
+static_assert(contiguous_arithmetic_range<std::vector<int>>);
+static_assert(contiguous_floating_point_range<std::span<const float>>);
+static_assert(not contiguous_floating_point_range<std::vector<int>>);
+static_assert(output_contiguous_arithmetic_range<std::vector<double>&>);
+static_assert(not output_contiguous_arithmetic_range<const std::vector<double>&>);
+
+static_assert(std::same_as<range_scalar_t<const std::vector<float>&>, float>);
+static_assert(std::same_as<range_scalar_t<double>, double>);
+
+static_assert(simd_lanes_v<long double> == 1 and simd_lanes_v<int> == 1);
+static_assert(simd_lanes_v<float> == 2 * simd_lanes_v<double> or simd_lanes_v<float> == 1);
+
+TYPED_TEST(FloatingPointTest, RangeOverloadsMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kLhs = epsilonBoundaryValues<T>(kEpsilon);
+  const std::vector<T> kRhs = epsilonBoundaryValues<T>(kEpsilon, kBatchSize + 1);
+  const std::span<const T> kRhsSpan = std::span<const T>{kRhs}.first(kLhs.size());
+
+  // the unused bits of the last word must be cleared.
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+  std::vector<std::uint64_t> scalarMask(fuzzyMaskSize(kLhs.size()), ~std::uint64_t{0});
+
+  const auto kExpectMasks = [&](auto scalar) {
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      EXPECT_EQ(maskBit(mask, i), scalar(kLhs[i], kRhs[i])) << kLhs[i] << " " << kRhs[i];
+      EXPECT_EQ(maskBit(scalarMask, i), scalar(kLhs[i], kEpsilon)) << kLhs[i];
+    }
+    EXPECT_EQ(mask.back() >> (kLhs.size() % 64), 0);
+    EXPECT_EQ(scalarMask.back() >> (kLhs.size() % 64), 0);
+  };
+
+  fuzzyIsZero(kLhs, mask);
+  fuzzyIsZero(kLhs, kEpsilon, scalarMask);
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), fuzzyIsZero(kLhs[i]));
+  }
+  EXPECT_EQ(scalarMask, mask);
+
+  fuzzyCmpEqual(kLhs, kRhsSpan, mask);
+  fuzzyCmpEqual(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpEqual(lhs, rhs); });
+
+  fuzzyCmpNotEqual(kLhs, kRhsSpan, mask);
+  fuzzyCmpNotEqual(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpNotEqual(lhs, rhs); });
+
+  fuzzyCmpLess(kLhs, kRhsSpan, mask);
+  fuzzyCmpLess(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpLess(lhs, rhs); });
+
+  fuzzyCmpLessEqual(kLhs, kRhsSpan, mask);
+  fuzzyCmpLessEqual(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpLessEqual(lhs, rhs); });
+
+  fuzzyCmpGreater(kLhs, kRhsSpan, mask);
+  fuzzyCmpGreater(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpGreater(lhs, rhs); });
+
+  fuzzyCmpGreaterEqual(kLhs, kRhsSpan, mask);
+  fuzzyCmpGreaterEqual(kLhs, kEpsilon, kEpsilon, scalarMask);
+  kExpectMasks([](T lhs, T rhs) { return fuzzyCmpGreaterEqual(lhs, rhs); });
+}
+
+TEST(FuzzyCompareTest, RangeOverloadsGivenMixedTypesMatchTheScalarFunctions) {
+  const std::vector<float> kLhs = epsilonBoundaryValues<float>(epsilon_v<float>);
+  const std::vector<double> kRhs = epsilonBoundaryValues<double>(epsilon_v<float>);
+  const std::vector<int> kIntegers{-2, -1, 0, 1, 2};
+
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kLhs.size()));
+
+  // the epsilon type is the one of the scalar functions, i.e. float.
+  fuzzyCmpEqual(kLhs, kRhs, mask);
+  for (std::size_t i = 0; i < kLhs.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), fuzzyCmpEqual(kLhs[i], kRhs[i])) << kLhs[i] << " " << kRhs[i];
+  }
+
+  fuzzyCmpLess(kIntegers, 0.5, mask);
+  for (std::size_t i = 0; i < kIntegers.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), fuzzyCmpLess(kIntegers[i], 0.5)) << kIntegers[i];
+  }
+  EXPECT_EQ(mask.front() >> kIntegers.size(), 0);
+
+  // a double scalar and epsilon are not narrowed to float: 16777217 is not a float.
+  const std::vector<float> kLarge{16777216.F};
+  fuzzyCmpEqual(kLarge, 16777217.0, 0.5, mask);
+  EXPECT_EQ(maskBit(mask, 0), fuzzyCmpEqual(kLarge.front(), 16777217.0, 0.5));
+  fuzzyCmpEqual(kLarge, 16777216.0, 0.5, mask);
+  EXPECT_EQ(maskBit(mask, 0), fuzzyCmpEqual(kLarge.front(), 16777216.0, 0.5));
+  EXPECT_EQ(mask.front() >> 1, 0);
+}
+
+// Half precision ----------------------------------------------------------------------------------
+#if defined(ROBOCIN_HAS_FLOAT16)
+static_assert(arithmetic<float16_t> and floating_point<float16_t>);
+static_assert(contiguous_floating_point_range<std::vector<float16_t>>);
+static_assert(std::same_as<widened_floating_point_t<float16_t>, float>);
+static_assert(std::same_as<widened_floating_point_t<double>, double>);
+
+// the lowest precision type is chosen, hence its tolerance.
+static_assert(std::same_as<common_floating_point_for_comparison_t<float16_t, double>, float16_t>);
+static_assert(std::same_as<common_floating_point_for_comparison_t<int, float16_t>, float16_t>);
+static_assert(std::same_as<common_floating_point_for_comparison_t<float, float16_t>, float16_t>);
+
+TEST(FuzzyCompareTest, Float16ScalarFunctionsGivenMixedTypes) {
+  static constexpr float kEpsilon = epsilon_v<float16_t>;
+
+  EXPECT_TRUE(fuzzyIsZero(static_cast<float16_t>(kEpsilon / 2)));
+  EXPECT_FALSE(fuzzyIsZero(static_cast<float16_t>(2 * kEpsilon)));
+
+  EXPECT_TRUE(fuzzyCmpEqual(static_cast<float16_t>(1), 1.0 + kEpsilon / 2));
+  EXPECT_TRUE(fuzzyCmpLess(static_cast<float16_t>(1), 1 + 2 * kEpsilon));
+  EXPECT_FALSE(fuzzyCmpLess(1, static_cast<float16_t>(1 + kEpsilon / 2)));
+  EXPECT_TRUE(fuzzyCmpGreaterEqual(static_cast<float16_t>(2), 2));
+
+  // values beyond the range of float16_t are widened, rather than narrowed, to be compared.
+  EXPECT_TRUE(fuzzyCmpLess(static_cast<float16_t>(60'000), 1e6));
+  EXPECT_TRUE(FuzzyLess<float16_t>{}(static_cast<float16_t>(-1), static_cast<float16_t>(1)));
+}
+
+TEST(FuzzyCompareTest, Float16RangeOverloadsMatchTheScalarFunctions) {
+  static constexpr float16_t kEpsilon = epsilon_v<float16_t>;
+
+  std::vector<float16_t> lhs;
+  std::vector<float16_t> rhs;
+  for (const float kValue : epsilonBoundaryValues<float>(kEpsilon)) {
+    lhs.push_back(static_cast<float16_t>(kValue));
+  }
+  for (const float kValue : epsilonBoundaryValues<float>(kEpsilon, kBatchSize + 1)) {
+    rhs.push_back(static_cast<float16_t>(kValue));
+  }
+  rhs.pop_back();
+
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(lhs.size()), ~std::uint64_t{0});
+  std::vector<std::uint64_t> scalarMask(fuzzyMaskSize(lhs.size()), ~std::uint64_t{0});
+
+  const auto kExpectMasks = [&](auto scalar) {
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+      EXPECT_EQ(maskBit(mask, i), scalar(lhs[i], rhs[i])) << static_cast<float>(lhs[i]);
+      EXPECT_EQ(maskBit(scalarMask, i), scalar(lhs[i], kEpsilon)) << static_cast<float>(lhs[i]);
+    }
+    EXPECT_EQ(mask.back() >> (lhs.size() % 64), 0);
+    EXPECT_EQ(scalarMask.back() >> (lhs.size() % 64), 0);
+  };
+
+  fuzzyIsZero(lhs, mask);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(maskBit(mask, i), fuzzyIsZero(lhs[i])) << static_cast<float>(lhs[i]);
+  }
+
+  fuzzyCmpEqual(lhs, rhs, mask);
+  fuzzyCmpEqual(lhs, kEpsilon, scalarMask);
+  kExpectMasks([](float16_t lhs, float16_t rhs) { return fuzzyCmpEqual(lhs, rhs); });
+
+  fuzzyCmpLess(lhs, rhs, mask);
+  fuzzyCmpLess(lhs, kEpsilon, scalarMask);
+  kExpectMasks([](float16_t lhs, float16_t rhs) { return fuzzyCmpLess(lhs, rhs); });
+
+  fuzzyCmpGreater(lhs, rhs, mask);
+  fuzzyCmpGreater(lhs, kEpsilon, scalarMask);
+  kExpectMasks([](float16_t lhs, float16_t rhs) { return fuzzyCmpGreater(lhs, rhs); });
+
+  fuzzyCmpLessEqual(lhs, rhs, mask);
+  fuzzyCmpLessEqual(lhs, kEpsilon, scalarMask);
+  kExpectMasks([](float16_t lhs, float16_t rhs) { return fuzzyCmpLessEqual(lhs, rhs); });
+
+  std::size_t expected = 0;
+  for (const float16_t kValue : lhs) {
+    expected += fuzzyCmpEqual(kValue, kEpsilon) ? 1 : 0;
+  }
+  EXPECT_EQ(fuzzyCount(lhs, kEpsilon), expected);
+}
+#endif
+
 } // namespace
 } // namespace robocin
@@ -0,0 +1,14 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_flat_map.h"
+
+namespace robocin {
+
+template class FuzzyFlatMap<float, float>;
+template class FuzzyFlatMap<double, double>;
+template class FuzzyFlatMap<long double, long double>;
+
+} // namespace robocin
@@ -0,0 +1,260 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_FUZZY_FLAT_MAP_H
+#define ROBOCIN_UTILITY_FUZZY_FLAT_MAP_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+namespace robocin {
+
+// Immutable map from floating point keys to values (e.g. a calibration table of kick power by ball
+// speed), whose lookups compare the keys within epsilon, as 'FuzzyLess' and 'FuzzyEqualTo' do.
+//
+// Entries are identified by their rank: the i-th entry has the i-th smallest key. Besides the
+// sorted keys and values, the keys are also stored in Eytzinger (i.e. breadth-first binary tree)
+// order, in which the first levels of every search share a few cache lines, and the next ones are
+// prefetched as the search descends, so that a lookup is a branch-free loop of about log2(size)
+// iterations, whose memory accesses overlap.
+//
+// The map is built from unsorted entries. Keys that are chained within epsilon (as clustered by
+// 'fuzzySortUnique') keep only the entry with the smallest key, the first one given among the
+// equal ones. Hence, consecutive keys are more than epsilon apart. Keys must not be NaN.
+template <std::floating_point K, class V, fuzzy_comparison_policy Policy = AbsoluteComparison>
+class FuzzyFlatMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<K, V>;
+  using policy_type = Policy;
+  using size_type = std::size_t;
+
+  static constexpr size_type kNone = std::numeric_limits<size_type>::max();
+
+  FuzzyFlatMap()
+    requires(has_default_tolerance_v<Policy, key_type>)
+      : FuzzyFlatMap{Policy::template tolerance<key_type>()} {}
+
+  explicit FuzzyFlatMap(key_type epsilon) : epsilon_{epsilon}, less_{epsilon}, equal_to_{epsilon} {}
+
+  explicit FuzzyFlatMap(std::vector<value_type> entries)
+    requires(has_default_tolerance_v<Policy, key_type>)
+      : FuzzyFlatMap{std::move(entries), Policy::template tolerance<key_type>()} {}
+
+  FuzzyFlatMap(std::vector<value_type> entries, key_type epsilon) : FuzzyFlatMap{epsilon} {
+    assign(std::move(entries));
+  }
+
+  // Replaces the entries of the map by the given ones, in O(n log n).
+  void assign(std::vector<value_type> entries) {
+    std::ranges::stable_sort(entries, std::ranges::less{}, &value_type::first);
+
+    keys_.clear();
+    values_.clear();
+    keys_.reserve(entries.size());
+    values_.reserve(entries.size());
+
+    for (std::size_t first = 0, last = 0; first < entries.size(); first = last) {
+      for (last = first + 1;
+           last < entries.size() and equal_to_(entries[last - 1].first, entries[last].first);
+           ++last) {
+      }
+      keys_.push_back(entries[first].first);
+      values_.push_back(std::move(entries[first].second));
+    }
+
+    buildEytzinger();
+  }
+
+  [[nodiscard]] key_type epsilon() const { return epsilon_; }
+
+  [[nodiscard]] size_type size() const { return keys_.size(); }
+  [[nodiscard]] bool empty() const { return keys_.empty(); }
+
+  // The keys and values, sorted by key.
+  [[nodiscard]] std::span<const key_type> keys() const { return keys_; }
+  [[nodiscard]] std::span<const mapped_type> values() const { return values_; }
+
+  [[nodiscard]] key_type key(size_type rank) const { return keys_[rank]; }
+  [[nodiscard]] const mapped_type& value(size_type rank) const { return values_[rank]; }
+
+  // The rank of the first entry whose key is not fuzzy less than the given one, or 'size()' if
+  // there is none.
+  [[nodiscard]] size_type lowerBound(key_type key) const { return search(key, less_); }
+
+  // The rank of the entry whose key is fuzzy equal to the given one, if any. When two keys are
+  // equal to it, the smallest one is chosen.
+  [[nodiscard]] std::optional<size_type> find(key_type key) const {
+    const size_type kRank = lowerBound(key);
+    if (kRank < size() and equal_to_(keys_[kRank], key)) {
+      return kRank;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] bool contains(key_type key) const { return find(key).has_value(); }
+
+  // The value of the entry whose key is fuzzy equal to the given one, if any.
+  [[nodiscard]] const mapped_type* get(key_type key) const {
+    const std::optional<size_type> kRank = find(key);
+    return kRank ? &values_[*kRank] : nullptr;
+  }
+
+  // The rank of the entry whose key is the closest to the given one (the smallest, on ties), or
+  // 'std::nullopt' if the map is empty.
+  [[nodiscard]] std::optional<size_type> nearest(key_type key) const {
+    if (empty()) {
+      return std::nullopt;
+    }
+
+    const size_type kRank = search(key, std::less<key_type>{});
+    if (kRank == size()) {
+      return kRank - 1;
+    }
+    if (kRank == 0) {
+      return kRank;
+    }
+    return key - keys_[kRank - 1] <= keys_[kRank] - key ? kRank - 1 : kRank;
+  }
+
+  // Batch overloads -------------------------------------------------------------------------------
+  // The following functions search for every given key, interleaving 'kInterleavedSearches'
+  // searches at a time, so that the cache misses of independent searches overlap. 'ranks' must have
+  // the same size as 'keys'.
+
+  static constexpr size_type kInterleavedSearches = 8;
+
+  void lowerBound(std::span<const key_type> keys, std::span<size_type> ranks) const {
+    assert(keys.size() == ranks.size());
+
+    searchAll(keys, ranks, less_);
+  }
+
+  // As 'find', writing 'kNone' for the keys that are not found.
+  void find(std::span<const key_type> keys, std::span<size_type> ranks) const {
+    lowerBound(keys, ranks);
+    for (size_type i = 0; i < keys.size(); ++i) {
+      if (ranks[i] == size() or not equal_to_(keys_[ranks[i]], keys[i])) {
+        ranks[i] = kNone;
+      }
+    }
+  }
+
+ private:
+  // keys per cache line, i.e. the number of nodes of the subtree 'log2(kKeysPerCacheLine)' levels
+  // below a node, which are contiguous in the Eytzinger order.
+  static constexpr size_type kKeysPerCacheLine = std::max<size_type>(64 / sizeof(key_type), 1);
+
+  void buildEytzinger() {
+    // 1-indexed, so that the children of 'k' are '2k' and '2k + 1'.
+    eytzinger_.assign(keys_.size() + 1, key_type{0});
+    eytzinger_ranks_.assign(keys_.size() + 1, size_type{0});
+
+    size_type rank = 0;
+    buildEytzinger(rank, 1);
+  }
+
+  // In-order traversal of the implicit tree rooted at 'node'.
+  void buildEytzinger(size_type& rank, size_type node) {
+    if (node <= keys_.size()) {
+      buildEytzinger(rank, 2 * node);
+      eytzinger_[node] = keys_[rank];
+      eytzinger_ranks_[node] = rank++;
+      buildEytzinger(rank, 2 * node + 1);
+    }
+  }
+
+  // The rank of the first key 'k' for which 'less(k, key)' is false, or 'size()' if there is none.
+  template <class Less>
+  [[nodiscard]] size_type search(key_type key, const Less& less) const {
+    size_type node = 1;
+    while (node <= keys_.size()) {
+      prefetch(node);
+      node = child(node, key, less);
+    }
+    return rankOf(node);
+  }
+
+  template <class Less>
+  void searchAll(std::span<const key_type> keys,
+                 std::span<size_type> ranks,
+                 const Less& less) const {
+    // the nodes at depth 'kDepth - 1' are all in the tree, and some of those at 'kDepth' may be.
+    const int kDepth = std::bit_width(keys_.size());
+
+    // the keys searched in blocks, precomputed so that the loop bounds can't wrap around.
+    const size_type kBlocked = keys.size() - keys.size() % kInterleavedSearches;
+
+    size_type index = 0;
+    for (; index < kBlocked; index += kInterleavedSearches) {
+      std::array<size_type, kInterleavedSearches> nodes{};
+      nodes.fill(1);
+
+      for (int depth = 1; depth < kDepth; ++depth) {
+        for (size_type i = 0; i < kInterleavedSearches; ++i) {
+          prefetch(nodes[i]);
+          nodes[i] = child(nodes[i], keys[index + i], less);
+        }
+      }
+      for (size_type i = 0; i < kInterleavedSearches; ++i) {
+        if (nodes[i] <= keys_.size()) {
+          nodes[i] = child(nodes[i], keys[index + i], less);
+        }
+        ranks[index + i] = rankOf(nodes[i]);
+      }
+    }
+    for (; index < keys.size(); ++index) {
+      ranks[index] = search(keys[index], less);
+    }
+  }
+
+  template <class Less>
+  [[nodiscard]] size_type child(size_type node, key_type key, const Less& less) const {
+    return 2 * node + static_cast<size_type>(less(eytzinger_[node], key));
+  }
+
+  // The rank of the last node at which the search went left, given the node past the leaves at
+  // which it stopped: the right turns are the trailing ones of its index.
+  [[nodiscard]] size_type rankOf(size_type node) const {
+    node >>= std::countr_one(node) + 1;
+    return node == 0 ? keys_.size() : eytzinger_ranks_[node];
+  }
+
+  void prefetch([[maybe_unused]] size_type node) const {
+#if defined(__GNUC__) or defined(__clang__)
+    // the descendants of 'node' 'log2(kKeysPerCacheLine)' levels below, which are contiguous. The
+    // address may lie past the end, which is harmless for a prefetch.
+    __builtin_prefetch(eytzinger_.data() + kKeysPerCacheLine * node);
+#endif
+  }
+
+  key_type epsilon_;
+  FuzzyLess<key_type, policy_type> less_;
+  FuzzyEqualTo<key_type, policy_type> equal_to_;
+
+  std::vector<key_type> keys_;
+  std::vector<mapped_type> values_;
+
+  std::vector<key_type> eytzinger_;
+  std::vector<size_type> eytzinger_ranks_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_FUZZY_FLAT_MAP_H
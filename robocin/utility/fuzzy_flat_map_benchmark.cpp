@@ -0,0 +1,142 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_flat_map.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+constexpr std::size_t kNumKeys = 4'096;
+
+// 'size' entries whose keys are about 3 epsilon apart, in a random order.
+template <class F>
+std::vector<std::pair<F, F>> randomEntries(std::size_t size) {
+  static constexpr F kEpsilon = epsilon_v<F>;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<F> jitter{-kEpsilon / 2, kEpsilon / 2};
+
+  std::vector<std::pair<F, F>> result(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = {static_cast<F>(i) * 3 * kEpsilon + jitter(generator), static_cast<F>(i)};
+  }
+  std::ranges::shuffle(result, generator);
+  return result;
+}
+
+// keys spread over the range of the entries, about a third of them being found.
+template <class F>
+std::vector<F> randomKeys(std::size_t size) {
+  std::mt19937 generator{7}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<F> distribution{0, static_cast<F>(size) * 3 * epsilon_v<F>};
+
+  std::vector<F> result(kNumKeys);
+  for (F& key : result) {
+    key = distribution(generator);
+  }
+  return result;
+}
+
+// The lookup the flat map replaces: the first key not less than 'key - epsilon' of a 'std::map'.
+template <class F>
+void BM_StdMapFind(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const auto kEntries = randomEntries<F>(kSize);
+  const std::map<F, F> kMap{kEntries.begin(), kEntries.end()};
+  const std::vector<F> kKeys = randomKeys<F>(kSize);
+
+  for (auto _ : state) {
+    for (const F kKey : kKeys) {
+      const auto kIt = kMap.lower_bound(kKey - epsilon_v<F>);
+      benchmark::DoNotOptimize(kIt != kMap.end() and fuzzyCmpEqual(kIt->first, kKey));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kKeys.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_StdMapFind, float)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(BM_StdMapFind, double)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+// A binary search of the sorted keys.
+template <class F>
+void BM_SortedVectorFind(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const FuzzyFlatMap<F, F> kMap{randomEntries<F>(kSize)};
+  const std::vector<F> kKeys = randomKeys<F>(kSize);
+
+  for (auto _ : state) {
+    for (const F kKey : kKeys) {
+      const auto kIt = std::ranges::lower_bound(kMap.keys(), kKey, FuzzyLess<F>{});
+      benchmark::DoNotOptimize(kIt != kMap.keys().end() and fuzzyCmpEqual(*kIt, kKey));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kKeys.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_SortedVectorFind, float)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(BM_SortedVectorFind, double)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+template <class F>
+void BM_FuzzyFlatMapFind(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const FuzzyFlatMap<F, F> kMap{randomEntries<F>(kSize)};
+  const std::vector<F> kKeys = randomKeys<F>(kSize);
+
+  for (auto _ : state) {
+    for (const F kKey : kKeys) {
+      benchmark::DoNotOptimize(kMap.find(kKey));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kKeys.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyFlatMapFind, float)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(BM_FuzzyFlatMapFind, double)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+template <class F>
+void BM_FuzzyFlatMapBatchFind(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const FuzzyFlatMap<F, F> kMap{randomEntries<F>(kSize)};
+  const std::vector<F> kKeys = randomKeys<F>(kSize);
+
+  std::vector<std::size_t> ranks(kKeys.size());
+  for (auto _ : state) {
+    kMap.find(kKeys, ranks);
+    benchmark::DoNotOptimize(ranks.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kKeys.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyFlatMapBatchFind, float)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(BM_FuzzyFlatMapBatchFind, double)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+template <class F>
+void BM_FuzzyFlatMapBuild(benchmark::State& state) {
+  const auto kEntries = randomEntries<F>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    const FuzzyFlatMap<F, F> kMap{kEntries};
+    benchmark::DoNotOptimize(kMap.size());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kEntries.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FuzzyFlatMapBuild, double)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+} // namespace
+} // namespace robocin
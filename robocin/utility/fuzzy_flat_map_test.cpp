@@ -0,0 +1,193 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_flat_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// 'size' entries, in a random order, whose keys are about 3 epsilon apart and whose values are
+// their ranks.
+template <class T>
+std::vector<std::pair<T, std::size_t>> randomEntries(std::size_t size, unsigned seed = 42) {
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<T> jitter{-kEpsilon / 2, kEpsilon / 2};
+
+  std::vector<std::pair<T, std::size_t>> result(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = {static_cast<T>(i) * 3 * kEpsilon + jitter(generator), i};
+  }
+  std::ranges::shuffle(result, generator);
+  return result;
+}
+
+// keys spread over the range of the entries, and slightly beyond it.
+template <class T>
+std::vector<T> randomKeys(std::size_t size, std::size_t entries, unsigned seed = 7) {
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<T> distribution{-4 * kEpsilon,
+                                                 static_cast<T>(entries + 1) * 3 * kEpsilon};
+
+  std::vector<T> result(size);
+  for (T& key : result) {
+    key = distribution(generator);
+  }
+  return result;
+}
+
+TYPED_TEST(FloatingPointTest, EmptyMap) {
+  using T = TypeParam;
+
+  const FuzzyFlatMap<T, int> kMap;
+
+  EXPECT_TRUE(kMap.empty());
+  EXPECT_EQ(kMap.epsilon(), epsilon_v<T>);
+  EXPECT_EQ(kMap.lowerBound(T{0}), 0);
+  EXPECT_FALSE(kMap.find(T{0}).has_value());
+  EXPECT_FALSE(kMap.nearest(T{0}).has_value());
+  EXPECT_EQ(kMap.get(T{0}), nullptr);
+}
+
+TYPED_TEST(FloatingPointTest, FindGivenUnsortedEntries) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const FuzzyFlatMap<T, std::string> kMap{{
+      {3, "three"},
+      {1, "one"},
+      {2, "two"},
+  }};
+
+  ASSERT_EQ(kMap.size(), 3);
+  EXPECT_EQ(kMap.keys()[0], 1);
+  EXPECT_EQ(kMap.values()[2], "three");
+
+  EXPECT_EQ(kMap.find(2 + kEpsilon / 2), 1);
+  EXPECT_EQ(kMap.find(1 - kEpsilon * 3 / 4), 0);
+  EXPECT_FALSE(kMap.find(2 + 2 * kEpsilon).has_value());
+  EXPECT_TRUE(kMap.contains(3 - kEpsilon / 2));
+
+  ASSERT_NE(kMap.get(2 - kEpsilon / 2), nullptr);
+  EXPECT_EQ(*kMap.get(2 - kEpsilon / 2), "two");
+}
+
+TYPED_TEST(FloatingPointTest, BuildKeepsTheFirstEntryOfEachCluster) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // 1, 1 + 3/4 epsilon and 1 + 3/2 epsilon are chained.
+  const FuzzyFlatMap<T, int> kMap{{
+      {1 + kEpsilon * 3 / 4, 0},
+      {1, 1},
+      {5, 2},
+      {1, 3},
+      {1 + kEpsilon * 3 / 2, 4},
+  }};
+
+  ASSERT_EQ(kMap.size(), 2);
+  EXPECT_EQ(kMap.key(0), 1);
+  EXPECT_EQ(kMap.value(0), 1);
+  EXPECT_EQ(kMap.key(1), 5);
+}
+
+TYPED_TEST(FloatingPointTest, LowerBoundAndNearest) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const FuzzyFlatMap<T, int> kMap{{{0, 0}, {1, 1}, {2, 2}}};
+
+  EXPECT_EQ(kMap.lowerBound(-1), 0);
+  EXPECT_EQ(kMap.lowerBound(1 + kEpsilon / 2), 1);
+  EXPECT_EQ(kMap.lowerBound(1 + 2 * kEpsilon), 2);
+  EXPECT_EQ(kMap.lowerBound(2 + 2 * kEpsilon), 3);
+
+  EXPECT_EQ(kMap.nearest(-10), 0);
+  EXPECT_EQ(kMap.nearest(T{0.4}), 0);
+  EXPECT_EQ(kMap.nearest(T{0.5}), 0);
+  EXPECT_EQ(kMap.nearest(T{1.6}), 2);
+  EXPECT_EQ(kMap.nearest(10), 2);
+}
+
+TYPED_TEST(FloatingPointTest, LookupsGivenRandomTables) {
+  using T = TypeParam;
+
+  for (const std::size_t kSize : {1, 2, 7, 8, 9, 100, 1'023, 1'024, 1'025}) {
+    const auto kEntries = randomEntries<T>(kSize);
+    const FuzzyFlatMap<T, std::size_t> kMap{kEntries};
+    ASSERT_EQ(kMap.size(), kSize);
+
+    const std::vector<T> kKeys = randomKeys<T>(1'000, kSize);
+    const std::vector<T> kSorted{kMap.keys().begin(), kMap.keys().end()};
+
+    std::vector<std::size_t> ranks(kKeys.size());
+    std::vector<std::size_t> found(kKeys.size());
+    kMap.lowerBound(kKeys, ranks);
+    kMap.find(kKeys, found);
+
+    for (std::size_t i = 0; i < kKeys.size(); ++i) {
+      const T kKey = kKeys[i];
+
+      const auto kExpected = static_cast<std::size_t>(
+          std::ranges::partition_point(kSorted, [&](T key) { return fuzzyCmpLess(key, kKey); })
+          - kSorted.begin());
+      EXPECT_EQ(kMap.lowerBound(kKey), kExpected);
+      EXPECT_EQ(ranks[i], kExpected);
+
+      const bool kIsFound = kExpected < kSize and fuzzyCmpEqual(kSorted[kExpected], kKey);
+      const std::optional<std::size_t> kFound =
+          kIsFound ? std::optional{kExpected} : std::nullopt;
+      EXPECT_EQ(kMap.find(kKey), kFound);
+      EXPECT_EQ(found[i], (kIsFound ? kExpected : FuzzyFlatMap<T, std::size_t>::kNone));
+
+      const auto kNearest = *kMap.nearest(kKey);
+      for (const T kOther : kSorted) {
+        EXPECT_LE(std::abs(kSorted[kNearest] - kKey), std::abs(kOther - kKey));
+      }
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FindGivenPolicy) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const FuzzyFlatMap<T, int, RelativeComparison> kMap{{{1, 0}, {1'000, 1}}};
+
+  EXPECT_EQ(kMap.find(1'000 * (1 + kEpsilon / 2)), 1);
+  EXPECT_FALSE(kMap.find(1 + 2 * kEpsilon).has_value());
+}
+
+} // namespace
+} // namespace robocin
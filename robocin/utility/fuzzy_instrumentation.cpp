@@ -0,0 +1,229 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <tuple>
+
+namespace robocin {
+namespace {
+
+constexpr double kNearBoundaryLower = 0.9;
+constexpr double kNearBoundaryUpper = 1.1;
+
+// writes a CSV field, quoted, since function names have commas (e.g. template arguments).
+void writeQuoted(std::ostream& os, std::string_view field) {
+  os << '"';
+  for (const char kChar : field) {
+    os << kChar;
+    if (kChar == '"') {
+      os << '"';
+    }
+  }
+  os << '"';
+}
+
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+
+// The number of call sites recorded by each thread; the comparisons of any further call site are
+// not recorded.
+constexpr std::size_t kSlotsPerThread = 512;
+
+// A call site of a thread. Only the thread writes it, and 'used' publishes its location (which is
+// never written again) to the snapshots, which read the counts while the thread increments them.
+struct Slot {
+  std::atomic<bool> used{false};
+  const char* file = nullptr;
+  const char* function = nullptr;
+  std::uint_least32_t line = 0;
+  std::uint_least32_t column = 0;
+  std::array<std::atomic<std::uint64_t>, kFuzzyRatioBins> counts{};
+};
+
+using Table = std::array<Slot, kSlotsPerThread>;
+
+// Sites are merged by their location, since the same call site may be recorded by many threads,
+// and by many translation units (e.g. in an inline function), with distinct 'file' pointers.
+using SiteKey = std::tuple<std::string_view, std::uint_least32_t, std::uint_least32_t>;
+using HistogramMap = std::map<SiteKey, FuzzyCallSiteHistogram>;
+
+void merge(const Slot& slot, HistogramMap& histograms) {
+  FuzzyCallSiteHistogram& histogram = histograms[SiteKey{slot.file, slot.line, slot.column}];
+  if (histogram.file.empty()) {
+    histogram.file = slot.file;
+    histogram.function = slot.function;
+    histogram.line = slot.line;
+    histogram.column = slot.column;
+  }
+  for (std::size_t i = 0; i < kFuzzyRatioBins; ++i) {
+    histogram.counts[i] += slot.counts[i].load(std::memory_order_relaxed);
+  }
+}
+
+void merge(const Table& table, HistogramMap& histograms) {
+  for (const Slot& slot : table) {
+    if (slot.used.load(std::memory_order_acquire)) {
+      merge(slot, histograms);
+    }
+  }
+}
+
+// The tables of the threads alive, and the histograms of the ones that have exited.
+class Registry {
+ public:
+  void attach(const Table& table) {
+    const std::lock_guard kLock{mutex_};
+    tables_.push_back(&table);
+  }
+
+  void detach(const Table& table) {
+    const std::lock_guard kLock{mutex_};
+    std::erase(tables_, &table);
+    merge(table, retired_);
+  }
+
+  HistogramMap snapshot() {
+    const std::lock_guard kLock{mutex_};
+    HistogramMap histograms = retired_;
+    for (const Table* table : tables_) {
+      merge(*table, histograms);
+    }
+    return histograms;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<const Table*> tables_;
+  HistogramMap retired_;
+};
+
+// leaked, so that the threads which exit after the static objects are destroyed may detach.
+Registry& registry() {
+  static auto* const kRegistry = new Registry;
+  return *kRegistry;
+}
+
+class ThreadTable {
+ public:
+  ThreadTable() : table_{std::make_unique<Table>()} { registry().attach(*table_); }
+
+  ThreadTable(const ThreadTable&) = delete;
+  ThreadTable& operator=(const ThreadTable&) = delete;
+
+  ~ThreadTable() { registry().detach(*table_); }
+
+  Table& get() { return *table_; }
+
+ private:
+  std::unique_ptr<Table> table_;
+};
+
+Table& threadTable() {
+  thread_local ThreadTable table;
+  return table.get();
+}
+
+std::size_t ratioBin(double ratio) {
+  if (std::isnan(ratio)) {
+    return kFuzzyRatioBins - 1;
+  }
+  return static_cast<std::size_t>(std::ranges::lower_bound(kFuzzyRatioBounds, ratio)
+                                  - kFuzzyRatioBounds.begin());
+}
+
+#endif
+
+} // namespace
+
+std::uint64_t FuzzyCallSiteHistogram::total() const {
+  std::uint64_t result = 0;
+  for (const std::uint64_t kCount : counts) {
+    result += kCount;
+  }
+  return result;
+}
+
+std::uint64_t FuzzyCallSiteHistogram::nearBoundary() const {
+  std::uint64_t result = 0;
+  for (std::size_t i = 1; i < kFuzzyRatioBounds.size(); ++i) {
+    if (kFuzzyRatioBounds[i - 1] >= kNearBoundaryLower
+        and kFuzzyRatioBounds[i] <= kNearBoundaryUpper) {
+      result += counts[i];
+    }
+  }
+  return result;
+}
+
+std::vector<FuzzyCallSiteHistogram> fuzzyInstrumentationSnapshot() {
+  std::vector<FuzzyCallSiteHistogram> result;
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+  for (auto& [key, histogram] : registry().snapshot()) {
+    result.push_back(histogram);
+  }
+#endif
+  return result;
+}
+
+void dumpFuzzyInstrumentation(std::ostream& os) {
+  os << "file,line,column,function,total,near_boundary";
+  for (const double kBound : kFuzzyRatioBounds) {
+    os << ",<=" << kBound;
+  }
+  os << ",>" << kFuzzyRatioBounds.back() << '\n';
+
+  for (const FuzzyCallSiteHistogram& histogram : fuzzyInstrumentationSnapshot()) {
+    writeQuoted(os, histogram.file);
+    os << ',' << histogram.line << ',' << histogram.column << ',';
+    writeQuoted(os, histogram.function);
+    os << ',' << histogram.total() << ',' << histogram.nearBoundary();
+    for (const std::uint64_t kCount : histogram.counts) {
+      os << ',' << kCount;
+    }
+    os << '\n';
+  }
+}
+
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+
+void internal::recordFuzzyRatio(const std::source_location& location, double ratio) noexcept {
+  Table& table = threadTable();
+
+  const std::size_t kHash = std::hash<const void*>{}(location.file_name())
+                            ^ (std::size_t{location.line()} * 0x9E3779B97F4A7C15ULL)
+                            ^ location.column();
+
+  for (std::size_t probe = 0, i = kHash % kSlotsPerThread; probe < kSlotsPerThread;
+       ++probe, i = (i + 1) % kSlotsPerThread) {
+    Slot& slot = table[i];
+
+    if (not slot.used.load(std::memory_order_relaxed)) {
+      slot.file = location.file_name();
+      slot.function = location.function_name();
+      slot.line = location.line();
+      slot.column = location.column();
+      slot.used.store(true, std::memory_order_release);
+    } else if (slot.line != location.line() or slot.column != location.column()
+               or slot.file != location.file_name()) {
+      continue;
+    }
+
+    // only this thread writes the counts, hence no read-modify-write is needed.
+    std::atomic<std::uint64_t>& count = slot.counts[ratioBin(ratio)];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return;
+  }
+}
+
+#endif
+
+} // namespace robocin
@@ -0,0 +1,92 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_FUZZY_INSTRUMENTATION_H
+#define ROBOCIN_UTILITY_FUZZY_INSTRUMENTATION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+// Opt-in instrumentation of the fuzzy comparisons of 'fuzzy_compare.h', enabled by the CMake option
+// 'ROBOCIN_FUZZY_INSTRUMENTATION' (which defines 'ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION').
+// When enabled, every scalar comparison records how far apart its values are, in tolerances (the
+// 'ratio' of its policy, e.g. 'abs(lhs - rhs) / epsilon', which is at most 1 for equal values), in
+// a histogram of its call site. Comparisons whose ratio is close to 1 flip between equal and not
+// equal under small perturbations, hence the histograms tell how to tune the epsilon and which call
+// sites flip-flop between frames.
+//
+// The histograms are kept per thread and updated without locks nor read-modify-write instructions,
+// hence the overhead is a table lookup per comparison. When disabled, 'FuzzyCallSite' is empty and
+// no comparison records anything; the snapshot is always empty.
+
+namespace robocin {
+
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+inline constexpr bool kFuzzyInstrumentationEnabled = true;
+#else
+inline constexpr bool kFuzzyInstrumentationEnabled = false;
+#endif
+
+// The call site of a comparison, captured by the default argument of the fuzzy functions (or, for
+// the functors, of their constructors).
+class FuzzyCallSite {
+ public:
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+  constexpr FuzzyCallSite( // NOLINT(google-explicit-constructor)
+      std::source_location location = std::source_location::current()) noexcept :
+      location_{location} {}
+
+  [[nodiscard]] constexpr const std::source_location& location() const { return location_; }
+
+ private:
+  std::source_location location_;
+#endif
+};
+
+// The upper bounds of the bins of the histograms: the i-th bin counts the ratios in
+// (kFuzzyRatioBounds[i - 1], kFuzzyRatioBounds[i]], and the last one the ratios above every bound
+// (and NaNs). The bins are narrower around 1, the boundary between equal and not equal.
+inline constexpr std::array<double, 9> kFuzzyRatioBounds{
+    0.25, 0.5, 0.9, 0.99, 1.0, 1.01, 1.1, 2.0, 4.0};
+inline constexpr std::size_t kFuzzyRatioBins = kFuzzyRatioBounds.size() + 1;
+
+// The histogram of a call site, merged across threads.
+struct FuzzyCallSiteHistogram {
+  std::string_view file;
+  std::string_view function;
+  std::uint_least32_t line = 0;
+  std::uint_least32_t column = 0;
+  std::array<std::uint64_t, kFuzzyRatioBins> counts{};
+
+  [[nodiscard]] std::uint64_t total() const;
+
+  // The number of comparisons whose ratio is in (0.9, 1.1], i.e. within 10% of the boundary.
+  [[nodiscard]] std::uint64_t nearBoundary() const;
+};
+
+// The histograms of every call site that has compared, in the threads alive and in the ones that
+// have exited, sorted by file, line and column. Comparisons in other threads may be concurrent, in
+// which case their most recent counts may be missing.
+std::vector<FuzzyCallSiteHistogram> fuzzyInstrumentationSnapshot();
+
+// Writes the snapshot as CSV: a header, then a row per call site with its location, total, near
+// boundary count and the count of each bin.
+void dumpFuzzyInstrumentation(std::ostream& os);
+
+namespace internal {
+
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+void recordFuzzyRatio(const std::source_location& location, double ratio) noexcept;
+#endif
+
+} // namespace internal
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_FUZZY_INSTRUMENTATION_H
@@ -0,0 +1,199 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_instrumentation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/fuzzy_compare.h"
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+TYPED_TEST(FloatingPointTest, AbsoluteRatioGivenDistancesInEpsilons) {
+  using T = TypeParam;
+
+  EXPECT_EQ(AbsoluteComparison::ratio(T{1}, T{1}, T{0.5}), T{0});
+  EXPECT_EQ(AbsoluteComparison::ratio(T{1}, T{1.25}, T{0.5}), T{0.5});
+  EXPECT_EQ(AbsoluteComparison::ratio(T{-1}, T{1}, T{0.5}), T{4});
+  EXPECT_EQ(AbsoluteComparison::ratio(T{0}, T{0}, T{0}), T{0});
+}
+
+TYPED_TEST(FloatingPointTest, RelativeRatioGivenDistancesInEpsilons) {
+  using T = TypeParam;
+
+  EXPECT_EQ(RelativeComparison::ratio(T{0}, T{0}, T{0.5}), T{0});
+  EXPECT_EQ(RelativeComparison::ratio(T{100}, T{75}, T{0.5}), T{0.5});
+  EXPECT_EQ(AbsoluteOrRelativeComparison::ratio(T{0.25}, T{0.5}, T{0.5}), T{0.5});
+  EXPECT_EQ(AbsoluteOrRelativeComparison::ratio(T{100}, T{75}, T{0.5}), T{0.5});
+}
+
+TYPED_TEST(FloatingPointTest, RatioIsAtMostOneIfAndOnlyIfEqual) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = T{0.125};
+
+  for (int i = -20; i <= 20; ++i) {
+    const T kRhs = T{1} + static_cast<T>(i) / T{64};
+
+    EXPECT_EQ(AbsoluteComparison::ratio(T{1}, kRhs, kEpsilon) <= 1,
+              AbsoluteComparison::equal(T{1}, kRhs, kEpsilon));
+    EXPECT_EQ(RelativeComparison::ratio(T{1}, kRhs, kEpsilon) <= 1,
+              RelativeComparison::equal(T{1}, kRhs, kEpsilon));
+    EXPECT_EQ(AbsoluteOrRelativeComparison::ratio(T{1}, kRhs, kEpsilon) <= 1,
+              AbsoluteOrRelativeComparison::equal(T{1}, kRhs, kEpsilon));
+  }
+}
+
+TEST(FuzzyInstrumentationTest, UlpRatioGivenDistancesInUlps) {
+  const double kTwoUlpsAbove = std::nextafter(std::nextafter(1.0, 2.0), 2.0);
+
+  EXPECT_EQ(UlpComparison::ratio(1.0, 1.0, 4.0), 0.0);
+  EXPECT_EQ(UlpComparison::ratio(1.0, kTwoUlpsAbove, 4.0), 0.5);
+  EXPECT_EQ(UlpComparison::ratio(kTwoUlpsAbove, 1.0, 4.0), 0.5);
+  EXPECT_EQ(UlpComparison::ratio(std::numeric_limits<double>::quiet_NaN(), 1.0, 4.0),
+            std::numeric_limits<double>::infinity());
+}
+
+TEST(FuzzyInstrumentationTest, HistogramTotalAndNearBoundary) {
+  FuzzyCallSiteHistogram histogram;
+  for (std::size_t i = 0; i < kFuzzyRatioBins; ++i) {
+    histogram.counts[i] = std::uint64_t{1} << i;
+  }
+
+  EXPECT_EQ(histogram.total(), (std::uint64_t{1} << kFuzzyRatioBins) - 1);
+  // (0.9, 0.99], (0.99, 1], (1, 1.01] and (1.01, 1.1].
+  EXPECT_EQ(histogram.nearBoundary(), 0b1111000U);
+}
+
+TEST(FuzzyInstrumentationTest, DumpWritesHeader) {
+  std::ostringstream os;
+  dumpFuzzyInstrumentation(os);
+
+  const std::string kDump = os.str();
+  EXPECT_EQ(kDump.substr(0, kDump.find('\n')),
+            "file,line,column,function,total,near_boundary,"
+            "<=0.25,<=0.5,<=0.9,<=0.99,<=1,<=1.01,<=1.1,<=2,<=4,>4");
+}
+
+#if defined(ROBOCIN_ENABLE_FUZZY_INSTRUMENTATION)
+
+// the histogram of the given line of this file, if any comparison has been recorded there.
+std::optional<FuzzyCallSiteHistogram> histogramAt(std::uint_least32_t line) {
+  const std::string_view kFile = std::source_location::current().file_name();
+
+  for (const FuzzyCallSiteHistogram& histogram : fuzzyInstrumentationSnapshot()) {
+    if (histogram.file == kFile and histogram.line == line) {
+      return histogram;
+    }
+  }
+  return std::nullopt;
+}
+
+TEST(FuzzyInstrumentationTest, RecordsRatiosAtTheCallSite) {
+  const std::uint_least32_t kLine = std::source_location::current().line();
+  EXPECT_TRUE(fuzzyCmpEqual(1.0, 1.125, 0.5));
+
+  const auto kHistogram = histogramAt(kLine + 1);
+  ASSERT_TRUE(kHistogram.has_value());
+  EXPECT_EQ(kHistogram->total(), 1U);
+  EXPECT_EQ(kHistogram->counts[0], 1U); // 0.25, in [0, 0.25].
+}
+
+TEST(FuzzyInstrumentationTest, RecordsEachComparisonOnceThroughTheDerivedFunctions) {
+  const std::uint_least32_t kLine = std::source_location::current().line();
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FALSE(fuzzyCmpLess(1.0, 1.25, 0.25)); // 1, in (0.99, 1].
+  }
+
+  const auto kHistogram = histogramAt(kLine + 2);
+  ASSERT_TRUE(kHistogram.has_value());
+  EXPECT_EQ(kHistogram->total(), 3U);
+  EXPECT_EQ(kHistogram->counts[4], 3U);
+  EXPECT_EQ(kHistogram->nearBoundary(), 3U);
+}
+
+TEST(FuzzyInstrumentationTest, RecordsFunctorsAtTheirConstruction) {
+  const std::vector<double> kValues{0.0, 0.5, 3.0, 5.0};
+
+  const std::uint_least32_t kLine = std::source_location::current().line();
+  const FuzzyIsZero<double> kIsZero{1.0};
+  EXPECT_EQ(std::ranges::count_if(kValues, kIsZero), 2);
+
+  const auto kHistogram = histogramAt(kLine + 1);
+  ASSERT_TRUE(kHistogram.has_value());
+  EXPECT_EQ(kHistogram->total(), kValues.size());
+  EXPECT_EQ(kHistogram->counts[kFuzzyRatioBins - 1], 1U); // 5, above 4.
+}
+
+TEST(FuzzyInstrumentationTest, MergesTheThreadsThatHaveExited) {
+  static constexpr int kThreads = 4;
+  static constexpr int kComparisons = 100;
+
+  std::uint_least32_t line = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&line, t] {
+      for (int i = 0; i < kComparisons; ++i) {
+        const FuzzyCallSite kSite;
+        EXPECT_FALSE(fuzzyIsZero(1.5, 1.0, kSite)); // 1.5, in (1.1, 2].
+        if (t == 0 and i == 0) {
+          line = kSite.location().line();
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  const auto kHistogram = histogramAt(line);
+  ASSERT_TRUE(kHistogram.has_value());
+  EXPECT_EQ(kHistogram->total(), std::uint64_t{kThreads * kComparisons});
+  EXPECT_EQ(kHistogram->counts[7], std::uint64_t{kThreads * kComparisons});
+  EXPECT_EQ(kHistogram->nearBoundary(), 0U);
+}
+
+TEST(FuzzyInstrumentationTest, DoesNotRecordConstantEvaluations) {
+  static_assert(fuzzyCmpEqual(1.0, 1.125, 0.5));
+}
+
+#else
+
+TEST(FuzzyInstrumentationTest, CallSiteIsEmptyAndNothingIsRecordedWhenDisabled) {
+  static_assert(std::is_empty_v<FuzzyCallSite>);
+  static_assert(sizeof(FuzzyEqualTo<double>) == sizeof(double));
+
+  EXPECT_TRUE(fuzzyCmpEqual(1.0, 1.125, 0.5));
+  EXPECT_TRUE(fuzzyInstrumentationSnapshot().empty());
+}
+
+#endif
+
+} // namespace
+} // namespace robocin
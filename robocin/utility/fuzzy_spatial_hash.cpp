@@ -0,0 +1,14 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_spatial_hash.h"
+
+namespace robocin {
+
+template class FuzzySpatialHash<float>;
+template class FuzzySpatialHash<double>;
+template class FuzzySpatialHash<long double>;
+
+} // namespace robocin
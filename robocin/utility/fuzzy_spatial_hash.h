@@ -0,0 +1,249 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_FUZZY_SPATIAL_HASH_H
+#define ROBOCIN_UTILITY_FUZZY_SPATIAL_HASH_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+namespace robocin {
+
+// Hash grid of 2D points, whose cells are (slightly more than) '2 * radius' wide, so that the
+// points equal to a given one within 'radius', i.e. those whose x and y coordinates are both
+// 'fuzzyCmpEqual' to its own, lie in the 2x2 cells closest to it. Lookups take O(1) expected time,
+// instead of a comparison against every point, and give the same answers as those comparisons.
+//
+// 'clear' keeps the allocated memory, so that a hash reused every frame (e.g. to merge the
+// detections of several cameras) stops allocating once it has seen its largest frame. Coordinates
+// must be finite, and within 2^32 radii of the origin.
+template <std::floating_point F>
+class FuzzySpatialHash {
+  // cells are computed in at least double precision, so that large coordinates are not rounded into
+  // a non-adjacent cell.
+  using cell_float_t = std::conditional_t<std::same_as<F, float>, double, F>;
+
+  // a margin of 2^-10 cells, well above the rounding errors of 'fuzzyCmpEqual' and of the division.
+  static constexpr cell_float_t kCellScale = 2 * (1 + cell_float_t{1} / 1024);
+
+  static constexpr std::size_t kMinBuckets = 16;
+
+ public:
+  using value_type = F;
+  using size_type = std::size_t;
+
+  static constexpr size_type kNone = std::numeric_limits<size_type>::max();
+
+  FuzzySpatialHash()
+    requires(has_epsilon_v<value_type>)
+      : FuzzySpatialHash{epsilon_v<value_type>} {}
+
+  explicit FuzzySpatialHash(value_type radius) :
+      radius_{radius},
+      inverse_cell_size_{1 / (static_cast<cell_float_t>(radius) * kCellScale)},
+      buckets_(kMinBuckets, kNone) {
+    assert(radius > 0);
+  }
+
+  [[nodiscard]] value_type radius() const { return radius_; }
+
+  [[nodiscard]] size_type size() const { return points_.size(); }
+  [[nodiscard]] bool empty() const { return points_.empty(); }
+
+  [[nodiscard]] value_type x(size_type index) const { return points_[index].x; }
+  [[nodiscard]] value_type y(size_type index) const { return points_[index].y; }
+
+  void reserve(size_type size) {
+    points_.reserve(size);
+    if (buckets_.size() < size) {
+      rehash(std::bit_ceil(size));
+    }
+  }
+
+  // Removes every point, but keeps the allocated memory.
+  void clear() {
+    points_.clear();
+    std::ranges::fill(buckets_, kNone);
+  }
+
+  // Inserts a point, returning its index (i.e. the number of points inserted before it).
+  size_type insert(value_type x, value_type y) {
+    if (points_.size() == buckets_.size()) {
+      rehash(2 * buckets_.size());
+    }
+
+    const size_type kIndex = points_.size();
+    const std::int64_t kCellX = cell(x);
+    const std::int64_t kCellY = cell(y);
+
+    size_type& head = buckets_[bucket(kCellX, kCellY)];
+    points_.push_back({x, y, kCellX, kCellY, head});
+    head = kIndex;
+
+    return kIndex;
+  }
+
+  void insert(std::span<const value_type> x, std::span<const value_type> y) {
+    assert(x.size() == y.size());
+
+    reserve(points_.size() + x.size());
+    for (size_type i = 0; i < x.size(); ++i) {
+      insert(x[i], y[i]);
+    }
+  }
+
+  // Calls 'function(index)' for every point equal to the given one within 'radius'.
+  template <class Function>
+  void forEachNeighbor(value_type x, value_type y, Function function) const {
+    visitNeighbors(x, y, [&](size_type index) {
+      function(index);
+      return false;
+    });
+  }
+
+  // The index of a point equal to the given one within 'radius', if any.
+  [[nodiscard]] std::optional<size_type> find(value_type x, value_type y) const {
+    std::optional<size_type> result;
+    visitNeighbors(x, y, [&](size_type index) {
+      result = index;
+      return true;
+    });
+    return result;
+  }
+
+  [[nodiscard]] bool contains(value_type x, value_type y) const { return find(x, y).has_value(); }
+
+  // Labels the points by the connected components of the 'equal within radius' relation (i.e.
+  // DBSCAN, with one point per core), which are the same components given by comparing every pair
+  // of points. Labels are numbered from 0, in the order of their first point, and their count is
+  // returned. 'labels' must have 'size()' elements.
+  size_type clusters(std::span<size_type> labels) const {
+    assert(labels.size() == points_.size());
+
+    // union-find, with 'labels' as the parents, in which the root of every set is its smallest
+    // index, so that every parent precedes its children.
+    for (size_type i = 0; i < points_.size(); ++i) {
+      labels[i] = i;
+      forEachNeighbor(points_[i].x, points_[i].y, [&](size_type j) {
+        if (j < i) {
+          unite(labels, i, j);
+        }
+      });
+    }
+
+    // every parent is already its root when its children are reached.
+    for (size_type i = 0; i < points_.size(); ++i) {
+      labels[i] = labels[labels[i]];
+    }
+
+    size_type count = 0;
+    for (size_type i = 0; i < points_.size(); ++i) {
+      labels[i] = labels[i] == i ? count++ : labels[labels[i]];
+    }
+    return count;
+  }
+
+ private:
+  struct Point {
+    value_type x;
+    value_type y;
+    std::int64_t cell_x;
+    std::int64_t cell_y;
+    size_type next;
+  };
+
+  [[nodiscard]] std::int64_t cell(value_type coordinate) const {
+    return static_cast<std::int64_t>(
+        std::floor(static_cast<cell_float_t>(coordinate) * inverse_cell_size_));
+  }
+
+  // The first of the two cells, along one axis, that may hold the neighbors of a coordinate: the
+  // previous one if it lies in the first half of its cell, its own otherwise.
+  [[nodiscard]] std::int64_t firstNeighborCell(value_type coordinate) const {
+    const cell_float_t kScaled = static_cast<cell_float_t>(coordinate) * inverse_cell_size_;
+    const cell_float_t kCell = std::floor(kScaled);
+
+    return static_cast<std::int64_t>(kCell) - (kScaled - kCell < cell_float_t{0.5} ? 1 : 0);
+  }
+
+  [[nodiscard]] size_type bucket(std::int64_t cell_x, std::int64_t cell_y) const {
+    // Fibonacci hashing, taking the highest bits of the product.
+    const std::uint64_t kHash = static_cast<std::uint64_t>(cell_x) * 0x9E3779B97F4A7C15ULL
+                                ^ static_cast<std::uint64_t>(cell_y) * 0xC2B2AE3D27D4EB4FULL;
+    return static_cast<size_type>((kHash * 0x9E3779B97F4A7C15ULL) >> shift_);
+  }
+
+  void rehash(size_type buckets) {
+    buckets_.assign(std::max(buckets, kMinBuckets), kNone);
+    shift_ = 64 - std::countr_zero(buckets_.size());
+
+    for (size_type i = 0; i < points_.size(); ++i) {
+      size_type& head = buckets_[bucket(points_[i].cell_x, points_[i].cell_y)];
+      points_[i].next = head;
+      head = i;
+    }
+  }
+
+  // Calls 'visitor(index)' for every point equal to the given one within 'radius', until it returns
+  // true.
+  template <class Visitor>
+  void visitNeighbors(value_type x, value_type y, Visitor visitor) const {
+    const std::int64_t kFirstX = firstNeighborCell(x);
+    const std::int64_t kFirstY = firstNeighborCell(y);
+
+    for (std::int64_t cell_x = kFirstX; cell_x <= kFirstX + 1; ++cell_x) {
+      for (std::int64_t cell_y = kFirstY; cell_y <= kFirstY + 1; ++cell_y) {
+        for (size_type i = buckets_[bucket(cell_x, cell_y)]; i != kNone; i = points_[i].next) {
+          const Point& point = points_[i];
+          // other cells may share the bucket, and would otherwise be visited more than once.
+          if (point.cell_x != cell_x or point.cell_y != cell_y) {
+            continue;
+          }
+          if (fuzzyCmpEqual(point.x, x, radius_) and fuzzyCmpEqual(point.y, y, radius_)
+              and visitor(i)) {
+            return;
+          }
+        }
+      }
+    }
+  }
+
+  static size_type root(std::span<size_type> parents, size_type index) {
+    while (parents[index] != index) {
+      index = parents[index] = parents[parents[index]];
+    }
+    return index;
+  }
+
+  static void unite(std::span<size_type> parents, size_type lhs, size_type rhs) {
+    const size_type kLhs = root(parents, lhs);
+    const size_type kRhs = root(parents, rhs);
+    parents[std::max(kLhs, kRhs)] = std::min(kLhs, kRhs);
+  }
+
+  value_type radius_;
+  cell_float_t inverse_cell_size_;
+  int shift_ = 64 - std::countr_zero(kMinBuckets);
+
+  std::vector<Point> points_;
+  std::vector<size_type> buckets_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_FUZZY_SPATIAL_HASH_H
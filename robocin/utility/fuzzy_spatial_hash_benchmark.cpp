@@ -0,0 +1,98 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_spatial_hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+// detections of 'size / 4' objects, each seen by 4 cameras, within epsilon / 4 of each other.
+template <class F>
+std::pair<std::vector<F>, std::vector<F>> randomDetections(std::size_t size) {
+  static constexpr F kEpsilon = epsilon_v<F>;
+
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<F> object{-static_cast<F>(size) * kEpsilon,
+                                           static_cast<F>(size) * kEpsilon};
+  std::uniform_real_distribution<F> noise{-kEpsilon / 8, kEpsilon / 8};
+
+  std::vector<F> x(size);
+  std::vector<F> y(size);
+  for (std::size_t i = 0; i < size; i += 4) {
+    const F kX = object(generator);
+    const F kY = object(generator);
+    for (std::size_t j = i; j < i + 4 and j < size; ++j) {
+      x[j] = kX + noise(generator);
+      y[j] = kY + noise(generator);
+    }
+  }
+  return {std::move(x), std::move(y)};
+}
+
+// The pairwise loop the hash replaces: every detection is compared to the first one of every
+// cluster found so far.
+template <class F>
+std::size_t pairwiseClusters(const std::vector<F>& x,
+                             const std::vector<F>& y,
+                             std::vector<std::size_t>& labels) {
+  std::vector<std::size_t> firsts;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    labels[i] = firsts.size();
+    for (std::size_t j = 0; j < firsts.size(); ++j) {
+      if (fuzzyCmpEqual(x[i], x[firsts[j]]) and fuzzyCmpEqual(y[i], y[firsts[j]])) {
+        labels[i] = j;
+        break;
+      }
+    }
+    if (labels[i] == firsts.size()) {
+      firsts.push_back(i);
+    }
+  }
+  return firsts.size();
+}
+
+template <class F>
+void BM_PairwiseClusters(benchmark::State& state) {
+  const auto [kX, kY] = randomDetections<F>(static_cast<std::size_t>(state.range(0)));
+  std::vector<std::size_t> labels(kX.size());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pairwiseClusters(kX, kY, labels));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kX.size()));
+}
+
+// a frame: the hash is cleared, filled and clustered.
+template <class F>
+void BM_FuzzySpatialHashClusters(benchmark::State& state) {
+  const auto [kX, kY] = randomDetections<F>(static_cast<std::size_t>(state.range(0)));
+  std::vector<std::size_t> labels(kX.size());
+
+  FuzzySpatialHash<F> hash;
+  for (auto _ : state) {
+    hash.clear();
+    hash.insert(kX, kY);
+    benchmark::DoNotOptimize(hash.clusters(labels));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kX.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_PairwiseClusters, float)->RangeMultiplier(8)->Range(16, 1'024);
+BENCHMARK_TEMPLATE(BM_PairwiseClusters, double)->RangeMultiplier(8)->Range(16, 1'024);
+BENCHMARK_TEMPLATE(BM_FuzzySpatialHashClusters, float)->RangeMultiplier(8)->Range(16, 1'024);
+BENCHMARK_TEMPLATE(BM_FuzzySpatialHashClusters, double)->RangeMultiplier(8)->Range(16, 1'024);
+
+} // namespace
+} // namespace robocin
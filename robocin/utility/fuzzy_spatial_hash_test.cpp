@@ -0,0 +1,160 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/fuzzy_spatial_hash.h"
+
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+// Coordinates in [-max, max], that are multiples of epsilon / 4, so that many pairs of points are
+// exactly epsilon apart.
+template <class T>
+std::vector<T> randomCoordinates(T max, std::size_t size, unsigned seed) {
+  static constexpr T kQuarterEpsilon = epsilon_v<T> / 4;
+
+  std::mt19937 generator{seed};
+  std::uniform_int_distribution<long> distribution{-static_cast<long>(max / kQuarterEpsilon),
+                                                   static_cast<long>(max / kQuarterEpsilon)};
+
+  std::vector<T> result(size);
+  for (T& coordinate : result) {
+    coordinate = static_cast<T>(distribution(generator)) * kQuarterEpsilon;
+  }
+  return result;
+}
+
+template <class T>
+bool pairwiseEqual(T lhsX, T lhsY, T rhsX, T rhsY) {
+  return fuzzyCmpEqual(lhsX, rhsX, epsilon_v<T>) and fuzzyCmpEqual(lhsY, rhsY, epsilon_v<T>);
+}
+
+TYPED_TEST(FloatingPointTest, FindGivenPointsWithinAndBeyondRadius) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  FuzzySpatialHash<T> hash;
+  EXPECT_EQ(hash.radius(), kEpsilon);
+  EXPECT_FALSE(hash.find(0, 0).has_value());
+
+  EXPECT_EQ(hash.insert(0, 0), 0);
+  EXPECT_EQ(hash.insert(10 * kEpsilon, -10 * kEpsilon), 1);
+
+  EXPECT_EQ(hash.find(kEpsilon / 2, -kEpsilon / 2), 0);
+  EXPECT_EQ(hash.find(kEpsilon, kEpsilon), 0);
+  EXPECT_EQ(hash.find(21 * kEpsilon / 2, -19 * kEpsilon / 2), 1);
+  EXPECT_FALSE(hash.contains(2 * kEpsilon, 0));
+  EXPECT_FALSE(hash.contains(0, -2 * kEpsilon));
+  EXPECT_FALSE(hash.contains(5 * kEpsilon, -5 * kEpsilon));
+}
+
+TYPED_TEST(FloatingPointTest, ForEachNeighborMatchesPairwiseComparisons) {
+  using T = TypeParam;
+
+  static constexpr std::size_t kSize = 2'000;
+  static constexpr T kMax = 20 * epsilon_v<T>;
+
+  const std::vector<T> kX = randomCoordinates(kMax, kSize, /*seed=*/42);
+  const std::vector<T> kY = randomCoordinates(kMax, kSize, /*seed=*/7);
+
+  FuzzySpatialHash<T> hash;
+  hash.insert(kX, kY);
+  ASSERT_EQ(hash.size(), kSize);
+
+  for (std::size_t i = 0; i < kSize; i += 17) {
+    std::vector<bool> found(kSize);
+    hash.forEachNeighbor(kX[i], kY[i], [&](std::size_t j) {
+      EXPECT_FALSE(found[j]) << "visited twice";
+      found[j] = true;
+    });
+
+    for (std::size_t j = 0; j < kSize; ++j) {
+      EXPECT_EQ(found[j], pairwiseEqual(kX[i], kY[i], kX[j], kY[j]));
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, ClustersMatchPairwiseComparisons) {
+  using T = TypeParam;
+
+  static constexpr std::size_t kSize = 500;
+  static constexpr T kMax = 20 * epsilon_v<T>;
+
+  const std::vector<T> kX = randomCoordinates(kMax, kSize, /*seed=*/42);
+  const std::vector<T> kY = randomCoordinates(kMax, kSize, /*seed=*/7);
+
+  FuzzySpatialHash<T> hash;
+  hash.insert(kX, kY);
+
+  std::vector<std::size_t> labels(kSize);
+  const std::size_t kCount = hash.clusters(labels);
+
+  // connected components of the pairwise comparisons, labelled by their first point.
+  std::vector<std::size_t> expected(kSize);
+  std::iota(expected.begin(), expected.end(), 0);
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      for (std::size_t j = 0; j < kSize; ++j) {
+        if (expected[j] < expected[i] and pairwiseEqual(kX[i], kY[i], kX[j], kY[j])) {
+          expected[i] = expected[j];
+          changed = true;
+        }
+      }
+    }
+  }
+
+  std::vector<std::size_t> first(kSize, FuzzySpatialHash<T>::kNone);
+  for (std::size_t i = 0; i < kSize; ++i) {
+    ASSERT_LT(labels[i], kCount);
+    if (first[labels[i]] == FuzzySpatialHash<T>::kNone) {
+      first[labels[i]] = i;
+    }
+    EXPECT_EQ(first[labels[i]], expected[i]);
+  }
+}
+
+TYPED_TEST(FloatingPointTest, ClearKeepsTheHashUsable) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  FuzzySpatialHash<T> hash{4 * kEpsilon};
+  for (int frame = 0; frame < 3; ++frame) {
+    hash.clear();
+    EXPECT_TRUE(hash.empty());
+    EXPECT_FALSE(hash.contains(0, 0));
+
+    hash.insert(static_cast<T>(frame) * kEpsilon, 0);
+    hash.insert(100, 100);
+    EXPECT_EQ(hash.size(), 2);
+    EXPECT_EQ(hash.find(3 * kEpsilon, 0), 0);
+    EXPECT_EQ(hash.find(100 + kEpsilon, 100 - kEpsilon), 1);
+
+    std::vector<std::size_t> labels(hash.size());
+    EXPECT_EQ(hash.clusters(labels), 2);
+  }
+}
+
+} // namespace
+} // namespace robocin
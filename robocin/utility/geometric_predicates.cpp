@@ -0,0 +1,302 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/geometric_predicates.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include "robocin/utility/internal/geometric_predicates_dispatch.h"
+#include "robocin/utility/internal/geometric_predicates_kernels.h"
+
+namespace robocin {
+
+constinit const internal::GeometricPredicatesKernelSet internal::kScalarGeometricPredicatesKernels =
+    internal::geometricPredicatesKernelSet<internal::simd::None>();
+#if defined(__SSE2__)
+constinit const internal::GeometricPredicatesKernelSet internal::kSse2GeometricPredicatesKernels =
+    internal::geometricPredicatesKernelSet<internal::simd::Sse2>();
+#endif
+
+namespace {
+
+namespace simd = internal::simd;
+
+using internal::GeometricPredicatesKernels;
+
+constexpr internal::SimdKernelTable<internal::GeometricPredicatesKernelSet> kKernelTable{
+    &internal::kScalarGeometricPredicatesKernels,
+#if defined(__SSE2__)
+    &internal::kSse2GeometricPredicatesKernels,
+#else
+    nullptr,
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+    &internal::kAvx2GeometricPredicatesKernels,
+    &internal::kAvx512GeometricPredicatesKernels,
+#else
+    nullptr,
+    nullptr,
+#endif
+};
+
+// The kernels of the active instruction set, for 'F'.
+template <std::floating_point F>
+const GeometricPredicatesKernels<F>& kernels() {
+  const internal::GeometricPredicatesKernelSet& kSet = internal::dispatchSimdKernels(kKernelTable);
+  if constexpr (std::same_as<F, float>) {
+    return kSet.for_float;
+  } else {
+    return kSet.for_double;
+  }
+}
+
+// Exact evaluation --------------------------------------------------------------------------------
+// The error-free transformations of Knuth and Dekker: each one returns the rounded result of an
+// operation and its rounding error, whose sum is the exact result. They require strict IEEE-754
+// arithmetic (no '-ffast-math'); the product uses the fused multiply-add whenever the target has
+// it, since then the compiler may contract the operations of Dekker's splitting.
+
+template <std::floating_point F>
+std::pair<F, F> twoSum(F lhs, F rhs) {
+  const F kSum = lhs + rhs;
+  const F kVirtualRhs = kSum - lhs;
+  const F kVirtualLhs = kSum - kVirtualRhs;
+  return {kSum, (lhs - kVirtualLhs) + (rhs - kVirtualRhs)};
+}
+
+template <std::floating_point F>
+std::pair<F, F> twoDiff(F lhs, F rhs) {
+  const F kDiff = lhs - rhs;
+  const F kVirtualRhs = lhs - kDiff;
+  const F kVirtualLhs = kDiff + kVirtualRhs;
+  return {kDiff, (lhs - kVirtualLhs) + (kVirtualRhs - rhs)};
+}
+
+// Splits 'value' into two halves of at most 'digits / 2' significant bits each.
+template <std::floating_point F>
+std::pair<F, F> split(F value) {
+  static constexpr F kSplitter =
+      static_cast<F>((std::uint64_t{1} << ((std::numeric_limits<F>::digits + 1) / 2)) + 1);
+
+  const F kScaled = kSplitter * value;
+  const F kHigh = kScaled - (kScaled - value);
+  return {kHigh, value - kHigh};
+}
+
+template <std::floating_point F>
+std::pair<F, F> twoProduct(F lhs, F rhs) {
+  const F kProduct = lhs * rhs;
+#ifdef __FMA__
+  if constexpr (not std::same_as<F, long double>) {
+    return {kProduct, std::fma(lhs, rhs, -kProduct)};
+  }
+#endif
+  const auto [kLhsHigh, kLhsLow] = split(lhs);
+  const auto [kRhsHigh, kRhsLow] = split(rhs);
+  const F kError =
+      ((kLhsHigh * kRhsHigh - kProduct) + kLhsHigh * kRhsLow + kLhsLow * kRhsHigh)
+      + kLhsLow * kRhsLow;
+  return {kProduct, kError};
+}
+
+// A nonoverlapping expansion: an exact sum of floating point components, sorted by increasing
+// magnitude and without zeros, so that the last one has the sign of the sum (Shewchuk's
+// 'Grow-Expansion', with zero elimination).
+template <std::floating_point F, std::size_t N>
+class Expansion {
+ public:
+  void add(F value) {
+    assert(size_ < N);
+
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < size_; ++i) {
+      const auto [kSum, kError] = twoSum(value, components_[i]);
+      if (kError != 0) {
+        components_[size++] = kError;
+      }
+      value = kSum;
+    }
+    if (value != 0) {
+      components_[size++] = value;
+    }
+    size_ = size;
+  }
+
+  [[nodiscard]] int sign() const {
+    if (size_ == 0) {
+      return 0;
+    }
+    return components_[size_ - 1] > 0 ? 1 : -1;
+  }
+
+  // The sum in 'long double', from the smallest component to the largest.
+  [[nodiscard]] long double estimate() const {
+    long double result = 0;
+    for (std::size_t i = 0; i < size_; ++i) {
+      result += components_[i];
+    }
+    return result;
+  }
+
+ private:
+  std::array<F, N> components_{};
+  std::size_t size_ = 0;
+};
+
+// The determinant of 'orientation', '(b - a).cross(c - a)', is the sum of the exact products of the
+// exact differences, as two components each: 16 components in total.
+template <std::floating_point F>
+Orientation exactOrientationOf(Point2D<F> a, Point2D<F> b, Point2D<F> c, F epsilon) {
+  const auto [kAbX, kAbXError] = twoDiff(b.x, a.x);
+  const auto [kAbY, kAbYError] = twoDiff(b.y, a.y);
+  const auto [kAcX, kAcXError] = twoDiff(c.x, a.x);
+  const auto [kAcY, kAcYError] = twoDiff(c.y, a.y);
+
+  Expansion<F, 16> determinant;
+  const auto add_products = [&determinant](F lhs, F lhs_error, F rhs, F rhs_error, F sign) {
+    for (const F kLhs : {lhs, lhs_error}) {
+      for (const F kRhs : {rhs, rhs_error}) {
+        const auto [kProduct, kError] = twoProduct(kLhs, kRhs);
+        determinant.add(sign * kProduct);
+        determinant.add(sign * kError);
+      }
+    }
+  };
+  add_products(kAbX, kAbXError, kAcY, kAcYError, 1);
+  add_products(kAbY, kAbYError, kAcX, kAcXError, -1);
+
+  if (epsilon == 0) {
+    return static_cast<Orientation>(determinant.sign());
+  }
+
+  // the tolerance is not representable exactly, hence both are compared in 'long double', which is
+  // wider than 'float' and 'double' (on x86), but not than 'long double' itself: its orientations
+  // are only approximate at the tolerance boundary (away from it, they are still exact).
+  const long double kAbXExtended = static_cast<long double>(kAbX) + kAbXError;
+  const long double kAbYExtended = static_cast<long double>(kAbY) + kAbYError;
+  const long double kTolerance =
+      epsilon * std::sqrt(kAbXExtended * kAbXExtended + kAbYExtended * kAbYExtended);
+  const long double kDeterminant = determinant.estimate();
+
+  if (std::abs(kDeterminant) <= kTolerance) {
+    return Orientation::kCollinear;
+  }
+  return kDeterminant > 0 ? Orientation::kCounterclockwise : Orientation::kClockwise;
+}
+
+} // namespace
+
+namespace internal {
+
+Orientation exactOrientation(Point2D<float> a, Point2D<float> b, Point2D<float> c, float epsilon) {
+  return exactOrientationOf(a, b, c, epsilon);
+}
+
+Orientation exactOrientation(Point2D<double> a,
+                             Point2D<double> b,
+                             Point2D<double> c,
+                             double epsilon) {
+  return exactOrientationOf(a, b, c, epsilon);
+}
+
+Orientation exactOrientation(Point2D<long double> a,
+                             Point2D<long double> b,
+                             Point2D<long double> c,
+                             long double epsilon) {
+  return exactOrientationOf(a, b, c, epsilon);
+}
+
+} // namespace internal
+
+void pointsOnSegmentMask(Point2D<float> first,
+                         Point2D<float> last,
+                         std::span<const float> xs,
+                         std::span<const float> ys,
+                         float epsilon,
+                         std::span<std::uint64_t> mask) {
+  kernels<float>().on_segment_mask(first, last, xs, ys, epsilon, mask);
+}
+
+void pointsOnSegmentMask(Point2D<double> first,
+                         Point2D<double> last,
+                         std::span<const double> xs,
+                         std::span<const double> ys,
+                         double epsilon,
+                         std::span<std::uint64_t> mask) {
+  kernels<double>().on_segment_mask(first, last, xs, ys, epsilon, mask);
+}
+
+void pointsOnSegmentMask(Point2D<long double> first,
+                         Point2D<long double> last,
+                         std::span<const long double> xs,
+                         std::span<const long double> ys,
+                         long double epsilon,
+                         std::span<std::uint64_t> mask) {
+  internal::onSegmentKernel<simd::None>(first, last, xs, ys, epsilon, mask);
+}
+
+void segmentIntersectionsMask(Point2D<float> first,
+                              Point2D<float> last,
+                              std::span<const float> first_xs,
+                              std::span<const float> first_ys,
+                              std::span<const float> last_xs,
+                              std::span<const float> last_ys,
+                              float epsilon,
+                              std::span<std::uint64_t> mask) {
+  kernels<float>().intersections_mask(first,
+                                      last,
+                                      first_xs,
+                                      first_ys,
+                                      last_xs,
+                                      last_ys,
+                                      epsilon,
+                                      mask);
+}
+
+void segmentIntersectionsMask(Point2D<double> first,
+                              Point2D<double> last,
+                              std::span<const double> first_xs,
+                              std::span<const double> first_ys,
+                              std::span<const double> last_xs,
+                              std::span<const double> last_ys,
+                              double epsilon,
+                              std::span<std::uint64_t> mask) {
+  kernels<double>().intersections_mask(first,
+                                       last,
+                                       first_xs,
+                                       first_ys,
+                                       last_xs,
+                                       last_ys,
+                                       epsilon,
+                                       mask);
+}
+
+void segmentIntersectionsMask(Point2D<long double> first,
+                              Point2D<long double> last,
+                              std::span<const long double> first_xs,
+                              std::span<const long double> first_ys,
+                              std::span<const long double> last_xs,
+                              std::span<const long double> last_ys,
+                              long double epsilon,
+                              std::span<std::uint64_t> mask) {
+  internal::intersectionsKernel<simd::None>(first,
+                                            last,
+                                            first_xs,
+                                            first_ys,
+                                            last_xs,
+                                            last_ys,
+                                            epsilon,
+                                            mask);
+}
+
+} // namespace robocin
@@ -0,0 +1,283 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_GEOMETRIC_PREDICATES_H
+#define ROBOCIN_UTILITY_GEOMETRIC_PREDICATES_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+#include "robocin/utility/point2d.h"
+
+namespace robocin {
+
+// Geometric predicates whose results are stable near their degenerate cases (e.g. three points
+// almost collinear), where the rounding errors of a naive evaluation may flip them, and which share
+// the tolerance model of 'fuzzy_compare.h': a point is on a line if its distance to the line is
+// within 'epsilon' (i.e. in the units of the coordinates, as 'AbsoluteComparison'), and on a
+// segment if it is also within the bounding box of the segment, whose coordinates are compared by
+// 'fuzzyCmpLessEqual'. With an epsilon of 0, they are the exact predicates.
+//
+// Each predicate is adaptive: its floating point evaluation is used whenever its rounding error is
+// provably smaller than the distance of its result to the tolerance, as in the filters of
+// Shewchuk's robust predicates, which is almost always; otherwise, the determinant is evaluated
+// exactly, by expansion arithmetic, and compared against the tolerance in 'long double' (hence only
+// approximately, at the tolerance boundary, when 'F' is 'long double'). The coordinates must be
+// finite, and far from the underflow and overflow thresholds of 'F'.
+
+enum class Orientation : std::int8_t {
+  kClockwise = -1,
+  kCollinear = 0,
+  kCounterclockwise = 1,
+};
+
+namespace internal {
+
+template <std::floating_point F>
+inline constexpr F kUnitRoundoff = std::numeric_limits<F>::epsilon() / 2;
+
+// Bounds of the rounding errors of the floating point evaluation of 'orientation': of its
+// determinant, relative to the sum of the magnitudes of its products (Shewchuk's 'ccwerrboundA',
+// with a margin for the rounding of the bound itself), and of its tolerance, relative to itself.
+template <std::floating_point F>
+inline constexpr F kDeterminantErrorBound = (4 + 16 * kUnitRoundoff<F>) * kUnitRoundoff<F>;
+
+template <std::floating_point F>
+inline constexpr F kToleranceErrorBound = 8 * kUnitRoundoff<F>;
+
+// The exact evaluation of 'orientation', when its floating point evaluation is not conclusive.
+Orientation exactOrientation(Point2D<float> a, Point2D<float> b, Point2D<float> c, float epsilon);
+Orientation exactOrientation(Point2D<double> a,
+                             Point2D<double> b,
+                             Point2D<double> c,
+                             double epsilon);
+Orientation exactOrientation(Point2D<long double> a,
+                             Point2D<long double> b,
+                             Point2D<long double> c,
+                             long double epsilon);
+
+// Whether 'point' lies within the bounding box of 'first' and 'last', within 'epsilon'.
+template <std::floating_point F>
+constexpr bool isInFuzzyBox(Point2D<F> point, Point2D<F> first, Point2D<F> last, F epsilon) {
+  return fuzzyCmpLessEqual(std::min(first.x, last.x), point.x, epsilon)
+         and fuzzyCmpLessEqual(point.x, std::max(first.x, last.x), epsilon)
+         and fuzzyCmpLessEqual(std::min(first.y, last.y), point.y, epsilon)
+         and fuzzyCmpLessEqual(point.y, std::max(first.y, last.y), epsilon);
+}
+
+constexpr bool areOpposite(Orientation lhs, Orientation rhs) {
+  return (lhs == Orientation::kClockwise and rhs == Orientation::kCounterclockwise)
+         or (lhs == Orientation::kCounterclockwise and rhs == Orientation::kClockwise);
+}
+
+} // namespace internal
+
+// Scalar functions --------------------------------------------------------------------------------
+
+// The side of the line from 'a' to 'b' on which 'c' lies: 'kCounterclockwise' on its left (i.e.
+// 'a', 'b' and 'c' turn counterclockwise, as the sign of '(b - a).cross(c - a)'), or 'kCollinear'
+// when 'c' is within 'epsilon' of the line. Every point is collinear with a degenerate line ('a'
+// equal to 'b').
+template <std::floating_point F>
+Orientation orientation(Point2D<F> a, Point2D<F> b, Point2D<F> c, F epsilon) {
+  const F kAbX = b.x - a.x;
+  const F kAbY = b.y - a.y;
+  const F kAcX = c.x - a.x;
+  const F kAcY = c.y - a.y;
+
+  const F kLeft = kAbX * kAcY;
+  const F kRight = kAbY * kAcX;
+  const F kDeterminant = kLeft - kRight;
+
+  // the determinant is the distance of 'c' to the line, scaled by the length of 'a' to 'b'.
+  const F kTolerance = epsilon * std::sqrt(kAbX * kAbX + kAbY * kAbY);
+  const F kError = internal::kDeterminantErrorBound<F> * (std::abs(kLeft) + std::abs(kRight))
+                   + internal::kToleranceErrorBound<F> * kTolerance;
+
+  if (kDeterminant > kTolerance + kError) {
+    return Orientation::kCounterclockwise;
+  }
+  if (kDeterminant < -(kTolerance + kError)) {
+    return Orientation::kClockwise;
+  }
+  if (std::abs(kDeterminant) < kTolerance - kError) {
+    return Orientation::kCollinear;
+  }
+  return internal::exactOrientation(a, b, c, epsilon);
+}
+
+template <std::floating_point F>
+Orientation orientation(Point2D<F> a, Point2D<F> b, Point2D<F> c)
+  requires(has_epsilon_v<F>)
+{
+  return orientation(a, b, c, epsilon_v<F>);
+}
+
+// Whether 'point' lies on the segment from 'first' to 'last': collinear with it, within 'epsilon',
+// and within its bounding box.
+template <std::floating_point F>
+bool isPointOnSegment(Point2D<F> point, Point2D<F> first, Point2D<F> last, F epsilon) {
+  return orientation(first, last, point, epsilon) == Orientation::kCollinear
+         and internal::isInFuzzyBox(point, first, last, epsilon);
+}
+
+template <std::floating_point F>
+bool isPointOnSegment(Point2D<F> point, Point2D<F> first, Point2D<F> last)
+  requires(has_epsilon_v<F>)
+{
+  return isPointOnSegment(point, first, last, epsilon_v<F>);
+}
+
+// Whether the segment from 'first' to 'last' and the one from 'other_first' to 'other_last'
+// intersect: either each one crosses the line of the other, or an endpoint of one lies on the
+// other (see 'isPointOnSegment'), e.g. when they touch or overlap.
+template <std::floating_point F>
+bool segmentsIntersect(Point2D<F> first,
+                       Point2D<F> last,
+                       Point2D<F> other_first,
+                       Point2D<F> other_last,
+                       F epsilon) {
+  const Orientation kOtherFirst = orientation(first, last, other_first, epsilon);
+  const Orientation kOtherLast = orientation(first, last, other_last, epsilon);
+  const Orientation kFirst = orientation(other_first, other_last, first, epsilon);
+  const Orientation kLast = orientation(other_first, other_last, last, epsilon);
+
+  if (internal::areOpposite(kOtherFirst, kOtherLast) and internal::areOpposite(kFirst, kLast)) {
+    return true;
+  }
+  return (kOtherFirst == Orientation::kCollinear
+          and internal::isInFuzzyBox(other_first, first, last, epsilon))
+         or (kOtherLast == Orientation::kCollinear
+             and internal::isInFuzzyBox(other_last, first, last, epsilon))
+         or (kFirst == Orientation::kCollinear
+             and internal::isInFuzzyBox(first, other_first, other_last, epsilon))
+         or (kLast == Orientation::kCollinear
+             and internal::isInFuzzyBox(last, other_first, other_last, epsilon));
+}
+
+template <std::floating_point F>
+bool segmentsIntersect(Point2D<F> first,
+                       Point2D<F> last,
+                       Point2D<F> other_first,
+                       Point2D<F> other_last)
+  requires(has_epsilon_v<F>)
+{
+  return segmentsIntersect(first, last, other_first, other_last, epsilon_v<F>);
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+// The following functions test one segment, from 'first' to 'last', against every point or segment
+// given by their coordinates (as 'Point2DArray' stores them), e.g. a pass line against the edges of
+// every obstacle, and write the packed bitmasks of 'fuzzyCmpEqualMask': 'mask' must have at least
+// 'fuzzyMaskSize(xs.size())' words. The floating point evaluation of the predicates is vectorized
+// for 'float' and 'double' whenever the target supports it, and the points or segments for which
+// it is not conclusive are tested by the scalar functions, hence the results are the same.
+
+// Whether every point lies on the segment (see 'isPointOnSegment').
+void pointsOnSegmentMask(Point2D<float> first,
+                         Point2D<float> last,
+                         std::span<const float> xs,
+                         std::span<const float> ys,
+                         float epsilon,
+                         std::span<std::uint64_t> mask);
+void pointsOnSegmentMask(Point2D<double> first,
+                         Point2D<double> last,
+                         std::span<const double> xs,
+                         std::span<const double> ys,
+                         double epsilon,
+                         std::span<std::uint64_t> mask);
+void pointsOnSegmentMask(Point2D<long double> first,
+                         Point2D<long double> last,
+                         std::span<const long double> xs,
+                         std::span<const long double> ys,
+                         long double epsilon,
+                         std::span<std::uint64_t> mask);
+
+// Whether the segment intersects every segment from ('first_xs[i]', 'first_ys[i]') to
+// ('last_xs[i]', 'last_ys[i]') (see 'segmentsIntersect').
+void segmentIntersectionsMask(Point2D<float> first,
+                              Point2D<float> last,
+                              std::span<const float> first_xs,
+                              std::span<const float> first_ys,
+                              std::span<const float> last_xs,
+                              std::span<const float> last_ys,
+                              float epsilon,
+                              std::span<std::uint64_t> mask);
+void segmentIntersectionsMask(Point2D<double> first,
+                              Point2D<double> last,
+                              std::span<const double> first_xs,
+                              std::span<const double> first_ys,
+                              std::span<const double> last_xs,
+                              std::span<const double> last_ys,
+                              double epsilon,
+                              std::span<std::uint64_t> mask);
+void segmentIntersectionsMask(Point2D<long double> first,
+                              Point2D<long double> last,
+                              std::span<const long double> first_xs,
+                              std::span<const long double> first_ys,
+                              std::span<const long double> last_xs,
+                              std::span<const long double> last_ys,
+                              long double epsilon,
+                              std::span<std::uint64_t> mask);
+
+// As above, but given 'Point2DArray's, using a given epsilon or the injected one.
+
+template <std::floating_point F>
+void pointsOnSegmentMask(Point2D<F> first,
+                         Point2D<F> last,
+                         const Point2DArray<F>& points,
+                         F epsilon,
+                         std::span<std::uint64_t> mask) {
+  pointsOnSegmentMask(first, last, points.xs(), points.ys(), epsilon, mask);
+}
+
+template <std::floating_point F>
+void pointsOnSegmentMask(Point2D<F> first,
+                         Point2D<F> last,
+                         const Point2DArray<F>& points,
+                         std::span<std::uint64_t> mask)
+  requires(has_epsilon_v<F>)
+{
+  pointsOnSegmentMask(first, last, points, epsilon_v<F>, mask);
+}
+
+// The i-th segment goes from 'firsts[i]' to 'lasts[i]'.
+template <std::floating_point F>
+void segmentIntersectionsMask(Point2D<F> first,
+                              Point2D<F> last,
+                              const Point2DArray<F>& firsts,
+                              const Point2DArray<F>& lasts,
+                              F epsilon,
+                              std::span<std::uint64_t> mask) {
+  segmentIntersectionsMask(first,
+                           last,
+                           firsts.xs(),
+                           firsts.ys(),
+                           lasts.xs(),
+                           lasts.ys(),
+                           epsilon,
+                           mask);
+}
+
+template <std::floating_point F>
+void segmentIntersectionsMask(Point2D<F> first,
+                              Point2D<F> last,
+                              const Point2DArray<F>& firsts,
+                              const Point2DArray<F>& lasts,
+                              std::span<std::uint64_t> mask)
+  requires(has_epsilon_v<F>)
+{
+  segmentIntersectionsMask(first, last, firsts, lasts, epsilon_v<F>, mask);
+}
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_GEOMETRIC_PREDICATES_H
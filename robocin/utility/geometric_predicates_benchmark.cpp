@@ -0,0 +1,125 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/geometric_predicates.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+template <class T>
+std::vector<Point2D<T>> randomPoints(std::size_t size, unsigned seed) {
+  std::mt19937 generator{seed}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{-4'500, 4'500};
+
+  std::vector<Point2D<T>> result(size);
+  for (Point2D<T>& point : result) {
+    point = {distribution(generator), distribution(generator)};
+  }
+  return result;
+}
+
+// The naive determinant, without filter nor tolerance: the lower bound of 'orientation'.
+template <class T>
+void BM_NaiveOrientation(benchmark::State& state) {
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(4'096, 42);
+
+  for (auto _ : state) {
+    for (std::size_t i = 2; i < kPoints.size(); ++i) {
+      const Point2D<T> kA = kPoints[i - 2];
+      benchmark::DoNotOptimize((kPoints[i - 1] - kA).cross(kPoints[i] - kA));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (kPoints.size() - 2)));
+}
+
+template <class T>
+void BM_Orientation(benchmark::State& state) {
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(4'096, 42);
+
+  for (auto _ : state) {
+    for (std::size_t i = 2; i < kPoints.size(); ++i) {
+      benchmark::DoNotOptimize(orientation(kPoints[i - 2], kPoints[i - 1], kPoints[i]));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (kPoints.size() - 2)));
+}
+
+// Collinear points, whose filter is never conclusive with an epsilon of 0: the exact evaluation.
+template <class T>
+void BM_ExactOrientation(benchmark::State& state) {
+  std::vector<Point2D<T>> points(4'096);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    points[i] = {static_cast<T>(i), static_cast<T>(2 * i)};
+  }
+
+  for (auto _ : state) {
+    for (std::size_t i = 2; i < points.size(); ++i) {
+      benchmark::DoNotOptimize(orientation(points[i - 2], points[i - 1], points[i], T{0}));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (points.size() - 2)));
+}
+
+BENCHMARK_TEMPLATE(BM_NaiveOrientation, float);
+BENCHMARK_TEMPLATE(BM_NaiveOrientation, double);
+BENCHMARK_TEMPLATE(BM_Orientation, float);
+BENCHMARK_TEMPLATE(BM_Orientation, double);
+BENCHMARK_TEMPLATE(BM_ExactOrientation, float);
+BENCHMARK_TEMPLATE(BM_ExactOrientation, double);
+
+// One segment against many: the scalar loop, and the batch overload.
+
+template <class T>
+void BM_SegmentsIntersect(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<Point2D<T>> kFirsts = randomPoints<T>(kSize, 42);
+  const std::vector<Point2D<T>> kLasts = randomPoints<T>(kSize, 43);
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kSize));
+
+  for (auto _ : state) {
+    std::ranges::fill(mask, 0);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      mask[i / 64] |=
+          std::uint64_t{segmentsIntersect<T>({-1'000, -500}, {2'000, 1'500}, kFirsts[i], kLasts[i])}
+          << (i % 64);
+    }
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSize));
+}
+
+template <class T>
+void BM_SegmentIntersectionsMask(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const Point2DArray<T> kFirsts{randomPoints<T>(kSize, 42)};
+  const Point2DArray<T> kLasts{randomPoints<T>(kSize, 43)};
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kSize));
+
+  for (auto _ : state) {
+    segmentIntersectionsMask<T>({-1'000, -500}, {2'000, 1'500}, kFirsts, kLasts, mask);
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSize));
+}
+
+BENCHMARK_TEMPLATE(BM_SegmentsIntersect, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SegmentsIntersect, double)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SegmentIntersectionsMask, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_SegmentIntersectionsMask, double)->Arg(16)->Arg(4'096);
+
+} // namespace
+} // namespace robocin
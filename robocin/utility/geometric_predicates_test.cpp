@@ -0,0 +1,235 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/geometric_predicates.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+template <class T>
+Point2D<T> nextAfter(Point2D<T> point, int x_steps, int y_steps) {
+  for (; x_steps > 0; --x_steps) {
+    point.x = std::nextafter(point.x, std::numeric_limits<T>::infinity());
+  }
+  for (; y_steps > 0; --y_steps) {
+    point.y = std::nextafter(point.y, std::numeric_limits<T>::infinity());
+  }
+  return point;
+}
+
+// Scalar functions --------------------------------------------------------------------------------
+
+// The points around (0.5, 0.5), a few units in the last place apart, against the line of (12, 12)
+// and (24, 24): the naive determinant gets most of their orientations wrong, and inconsistent
+// among the permutations of the same three points.
+TYPED_TEST(FloatingPointTest, OrientationIsExactNearCollinearity) {
+  using T = TypeParam;
+
+  const Point2D<T> kA{12, 12};
+  const Point2D<T> kB{24, 24};
+
+  for (int i = 0; i < 32; ++i) {
+    for (int j = 0; j < 32; ++j) {
+      const Point2D<T> kC = nextAfter(Point2D<T>{T{0.5}, T{0.5}}, i, j);
+      // the determinant is '12 * (c.y - c.x)'.
+      const auto kExpected = static_cast<Orientation>((j > i) - (j < i));
+
+      EXPECT_EQ(orientation(kA, kB, kC, T{0}), kExpected) << i << ' ' << j;
+      EXPECT_EQ(orientation(kB, kC, kA, T{0}), kExpected) << i << ' ' << j;
+      EXPECT_EQ(orientation(kC, kA, kB, T{0}), kExpected) << i << ' ' << j;
+      EXPECT_EQ(orientation(kB, kA, kC, T{0}), static_cast<Orientation>(-(j > i) + (j < i)))
+          << i << ' ' << j;
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, OrientationToleratesTheDistanceToTheLine) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const Point2D<T> kA{0, 0};
+  const Point2D<T> kB{10, 0};
+
+  EXPECT_EQ(orientation(kA, kB, {5, 2 * kEpsilon}), Orientation::kCounterclockwise);
+  EXPECT_EQ(orientation(kA, kB, {5, -2 * kEpsilon}), Orientation::kClockwise);
+  EXPECT_EQ(orientation(kA, kB, {5, kEpsilon / 2}), Orientation::kCollinear);
+  EXPECT_EQ(orientation(kA, kB, {-100, -kEpsilon / 2}), Orientation::kCollinear);
+
+  // the tolerance is a distance, hence independent of the length of the line.
+  EXPECT_EQ(orientation(kA, Point2D<T>{1'000, 0}, {5, kEpsilon / 2}), Orientation::kCollinear);
+  EXPECT_EQ(orientation(kA, Point2D<T>{T{0.1}, 0}, {5, 2 * kEpsilon}),
+            Orientation::kCounterclockwise);
+
+  // at the tolerance, the filter is not conclusive.
+  EXPECT_EQ(orientation(kA, kB, {5, kEpsilon}), Orientation::kCollinear);
+  EXPECT_EQ(orientation(kA, kB, {5, kEpsilon}, kEpsilon / 2), Orientation::kCounterclockwise);
+
+  // every point is collinear with a degenerate line.
+  EXPECT_EQ(orientation(kB, kB, {5, 5}), Orientation::kCollinear);
+}
+
+TYPED_TEST(FloatingPointTest, PointOnSegment) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const Point2D<T> kFirst{-1, -1};
+  const Point2D<T> kLast{3, 1};
+
+  EXPECT_TRUE(isPointOnSegment(kFirst, kFirst, kLast));
+  EXPECT_TRUE(isPointOnSegment(kLast, kFirst, kLast));
+  EXPECT_TRUE(isPointOnSegment({1, 0}, kFirst, kLast));
+  EXPECT_TRUE(isPointOnSegment({1, kEpsilon / 2}, kFirst, kLast));
+  EXPECT_TRUE(isPointOnSegment({3 + kEpsilon / 2, 1}, kFirst, kLast));
+
+  EXPECT_FALSE(isPointOnSegment({1, 2 * kEpsilon}, kFirst, kLast));
+  EXPECT_FALSE(isPointOnSegment({5, 2}, kFirst, kLast));
+  EXPECT_FALSE(isPointOnSegment({1, kEpsilon / 2}, kFirst, kLast, T{0}));
+
+  // a degenerate segment is its only point.
+  EXPECT_TRUE(isPointOnSegment({kEpsilon / 2, 0}, Point2D<T>{}, Point2D<T>{}));
+  EXPECT_FALSE(isPointOnSegment({2 * kEpsilon, 0}, Point2D<T>{}, Point2D<T>{}));
+}
+
+TYPED_TEST(FloatingPointTest, SegmentsIntersect) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const Point2D<T> kFirst{0, 0};
+  const Point2D<T> kLast{4, 4};
+
+  // crossing, and apart.
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {0, 4}, {4, 0}));
+  EXPECT_FALSE(segmentsIntersect(kFirst, kLast, {0, 4}, {1, 3}));
+  EXPECT_FALSE(segmentsIntersect(kFirst, kLast, {1, 0}, {5, 4}));
+
+  // touching: an endpoint on the other segment, or shared.
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {2, 2}, {3, 0}));
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {4, 4}, {5, 0}));
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {2 + kEpsilon / 2, 2}, {3, 0}));
+  EXPECT_FALSE(segmentsIntersect(kFirst, kLast, {2 + 2 * kEpsilon, 2}, {3, 0}));
+
+  // collinear: overlapping, or apart.
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {3, 3}, {6, 6}));
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {-1, -1}, {5, 5}));
+  EXPECT_TRUE(segmentsIntersect(kFirst, kLast, {4 + kEpsilon / 2, 4}, {6, 6}));
+  EXPECT_FALSE(segmentsIntersect(kFirst, kLast, {5, 5}, {6, 6}));
+
+  // symmetric.
+  EXPECT_TRUE(segmentsIntersect<T>({2, 2}, {3, 0}, kFirst, kLast));
+  EXPECT_TRUE(segmentsIntersect<T>({0, 4}, {4, 0}, kLast, kFirst));
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+
+// Random points and segments in a small region, so that many are close to the segment, with every
+// third point on it, so that the lanes decided by the scalar functions are tested as well.
+template <class T>
+std::vector<Point2D<T>> points(std::size_t size, Point2D<T> first, Point2D<T> last, unsigned seed) {
+  std::mt19937 generator{seed}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{-2, 2};
+  std::uniform_real_distribution<T> unit{0, 1};
+
+  std::vector<Point2D<T>> result(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (i % 3 == 0) {
+      result[i] = first + (last - first) * unit(generator);
+    } else {
+      result[i] = {distribution(generator), distribution(generator)};
+    }
+  }
+  return result;
+}
+
+TYPED_TEST(FloatingPointTest, BatchMatchesTheScalarFunctions) {
+  using T = TypeParam;
+
+  const Point2D<T> kFirst{-1, T{-0.5}};
+  const Point2D<T> kLast{1, T{0.75}};
+
+  // the kernels of every instruction set, which the long double overloads ignore.
+  for (const SimdIsa kIsa : kSimdIsas) {
+    if (not isSimdIsaSupported(kIsa)) {
+      continue;
+    }
+    const ScopedSimdIsa kScope{kIsa};
+
+    // sizes around the widest vectors, so that both the vectorized and the remaining points run.
+    for (const std::size_t kSize : {1, 7, 15, 16, 17, 33, 1'000}) {
+      const auto kSeed = static_cast<unsigned>(kSize);
+      const Point2DArray<T> kPoints{points<T>(kSize, kFirst, kLast, kSeed)};
+      const Point2DArray<T> kLasts{points<T>(kSize, kFirst, kLast, kSeed + 1)};
+
+      std::vector<std::uint64_t> on_segment(fuzzyMaskSize(kSize), ~std::uint64_t{0});
+      pointsOnSegmentMask(kFirst, kLast, kPoints, on_segment);
+
+      std::vector<std::uint64_t> intersections(fuzzyMaskSize(kSize), ~std::uint64_t{0});
+      segmentIntersectionsMask(kFirst, kLast, kPoints, kLasts, intersections);
+
+      for (std::size_t i = 0; i < kSize; ++i) {
+        EXPECT_EQ((on_segment[i / 64] >> (i % 64)) & 1,
+                  isPointOnSegment(kPoints[i], kFirst, kLast))
+            << simdIsaName(kIsa) << ' ' << kSize << ' ' << i;
+        EXPECT_EQ((intersections[i / 64] >> (i % 64)) & 1,
+                  segmentsIntersect(kFirst, kLast, kPoints[i], kLasts[i]))
+            << simdIsaName(kIsa) << ' ' << kSize << ' ' << i;
+      }
+
+      // the unused bits of the last word are cleared.
+      if (kSize % 64 != 0) {
+        EXPECT_EQ(on_segment.back() >> (kSize % 64), 0) << simdIsaName(kIsa) << ' ' << kSize;
+        EXPECT_EQ(intersections.back() >> (kSize % 64), 0) << simdIsaName(kIsa) << ' ' << kSize;
+      }
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, BatchIsExactNearCollinearity) {
+  using T = TypeParam;
+
+  const Point2D<T> kFirst{12, 12};
+  const Point2D<T> kLast{24, 24};
+
+  std::vector<T> xs;
+  std::vector<T> ys;
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      const Point2D<T> kPoint = nextAfter(Point2D<T>{18, 18}, i, j);
+      xs.push_back(kPoint.x);
+      ys.push_back(kPoint.y);
+    }
+  }
+
+  // exactly on the segment only when both coordinates are equal.
+  std::vector<std::uint64_t> mask(1);
+  pointsOnSegmentMask(kFirst, kLast, xs, ys, T{0}, mask);
+  EXPECT_EQ(mask[0], 0x8040201008040201);
+}
+
+} // namespace
+} // namespace robocin
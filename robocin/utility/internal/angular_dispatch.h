@@ -0,0 +1,51 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file declares the kernels of the batch overloads of 'angular.h', per instruction set (see
+// 'cpu_dispatch.h'). It should be included in the library source files, but not in the public
+// headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_ANGULAR_DISPATCH_H
+#define ROBOCIN_UTILITY_INTERNAL_ANGULAR_DISPATCH_H
+
+#include <concepts>
+#include <span>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/cpu_dispatch.h"
+
+namespace robocin::internal {
+
+template <std::floating_point F>
+struct AngularKernels {
+  using Unary = void (*)(std::span<const F>, std::span<F>);
+  using Binary = void (*)(std::span<const F>, std::span<const F>, std::span<F>);
+
+  Unary degrees_to_radians;
+  Unary radians_to_degrees;
+  Unary normalize_angles;
+  Binary smallest_angle_diffs;
+  Binary abs_smallest_angle_diffs;
+};
+
+// The kernels of an instruction set, for each type it vectorizes.
+struct AngularKernelSet {
+  AngularKernels<float> for_float;
+  AngularKernels<double> for_double;
+};
+
+// The kernels of each instruction set, defined by the source file which compiles them.
+extern const AngularKernelSet kScalarAngularKernels;
+#if defined(__SSE2__)
+extern const AngularKernelSet kSse2AngularKernels;
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+extern const AngularKernelSet kAvx2AngularKernels;
+extern const AngularKernelSet kAvx512AngularKernels;
+#endif
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_ANGULAR_DISPATCH_H
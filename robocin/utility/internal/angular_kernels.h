@@ -0,0 +1,158 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file defines the kernels of the batch overloads of 'angular.h', and is included by each
+// source file which compiles them for an instruction set (see 'angular_dispatch.h'), after the
+// '#pragma GCC target' of that instruction set, if any. Everything it defines is local to the file
+// including it, so that the linker never merges the kernels of different instruction sets.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_ANGULAR_KERNELS_H
+#define ROBOCIN_UTILITY_INTERNAL_ANGULAR_KERNELS_H
+
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/internal/angular_dispatch.h"
+#include "robocin/utility/internal/simd_algorithm.h"
+
+namespace robocin::internal {
+namespace { // NOLINT(*-anonymous-namespace-in-header)
+
+template <class V>
+typename V::vector normalizeLanes(typename V::vector angles) {
+  using F = typename V::value_type;
+
+  static constexpr std::uint64_t kAllLanes = (std::uint64_t{1} << V::kLanes) - 1;
+
+  if (V::bits(V::lessEqual(V::abs(angles), V::broadcast(TwoPi<F>::kMaxReducible))) != kAllLanes)
+      [[unlikely]] {
+    F lanes[V::kLanes]; // NOLINT(*-avoid-c-arrays)
+    V::store(lanes, angles);
+    for (F& lane : lanes) {
+      lane = normalizeAngle(lane);
+    }
+    return V::load(lanes);
+  }
+
+  const auto kPi = V::broadcast(std::numbers::pi_v<F>);
+  const auto kMinusPi = V::broadcast(-std::numbers::pi_v<F>);
+  const auto k2Pi = V::broadcast(TwoPi<F>::kValue);
+
+  // mimics 'std::fmod': the turn count is truncated towards zero.
+  const auto turns = V::trunc(V::mul(angles, V::broadcast(TwoPi<F>::kInverse)));
+
+  auto result = V::sub(angles, V::mul(turns, V::broadcast(TwoPi<F>::kHigh)));
+  result = V::sub(result, V::mul(turns, V::broadcast(TwoPi<F>::kLow)));
+
+  result = V::select(V::less(result, kMinusPi), V::add(result, k2Pi), result);
+  result = V::select(V::greater(result, kPi), V::sub(result, k2Pi), result);
+  return result;
+}
+
+// Operations --------------------------------------------------------------------------------------
+// Each operation provides a 'scalar' overload, which is the reference implementation, and a
+// 'vectorized' one for a given simd::Vector.
+
+struct DegreesToRadians {
+  template <std::floating_point F>
+  static F scalar(F degrees) {
+    return degreesToRadians(degrees);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector degrees) {
+    using F = typename V::value_type;
+
+    return V::mul(degrees, V::broadcast(degreesToRadians(F{1})));
+  }
+};
+
+struct RadiansToDegrees {
+  template <std::floating_point F>
+  static F scalar(F radians) {
+    return radiansToDegrees(radians);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector radians) {
+    using F = typename V::value_type;
+
+    return V::mul(radians, V::broadcast(radiansToDegrees(F{1})));
+  }
+};
+
+struct NormalizeAngle {
+  template <std::floating_point F>
+  static F scalar(F angle) {
+    return normalizeAngle(angle);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector angles) {
+    return normalizeLanes<V>(angles);
+  }
+};
+
+struct SmallestAngleDiff {
+  template <std::floating_point F>
+  static F scalar(F lhs, F rhs) {
+    return smallestAngleDiff(lhs, rhs);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector lhs, typename V::vector rhs) {
+    return normalizeLanes<V>(V::sub(rhs, lhs));
+  }
+};
+
+struct AbsSmallestAngleDiff {
+  template <std::floating_point F>
+  static F scalar(F lhs, F rhs) {
+    return absSmallestAngleDiff(lhs, rhs);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector lhs, typename V::vector rhs) {
+    return V::abs(normalizeLanes<V>(V::sub(rhs, lhs)));
+  }
+};
+
+// Kernels -----------------------------------------------------------------------------------------
+
+template <class Isa, class Op, std::floating_point F>
+void unaryKernel(std::span<const F> input, std::span<F> output) {
+  simd::transform<Isa, Op>(input, output);
+}
+
+template <class Isa, class Op, std::floating_point F>
+void binaryKernel(std::span<const F> lhs, std::span<const F> rhs, std::span<F> output) {
+  simd::transform<Isa, Op>(lhs, rhs, output);
+}
+
+template <class Isa, std::floating_point F>
+constexpr AngularKernels<F> angularKernels() {
+  return {
+      .degrees_to_radians = &unaryKernel<Isa, DegreesToRadians, F>,
+      .radians_to_degrees = &unaryKernel<Isa, RadiansToDegrees, F>,
+      .normalize_angles = &unaryKernel<Isa, NormalizeAngle, F>,
+      .smallest_angle_diffs = &binaryKernel<Isa, SmallestAngleDiff, F>,
+      .abs_smallest_angle_diffs = &binaryKernel<Isa, AbsSmallestAngleDiff, F>,
+  };
+}
+
+// The kernels of 'Isa', which must be either 'simd::None' or one whose vectors are available in the
+// file including this one.
+template <class Isa>
+constexpr AngularKernelSet angularKernelSet() {
+  return {.for_float = angularKernels<Isa, float>(), .for_double = angularKernels<Isa, double>()};
+}
+
+} // namespace
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_ANGULAR_KERNELS_H
@@ -0,0 +1,51 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file declares the kernels of the batch overloads of 'angular_math.h', per instruction set
+// (see 'cpu_dispatch.h'). It should be included in the library source files, but not in the public
+// headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_DISPATCH_H
+#define ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_DISPATCH_H
+
+#include <concepts>
+#include <span>
+
+#include "robocin/utility/angular_math.h"
+#include "robocin/utility/cpu_dispatch.h"
+
+namespace robocin::internal {
+
+template <std::floating_point F>
+struct AngularMathKernels {
+  using Unary = void (*)(std::span<const F>, std::span<F>);
+  using Binary = void (*)(std::span<const F>, std::span<const F>, std::span<F>);
+  using SinCos = void (*)(std::span<const F>, std::span<F>, std::span<F>);
+
+  Unary sin;
+  Unary cos;
+  SinCos sin_cos;
+  Binary atan2;
+};
+
+// The kernels of an instruction set, for each type it vectorizes.
+struct AngularMathKernelSet {
+  AngularMathKernels<float> for_float;
+  AngularMathKernels<double> for_double;
+};
+
+// The kernels of each instruction set, defined by the source file which compiles them.
+extern const AngularMathKernelSet kScalarAngularMathKernels;
+#if defined(__SSE2__)
+extern const AngularMathKernelSet kSse2AngularMathKernels;
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+extern const AngularMathKernelSet kAvx2AngularMathKernels;
+extern const AngularMathKernelSet kAvx512AngularMathKernels;
+#endif
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_DISPATCH_H
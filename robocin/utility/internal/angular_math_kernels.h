@@ -0,0 +1,246 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file defines the kernels of the batch overloads of 'angular_math.h', and is included by each
+// source file which compiles them for an instruction set (see 'angular_math_dispatch.h'), after the
+// '#pragma GCC target' of that instruction set, if any. As 'angular_kernels.h', everything it
+// defines is local to the file including it.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_KERNELS_H
+#define ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_KERNELS_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#include "robocin/utility/angular_math.h"
+#include "robocin/utility/internal/angular_math_dispatch.h"
+#include "robocin/utility/internal/simd_algorithm.h"
+
+namespace robocin::internal {
+namespace { // NOLINT(*-anonymous-namespace-in-header)
+
+// same as 'horner'.
+template <const auto& Coefficients, class V>
+typename V::vector hornerLanes(typename V::vector value) {
+  using F = typename V::value_type;
+
+  constexpr auto& kCoefficients = kCoefficientsAs<F, Coefficients>;
+
+  auto result = V::broadcast(kCoefficients.back());
+  for (std::size_t i = kCoefficients.size() - 1; i-- > 0;) {
+    result = V::add(V::mul(result, value), V::broadcast(kCoefficients[i]));
+  }
+  return result;
+}
+
+// same as 'roundToNearest'.
+template <class V>
+typename V::vector roundLanes(typename V::vector value) {
+  const auto kShifter = V::broadcast(kRoundingShifter<typename V::value_type>);
+
+  return V::sub(V::add(value, kShifter), kShifter);
+}
+
+template <class V>
+struct SinCosLanes {
+  typename V::vector sin;
+  typename V::vector cos;
+};
+
+// same as 'fastSinCos', with the quadrant selection made by masks.
+template <class V>
+SinCosLanes<V> sinCosLanes(typename V::vector angles) {
+  using F = typename V::value_type;
+  using HalfPi = HalfPi<F>;
+  using Polynomial = SinCosPolynomial<sinCosTerms<F>()>;
+
+  static constexpr std::uint64_t kAllLanes = (std::uint64_t{1} << V::kLanes) - 1;
+
+  if (V::bits(V::lessEqual(V::abs(angles), V::broadcast(HalfPi::kMaxReducible))) != kAllLanes)
+      [[unlikely]] {
+    F sines[V::kLanes];   // NOLINT(*-avoid-c-arrays)
+    F cosines[V::kLanes]; // NOLINT(*-avoid-c-arrays)
+    V::store(sines, angles);
+    for (std::size_t i = 0; i < V::kLanes; ++i) {
+      const auto [kSin, kCos] = robocin::fastSinCos(sines[i]);
+      sines[i] = kSin;
+      cosines[i] = kCos;
+    }
+    return {V::load(sines), V::load(cosines)};
+  }
+
+  const auto quadrant = roundLanes<V>(V::mul(angles, V::broadcast(HalfPi::kInverse)));
+
+  auto reduced = V::sub(angles, V::mul(quadrant, V::broadcast(HalfPi::kHigh)));
+  reduced = V::sub(reduced, V::mul(quadrant, V::broadcast(HalfPi::kLow)));
+  const auto squared = V::mul(reduced, reduced);
+
+  const auto sin = V::mul(reduced, hornerLanes<Polynomial::kSin, V>(squared));
+  const auto cos = hornerLanes<Polynomial::kCos, V>(squared);
+
+  // the quadrant modulo 4, computed exactly: the fractional part of 'quadrant / 4' is a multiple of
+  // 1 / 4, so subtracting 3 / 8 before rounding it gives its floor.
+  const auto quarters = V::mul(quadrant, V::broadcast(F{0.25}));
+  const auto modulo4 = V::mul(
+      V::sub(quarters, roundLanes<V>(V::sub(quarters, V::broadcast(F{0.375})))),
+      V::broadcast(F{4}));
+  const auto halves = V::mul(modulo4, V::broadcast(F{0.5}));
+
+  // quadrants 1 and 3 swap sin and cos, 2 and 3 negate sin, 1 and 2 negate cos.
+  const auto is_odd =
+      V::greater(V::abs(V::sub(halves, roundLanes<V>(halves))), V::broadcast(F{0.25}));
+  const auto is_sin_negative = V::greater(modulo4, V::broadcast(F{1.5}));
+  const auto is_cos_negative =
+      V::less(V::abs(V::sub(modulo4, V::broadcast(F{1.5}))), V::broadcast(F{1}));
+
+  const auto zero = V::broadcast(F{0});
+  const auto swapped_sin = V::select(is_odd, cos, sin);
+  const auto swapped_cos = V::select(is_odd, sin, cos);
+
+  return {V::select(is_sin_negative, V::sub(zero, swapped_sin), swapped_sin),
+          V::select(is_cos_negative, V::sub(zero, swapped_cos), swapped_cos)};
+}
+
+// same as 'fastAtan2', with the branches made by masks.
+template <class V>
+typename V::vector atan2Lanes(typename V::vector y, typename V::vector x) {
+  using F = typename V::value_type;
+  using Polynomial = AtanPolynomial<atanTerms<F>()>;
+
+  static constexpr std::uint64_t kAllLanes = (std::uint64_t{1} << V::kLanes) - 1;
+  static constexpr F kPi = std::numbers::pi_v<F>;
+
+  const auto abs_x = V::abs(x);
+  const auto abs_y = V::abs(y);
+  const auto max_finite = V::broadcast(std::numeric_limits<F>::max());
+
+  if ((V::bits(V::lessEqual(abs_x, max_finite)) & V::bits(V::lessEqual(abs_y, max_finite)))
+      != kAllLanes) [[unlikely]] {
+    F lhs[V::kLanes]; // NOLINT(*-avoid-c-arrays)
+    F rhs[V::kLanes]; // NOLINT(*-avoid-c-arrays)
+    V::store(lhs, y);
+    V::store(rhs, x);
+    for (std::size_t i = 0; i < V::kLanes; ++i) {
+      lhs[i] = robocin::fastAtan2(lhs[i], rhs[i]);
+    }
+    return V::load(lhs);
+  }
+
+  const auto zero = V::broadcast(F{0});
+  const auto one = V::broadcast(F{1});
+  const auto max = V::max(abs_x, abs_y);
+
+  const auto ratio = V::select(V::greater(max, zero), V::div(V::min(abs_x, abs_y), max), zero);
+  const auto is_reduced = V::greater(ratio, V::broadcast(std::numbers::sqrt2_v<F> - 1));
+  const auto reduced =
+      V::select(is_reduced, V::div(V::sub(ratio, one), V::add(ratio, one)), ratio);
+
+  auto result = V::mul(reduced, hornerLanes<Polynomial::kAtan, V>(V::mul(reduced, reduced)));
+  result = V::select(is_reduced, V::add(result, V::broadcast(kPi / 4)), result);
+  result = V::select(V::greater(abs_y, abs_x), V::sub(V::broadcast(kPi / 2), result), result);
+  result = V::select(V::less(V::copySign(one, x), zero), V::sub(V::broadcast(kPi), result), result);
+  return V::copySign(result, y);
+}
+
+// Operations --------------------------------------------------------------------------------------
+// Each operation provides a 'scalar' overload, which is the reference implementation, and a
+// 'vectorized' one for a given simd::Vector.
+
+struct FastSin {
+  template <std::floating_point F>
+  static F scalar(F angle) {
+    return robocin::fastSin(angle);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector angles) {
+    return sinCosLanes<V>(angles).sin;
+  }
+};
+
+struct FastCos {
+  template <std::floating_point F>
+  static F scalar(F angle) {
+    return robocin::fastCos(angle);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector angles) {
+    return sinCosLanes<V>(angles).cos;
+  }
+};
+
+struct FastAtan2 {
+  template <std::floating_point F>
+  static F scalar(F y, F x) {
+    return robocin::fastAtan2(y, x);
+  }
+
+  template <class V>
+  static typename V::vector vectorized(typename V::vector y, typename V::vector x) {
+    return atan2Lanes<V>(y, x);
+  }
+};
+
+// Kernels -----------------------------------------------------------------------------------------
+
+template <class Isa, class Op, std::floating_point F>
+void unaryKernel(std::span<const F> input, std::span<F> output) {
+  simd::transform<Isa, Op>(input, output);
+}
+
+template <class Isa, class Op, std::floating_point F>
+void binaryKernel(std::span<const F> lhs, std::span<const F> rhs, std::span<F> output) {
+  simd::transform<Isa, Op>(lhs, rhs, output);
+}
+
+template <class Isa, std::floating_point F>
+void sinCosKernel(std::span<const F> angles, std::span<F> sines, std::span<F> cosines) {
+  assert(angles.size() == sines.size() and angles.size() == cosines.size());
+
+  std::size_t index = 0;
+  if constexpr (simd::kHasVector<Isa, F>) {
+    using V = simd::Vector<Isa, F>;
+
+    for (; index + V::kLanes <= angles.size(); index += V::kLanes) {
+      const SinCosLanes<V> kResult = sinCosLanes<V>(V::load(&angles[index]));
+      V::store(&sines[index], kResult.sin);
+      V::store(&cosines[index], kResult.cos);
+    }
+  }
+  for (; index < angles.size(); ++index) {
+    const auto [kSin, kCos] = robocin::fastSinCos(angles[index]);
+    sines[index] = kSin;
+    cosines[index] = kCos;
+  }
+}
+
+template <class Isa, std::floating_point F>
+constexpr AngularMathKernels<F> angularMathKernels() {
+  return {
+      .sin = &unaryKernel<Isa, FastSin, F>,
+      .cos = &unaryKernel<Isa, FastCos, F>,
+      .sin_cos = &sinCosKernel<Isa, F>,
+      .atan2 = &binaryKernel<Isa, FastAtan2, F>,
+  };
+}
+
+// The kernels of 'Isa', which must be either 'simd::None' or one whose vectors are available in the
+// file including this one.
+template <class Isa>
+constexpr AngularMathKernelSet angularMathKernelSet() {
+  return {.for_float = angularMathKernels<Isa, float>(),
+          .for_double = angularMathKernels<Isa, double>()};
+}
+
+} // namespace
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_KERNELS_H
@@ -0,0 +1,393 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// Minimax polynomials used by 'angular_math.h', found by the Remez exchange algorithm (absolute
+// error, 80-digit arithmetic). Each specialization is indexed by its number of terms and holds its
+// worst-case approximation error, i.e. disregarding rounding errors.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_POLYNOMIALS_H
+#define ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_POLYNOMIALS_H
+
+#include <array>
+#include <cstddef>
+
+namespace robocin::internal {
+
+// sin and cos, for |r| <= pi / 4 + 1e-3 -----------------------------------------------------------
+// (the margin covers the rounding of the quadrant, in the reduction of the angle).
+//  -- sin(r) ~= r * (kSin[0] + kSin[1] * r^2 + kSin[2] * r^4 + ...);
+//  -- cos(r) ~= kCos[0] + kCos[1] * r^2 + kCos[2] * r^4 + ....
+template <std::size_t Terms>
+struct SinCosPolynomial;
+
+inline constexpr std::size_t kMinSinCosTerms = 2;
+inline constexpr std::size_t kMaxSinCosTerms = 9;
+
+template <>
+struct SinCosPolynomial<2> {
+  static constexpr long double kMaxError = 1.94e-03L;
+  static constexpr std::array<long double, 2> kSin{
+      9.990265369573147340598e-01L,
+      -1.603281660951622366712e-01L,
+  };
+  static constexpr std::array<long double, 2> kCos{
+      9.980688465433338154501e-01L,
+      -4.747577627168432253968e-01L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<3> {
+  static constexpr long double kMaxError = 1.01e-05L;
+  static constexpr std::array<long double, 3> kSin{
+      9.999983707997496630939e-01L,
+      -1.666172268929020320249e-01L,
+      8.135997733444438981162e-03L,
+  };
+  static constexpr std::array<long double, 3> kCos{
+      9.999899591504455710948e-01L,
+      -4.997066648216397198653e-01L,
+      4.039534767846355641844e-02L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<4> {
+  static constexpr long double kMaxError = 2.79e-08L;
+  static constexpr std::array<long double, 4> kSin{
+      9.999999984342440873166e-01L,
+      -1.666665329316015373191e-01L,
+      8.332077150497715538723e-03L,
+      -1.950298352517279406612e-04L,
+  };
+  static constexpr std::array<long double, 4> kCos{
+      9.999999721424156470624e-01L,
+      -4.999985560334174606193e-01L,
+      4.165496789101235735656e-02L,
+      -1.358514412111315966313e-03L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<5> {
+  static constexpr long double kMaxError = 4.80e-11L;
+  static constexpr std::array<long double, 5> kSin{
+      9.999999999991335704835e-01L,
+      -1.666666664960376942444e-01L,
+      8.333330048625948037487e-03L,
+      -1.983947496388593195927e-04L,
+      2.719150060535247746545e-06L,
+  };
+  static constexpr std::array<long double, 5> kCos{
+      9.999999999519952027576e-01L,
+      -4.999999961151183044389e-01L,
+      4.166661635811999559235e-02L,
+      -1.388660769011019707091e-03L,
+      2.437886336585212905054e-05L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<6> {
+  static constexpr long double kMaxError = 5.64e-14L;
+  static constexpr std::array<long double, 6> kSin{
+      9.999999999999996880429e-01L,
+      -1.666666666665434941539e-01L,
+      8.333333328930079850713e-03L,
+      -1.984126553162778648964e-04L,
+      2.755566359834445970045e-06L,
+      -2.478027738254176545497e-08L,
+  };
+  static constexpr std::array<long double, 6> kCos{
+      9.999999999999436524122e-01L,
+      -4.999999999934359854709e-01L,
+      4.166666654275875780649e-02L,
+      -1.388888033342245867824e-03L,
+      2.479891608706174904850e-05L,
+      -2.717251222591905359444e-07L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<7> {
+  static constexpr long double kMaxError = 1.96e-16L;
+  static constexpr std::array<long double, 7> kSin{
+      9.999999999999999999210e-01L,
+      -1.666666666666666101924e-01L,
+      8.333333333329858604110e-03L,
+      -1.984126983563211402441e-04L,
+      2.755731560861930675068e-06L,
+      -2.505103828830253290748e-08L,
+      1.591183197186143996290e-10L,
+  };
+  static constexpr std::array<long double, 7> kCos{
+      9.999999999999999994894e-01L,
+      -4.999999999999992528095e-01L,
+      4.166666666661685132260e-02L,
+      -1.388888888061437985542e-03L,
+      2.480158194146058189421e-05L,
+      -2.755572405229816069889e-07L,
+      2.065655139830523145063e-09L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<8> {
+  static constexpr long double kMaxError = 1.70e-19L;
+  static constexpr std::array<long double, 8> kSin{
+      1.000000000000000000000e+00L,
+      -1.666666666666666666489e-01L,
+      8.333333333333331560059e-03L,
+      -1.984126984126533070236e-04L,
+      2.755731921948895799144e-06L,
+      -2.505210625760491762857e-08L,
+      1.605853170672116163653e-10L,
+      -7.586511154709655939812e-13L,
+  };
+  static constexpr std::array<long double, 8> kCos{
+      9.999999999999999999999e-01L,
+      -4.999999999999999997330e-01L,
+      4.166666666666663782654e-02L,
+      -1.388888888888138323637e-03L,
+      2.480158729403257741639e-05L,
+      -2.755731563146135410597e-07L,
+      2.087588973027232229749e-09L,
+      -1.136782160040264627240e-11L,
+  };
+};
+
+template <>
+struct SinCosPolynomial<9> {
+  static constexpr long double kMaxError = 1.16e-22L;
+  static constexpr std::array<long double, 9> kSin{
+      1.000000000000000000000e+00L,
+      -1.666666666666666666667e-01L,
+      8.333333333333333332707e-03L,
+      -1.984126984126983887919e-04L,
+      2.755731922398236149470e-06L,
+      -2.505210838294898461732e-08L,
+      1.605904290535825127677e-10L,
+      -7.646974847159204826033e-13L,
+      2.791813448391818961393e-15L,
+  };
+  static constexpr std::array<long double, 9> kCos{
+      1.000000000000000000000e+00L,
+      -4.999999999999999999999e-01L,
+      4.166666666666666665530e-02L,
+      -1.388888888888888444704e-03L,
+      2.480158730158068106032e-05L,
+      -2.755731921928631966113e-07L,
+      2.087675522654072047367e-09L,
+      -1.147038772336544257253e-11L,
+      4.742204322988856501810e-14L,
+  };
+};
+
+// atan, for 0 <= t <= sqrt(2) - 1 -----------------------------------------------------------------
+//  -- atan(t) ~= t * (kAtan[0] + kAtan[1] * t^2 + kAtan[2] * t^4 + ...).
+template <std::size_t Terms>
+struct AtanPolynomial;
+
+inline constexpr std::size_t kMinAtanTerms = 2;
+inline constexpr std::size_t kMaxAtanTerms = 14;
+
+template <>
+struct AtanPolynomial<2> {
+  static constexpr long double kMaxError = 1.25e-04L;
+  static constexpr std::array<long double, 2> kAtan{
+      9.984600618639046960374e-01L,
+      -2.955103532371382346865e-01L,
+  };
+};
+
+template <>
+struct AtanPolynomial<3> {
+  static constexpr long double kMaxError = 6.99e-06L;
+  static constexpr std::array<long double, 3> kAtan{
+      9.999792964491199411318e-01L,
+      -3.310538064960524184693e-01L,
+      1.657772520989713882571e-01L,
+  };
+};
+
+template <>
+struct AtanPolynomial<4> {
+  static constexpr long double kMaxError = 2.78e-07L;
+  static constexpr std::array<long double, 4> kAtan{
+      9.999997097410508499018e-01L,
+      -3.332437456402128576998e-01L,
+      1.969047637630791958236e-01L,
+      -1.110768534869810757149e-01L,
+  };
+};
+
+template <>
+struct AtanPolynomial<5> {
+  static constexpr long double kMaxError = 1.33e-08L;
+  static constexpr std::array<long double, 5> kAtan{
+      9.999999962314909048714e-01L,
+      -3.333306552088830415416e-01L,
+      1.998121979101169309486e-01L,
+      -1.390478598805138776369e-01L,
+      8.113718345938861838794e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<6> {
+  static constexpr long double kMaxError = 6.30e-10L;
+  static constexpr std::array<long double, 6> kAtan{
+      9.999999999532881688465e-01L,
+      -3.333332668146073004703e-01L,
+      1.999913777641920976338e-01L,
+      -1.425476720628733684892e-01L,
+      1.066653011680945682274e-01L,
+      -6.238615820659734661706e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<7> {
+  static constexpr long double kMaxError = 3.04e-11L;
+  static constexpr std::array<long double, 7> kAtan{
+      9.999999999994384734166e-01L,
+      -3.333333318856293523894e-01L,
+      1.999996777959229414396e-01L,
+      -1.428380946481168822170e-01L,
+      1.106607960596218516511e-01L,
+      -8.589110547302456603184e-02L,
+      4.962749827776657894458e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<8> {
+  static constexpr long double kMaxError = 1.49e-12L;
+  static constexpr std::array<long double, 8> kAtan{
+      9.999999999999933936592e-01L,
+      -3.333333333047771160836e-01L,
+      1.999999897177049774784e-01L,
+      -1.428561934004095928414e-01L,
+      1.110764820300794422257e-01L,
+      -9.030226066113251070381e-02L,
+      7.138882975503816340221e-02L,
+      -4.044516810276681745813e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<9> {
+  static constexpr long double kMaxError = 7.34e-14L;
+  static constexpr std::array<long double, 9> kAtan{
+      9.999999999999999234927e-01L,
+      -3.333333333328111698342e-01L,
+      1.999999997102908361712e-01L,
+      -1.428571027970454681918e-01L,
+      1.111089575492873280638e-01L,
+      -9.085325220790271514986e-02L,
+      7.614705421326590797570e-02L,
+      -6.066598014095873499503e-02L,
+      3.356405820691279985982e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<10> {
+  static constexpr long double kMaxError = 3.68e-15L;
+  static constexpr std::array<long double, 10> kAtan{
+      9.999999999999999991245e-01L,
+      -3.333333333333243416950e-01L,
+      1.999999999926180586404e-01L,
+      -1.428571413807895491053e-01L,
+      1.111109981534241462106e-01L,
+      -9.090493612227639797035e-02L,
+      7.684009006814835796757e-02L,
+      -6.571138190935876910273e-02L,
+      5.240144795099384942011e-02L,
+      -2.824799076863033270439e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<11> {
+  static constexpr long double kMaxError = 1.87e-16L;
+  static constexpr std::array<long double, 11> kAtan{
+      9.999999999999999999901e-01L,
+      -3.333333333333331858477e-01L,
+      1.999999999998268364838e-01L,
+      -1.428571428085031869452e-01L,
+      1.111111059621706912191e-01L,
+      -9.090883059224030311721e-02L,
+      7.691589771000854164439e-02L,
+      -6.655042064738104198826e-02L,
+      5.768120522176330161385e-02L,
+      -4.582918399093438211638e-02L,
+      2.404242430858425162374e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<12> {
+  static constexpr long double kMaxError = 9.52e-18L;
+  static constexpr std::array<long double, 12> kAtan{
+      9.999999999999999999999e-01L,
+      -3.333333333333333310093e-01L,
+      1.999999999999962093397e-01L,
+      -1.428571428556846861459e-01L,
+      1.111111109025334667557e-01L,
+      -9.090907677216565416450e-02L,
+      7.692255430688634976434e-02L,
+      -6.665521522382641399925e-02L,
+      5.866785613321306908290e-02L,
+      -5.129646067896507450218e-02L,
+      4.047400954976200557127e-02L,
+      -2.065168189743608118007e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<13> {
+  static constexpr long double kMaxError = 4.91e-19L;
+  static constexpr std::array<long double, 13> kAtan{
+      1.000000000000000000000e+00L,
+      -3.333333333333333332979e-01L,
+      1.999999999999999217415e-01L,
+      -1.428571428571025239868e-01L,
+      1.111111111034717610080e-01L,
+      -9.090909022908600613656e-02L,
+      7.692304399576597479779e-02L,
+      -6.666571761902366402671e-02L,
+      5.880634059749844119234e-02L,
+      -5.243035001683029052347e-02L,
+      4.608716745048242449648e-02L,
+      -3.602524102316358949843e-02L,
+      1.787523486591231304858e-02L,
+  };
+};
+
+template <>
+struct AtanPolynomial<14> {
+  static constexpr long double kMaxError = 2.56e-20L;
+  static constexpr std::array<long double, 14> kAtan{
+      1.000000000000000000000e+00L,
+      -3.333333333333333333328e-01L,
+      1.999999999999999984635e-01L,
+      -1.428571428571418163820e-01L,
+      1.111111111108546536719e-01L,
+      -9.090909087962852615540e-02L,
+      7.692307508919831271276e-02L,
+      -6.666659864789470455605e-02L,
+      5.882193261107668700722e-02L,
+      -5.260698207787248492929e-02L,
+      4.736625505311299146026e-02L,
+      -4.174722832488853761171e-02L,
+      3.227096123201492382525e-02L,
+      -1.557236486358494367006e-02L,
+  };
+};
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_ANGULAR_MATH_POLYNOMIALS_H
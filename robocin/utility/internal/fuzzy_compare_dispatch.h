@@ -0,0 +1,56 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file declares the kernels of the batch overloads of 'fuzzy_compare.h', per instruction set
+// (see 'cpu_dispatch.h'). It should be included in the library source files, but not in the public
+// headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_DISPATCH_H
+#define ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_DISPATCH_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+namespace robocin::internal {
+
+template <std::floating_point F>
+struct FuzzyCompareKernels {
+  using UnaryMask = void (*)(std::span<const F>, F, std::span<std::uint64_t>);
+  using BinaryMask = void (*)(std::span<const F>, std::span<const F>, F, std::span<std::uint64_t>);
+  using ValueMask = void (*)(std::span<const F>, F, F, std::span<std::uint64_t>);
+  using Count = std::size_t (*)(std::span<const F>, F, F);
+
+  UnaryMask is_zero_mask;
+  BinaryMask cmp_equal_mask;
+  ValueMask cmp_equal_value_mask;
+  BinaryMask cmp_less_mask;
+  ValueMask cmp_less_value_mask;
+  Count count;
+};
+
+// The kernels of an instruction set, for each type it vectorizes.
+struct FuzzyCompareKernelSet {
+  FuzzyCompareKernels<float> for_float;
+  FuzzyCompareKernels<double> for_double;
+};
+
+// The kernels of each instruction set, defined by the source file which compiles them.
+extern const FuzzyCompareKernelSet kScalarFuzzyCompareKernels;
+#if defined(__SSE2__)
+extern const FuzzyCompareKernelSet kSse2FuzzyCompareKernels;
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+extern const FuzzyCompareKernelSet kAvx2FuzzyCompareKernels;
+extern const FuzzyCompareKernelSet kAvx512FuzzyCompareKernels;
+#endif
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_DISPATCH_H
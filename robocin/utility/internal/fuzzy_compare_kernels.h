@@ -0,0 +1,131 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file defines the kernels of the batch overloads of 'fuzzy_compare.h', and is included by
+// each source file which compiles them for an instruction set (see 'fuzzy_compare_dispatch.h'),
+// after the '#pragma GCC target' of that instruction set, if any. Everything it defines is local
+// to the file including it, so that the linker never merges the kernels of different instruction
+// sets.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_KERNELS_H
+#define ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_KERNELS_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/fuzzy_compare.h"
+#include "robocin/utility/internal/fuzzy_compare_dispatch.h"
+#include "robocin/utility/internal/simd_algorithm.h"
+
+namespace robocin::internal {
+namespace { // NOLINT(*-anonymous-namespace-in-header)
+
+// Each predicate holds its epsilon (and the value compared against, if any), and provides a
+// 'scalar' reference, the free function itself, and a 'vectorized' one for a given simd::Vector.
+
+template <std::floating_point F>
+struct IsZero {
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F value) const { return fuzzyIsZero(value, epsilon); }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector values) const {
+    return V::bits(V::lessEqual(V::abs(values), V::broadcast(epsilon)));
+  }
+};
+
+template <std::floating_point F>
+struct CmpEqual {
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F lhs, F rhs) const { return fuzzyCmpEqual(lhs, rhs, epsilon); }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector lhs, typename V::vector rhs) const {
+    return V::bits(V::lessEqual(V::abs(V::sub(lhs, rhs)), V::broadcast(epsilon)));
+  }
+};
+
+// 'fuzzyCmpLess' is 'lhs < rhs' unless both are equal.
+template <std::floating_point F>
+struct CmpLess {
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F lhs, F rhs) const { return fuzzyCmpLess(lhs, rhs, epsilon); }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector lhs, typename V::vector rhs) const {
+    return V::bits(V::less(lhs, rhs)) & ~CmpEqual<F>{epsilon}.template vectorized<V>(lhs, rhs);
+  }
+};
+
+// Binds the right-hand side of a binary predicate to a value.
+template <class Op, std::floating_point F>
+struct BindRhs {
+  Op op;
+  F rhs;
+
+  [[nodiscard]] bool scalar(F lhs) const { return op.scalar(lhs, rhs); }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector lhs) const {
+    return op.template vectorized<V>(lhs, V::broadcast(rhs));
+  }
+};
+
+// Kernels -----------------------------------------------------------------------------------------
+
+template <class Isa, std::floating_point F>
+void isZeroMask(std::span<const F> values, F epsilon, std::span<std::uint64_t> mask) {
+  simd::mask<Isa>(IsZero<F>{epsilon}, values, mask);
+}
+
+template <class Isa, template <class> class Op, std::floating_point F>
+void cmpMask(std::span<const F> lhs,
+             std::span<const F> rhs,
+             F epsilon,
+             std::span<std::uint64_t> mask) {
+  simd::mask<Isa>(Op<F>{epsilon}, lhs, rhs, mask);
+}
+
+template <class Isa, template <class> class Op, std::floating_point F>
+void cmpMask(std::span<const F> lhs, F rhs, F epsilon, std::span<std::uint64_t> mask) {
+  simd::mask<Isa>(BindRhs<Op<F>, F>{Op<F>{epsilon}, rhs}, lhs, mask);
+}
+
+template <class Isa, std::floating_point F>
+std::size_t count(std::span<const F> values, F value, F epsilon) {
+  return simd::count<Isa>(BindRhs<CmpEqual<F>, F>{CmpEqual<F>{epsilon}, value}, values);
+}
+
+template <class Isa, std::floating_point F>
+constexpr FuzzyCompareKernels<F> fuzzyCompareKernels() {
+  using Kernels = FuzzyCompareKernels<F>;
+
+  return {
+      .is_zero_mask = &isZeroMask<Isa, F>,
+      .cmp_equal_mask = static_cast<typename Kernels::BinaryMask>(&cmpMask<Isa, CmpEqual, F>),
+      .cmp_equal_value_mask = static_cast<typename Kernels::ValueMask>(&cmpMask<Isa, CmpEqual, F>),
+      .cmp_less_mask = static_cast<typename Kernels::BinaryMask>(&cmpMask<Isa, CmpLess, F>),
+      .cmp_less_value_mask = static_cast<typename Kernels::ValueMask>(&cmpMask<Isa, CmpLess, F>),
+      .count = &count<Isa, F>,
+  };
+}
+
+// The kernels of 'Isa', which must be either 'simd::None' or one whose vectors are available in the
+// file including this one.
+template <class Isa>
+constexpr FuzzyCompareKernelSet fuzzyCompareKernelSet() {
+  return {.for_float = fuzzyCompareKernels<Isa, float>(),
+          .for_double = fuzzyCompareKernels<Isa, double>()};
+}
+
+} // namespace
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_FUZZY_COMPARE_KERNELS_H
@@ -0,0 +1,61 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file declares the kernels of the batch overloads of 'geometric_predicates.h', per
+// instruction set (see 'cpu_dispatch.h'). It should be included in the library source files, but
+// not in the public headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_DISPATCH_H
+#define ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_DISPATCH_H
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/geometric_predicates.h"
+
+namespace robocin::internal {
+
+template <std::floating_point F>
+struct GeometricPredicatesKernels {
+  using OnSegmentMask = void (*)(Point2D<F>,
+                                 Point2D<F>,
+                                 std::span<const F>,
+                                 std::span<const F>,
+                                 F,
+                                 std::span<std::uint64_t>);
+  using IntersectionsMask = void (*)(Point2D<F>,
+                                     Point2D<F>,
+                                     std::span<const F>,
+                                     std::span<const F>,
+                                     std::span<const F>,
+                                     std::span<const F>,
+                                     F,
+                                     std::span<std::uint64_t>);
+
+  OnSegmentMask on_segment_mask;
+  IntersectionsMask intersections_mask;
+};
+
+// The kernels of an instruction set, for each type it vectorizes.
+struct GeometricPredicatesKernelSet {
+  GeometricPredicatesKernels<float> for_float;
+  GeometricPredicatesKernels<double> for_double;
+};
+
+// The kernels of each instruction set, defined by the source file which compiles them.
+extern const GeometricPredicatesKernelSet kScalarGeometricPredicatesKernels;
+#if defined(__SSE2__)
+extern const GeometricPredicatesKernelSet kSse2GeometricPredicatesKernels;
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+extern const GeometricPredicatesKernelSet kAvx2GeometricPredicatesKernels;
+extern const GeometricPredicatesKernelSet kAvx512GeometricPredicatesKernels;
+#endif
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_DISPATCH_H
@@ -0,0 +1,255 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file defines the kernels of the batch overloads of 'geometric_predicates.h', and is included
+// by each source file which compiles them for an instruction set (see
+// 'geometric_predicates_dispatch.h'), after the '#pragma GCC target' of that instruction set, if
+// any. As 'angular_kernels.h', everything it defines is local to the file including it.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_KERNELS_H
+#define ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_KERNELS_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "robocin/utility/geometric_predicates.h"
+#include "robocin/utility/internal/geometric_predicates_dispatch.h"
+#include "robocin/utility/internal/simd_algorithm.h"
+
+namespace robocin::internal {
+namespace { // NOLINT(*-anonymous-namespace-in-header)
+
+// Operations --------------------------------------------------------------------------------------
+// The vectors evaluate the filter of 'orientation' as it does, and only decide the points or
+// segments for which every orientation is certainly clockwise or counterclockwise: the others,
+// either collinear or too close to the tolerance, are tested by the scalar functions, lane by lane.
+
+struct OrientationBits {
+  std::uint64_t counterclockwise;
+  std::uint64_t clockwise;
+
+  [[nodiscard]] std::uint64_t certain() const { return counterclockwise | clockwise; }
+};
+
+template <class V>
+OrientationBits orientationBits(typename V::vector ab_x,
+                                typename V::vector ab_y,
+                                typename V::vector ac_x,
+                                typename V::vector ac_y,
+                                typename V::vector tolerance) {
+  using F = typename V::value_type;
+
+  const auto kLeft = V::mul(ab_x, ac_y);
+  const auto kRight = V::mul(ab_y, ac_x);
+  const auto kDeterminant = V::sub(kLeft, kRight);
+
+  const auto kError = V::add(V::mul(V::broadcast(kDeterminantErrorBound<F>),
+                                    V::add(V::abs(kLeft), V::abs(kRight))),
+                             V::mul(V::broadcast(kToleranceErrorBound<F>), tolerance));
+  const auto kBound = V::add(tolerance, kError);
+
+  return {V::bits(V::greater(kDeterminant, kBound)),
+          V::bits(V::less(kDeterminant, V::sub(V::broadcast(F{0}), kBound)))};
+}
+
+// Tests the lanes of 'undecided' by 'scalar', given the coordinates of every lane.
+template <class V, class Scalar, class... Vectors>
+std::uint64_t scalarLanes(std::uint64_t undecided, const Scalar& scalar, Vectors... vectors) {
+  using F = typename V::value_type;
+
+  std::array<std::array<F, V::kLanes>, sizeof...(Vectors)> lanes;
+  std::size_t index = 0;
+  (V::store(lanes[index++].data(), vectors), ...);
+
+  std::uint64_t result = 0;
+  for (; undecided != 0; undecided &= undecided - 1) {
+    const auto kLane = static_cast<std::size_t>(std::countr_zero(undecided));
+    const auto kScalar = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return scalar(lanes[Is][kLane]...);
+    }(std::index_sequence_for<Vectors...>{});
+
+    result |= std::uint64_t{kScalar} << kLane;
+  }
+  return result;
+}
+
+template <std::floating_point F>
+struct OnSegment {
+  Point2D<F> first;
+  Point2D<F> last;
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F x, F y) const {
+    return robocin::isPointOnSegment(Point2D<F>{x, y}, first, last, epsilon);
+  }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector xs, typename V::vector ys) const {
+    static constexpr std::uint64_t kLanes = (std::uint64_t{1} << V::kLanes) - 1;
+
+    const Point2D<F> kAb = last - first;
+    const F kTolerance = epsilon * std::sqrt(kAb.x * kAb.x + kAb.y * kAb.y);
+
+    const OrientationBits kBits = orientationBits<V>(V::broadcast(kAb.x),
+                                                        V::broadcast(kAb.y),
+                                                        V::sub(xs, V::broadcast(first.x)),
+                                                        V::sub(ys, V::broadcast(first.y)),
+                                                        V::broadcast(kTolerance));
+
+    // the points certainly off the line are not on the segment.
+    if (const std::uint64_t kUndecided = ~kBits.certain() & kLanes; kUndecided != 0) {
+      return scalarLanes<V>(
+          kUndecided,
+          [this](F x, F y) { return scalar(x, y); },
+          xs,
+          ys);
+    }
+    return 0;
+  }
+};
+
+template <std::floating_point F>
+struct IntersectsSegment {
+  Point2D<F> first;
+  Point2D<F> last;
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F first_x, F first_y, F last_x, F last_y) const {
+    return robocin::segmentsIntersect(first,
+                             last,
+                             Point2D<F>{first_x, first_y},
+                             Point2D<F>{last_x, last_y},
+                             epsilon);
+  }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector first_xs,
+                                         typename V::vector first_ys,
+                                         typename V::vector last_xs,
+                                         typename V::vector last_ys) const {
+    static constexpr std::uint64_t kLanes = (std::uint64_t{1} << V::kLanes) - 1;
+
+    const Point2D<F> kAb = last - first;
+    const auto kAbX = V::broadcast(kAb.x);
+    const auto kAbY = V::broadcast(kAb.y);
+    const auto kTolerance = V::broadcast(epsilon * std::sqrt(kAb.x * kAb.x + kAb.y * kAb.y));
+
+    // the endpoints of the segments against the line of 'first' and 'last'.
+    const auto kFirstX = V::broadcast(first.x);
+    const auto kFirstY = V::broadcast(first.y);
+    const OrientationBits kOtherFirst = orientationBits<V>(kAbX,
+                                                              kAbY,
+                                                              V::sub(first_xs, kFirstX),
+                                                              V::sub(first_ys, kFirstY),
+                                                              kTolerance);
+    const OrientationBits kOtherLast = orientationBits<V>(kAbX,
+                                                             kAbY,
+                                                             V::sub(last_xs, kFirstX),
+                                                             V::sub(last_ys, kFirstY),
+                                                             kTolerance);
+
+    // 'first' and 'last' against the lines of the segments.
+    const auto kOtherAbX = V::sub(last_xs, first_xs);
+    const auto kOtherAbY = V::sub(last_ys, first_ys);
+    const auto kOtherTolerance =
+        V::mul(V::broadcast(epsilon),
+               V::sqrt(V::add(V::mul(kOtherAbX, kOtherAbX), V::mul(kOtherAbY, kOtherAbY))));
+    const OrientationBits kFirst = orientationBits<V>(kOtherAbX,
+                                                         kOtherAbY,
+                                                         V::sub(kFirstX, first_xs),
+                                                         V::sub(kFirstY, first_ys),
+                                                         kOtherTolerance);
+    const OrientationBits kLast = orientationBits<V>(kOtherAbX,
+                                                        kOtherAbY,
+                                                        V::sub(V::broadcast(last.x), first_xs),
+                                                        V::sub(V::broadcast(last.y), first_ys),
+                                                        kOtherTolerance);
+
+    const std::uint64_t kCertain =
+        kOtherFirst.certain() & kOtherLast.certain() & kFirst.certain() & kLast.certain();
+    const std::uint64_t kCrossesLine = (kOtherFirst.counterclockwise & kOtherLast.clockwise)
+                                       | (kOtherFirst.clockwise & kOtherLast.counterclockwise);
+    const std::uint64_t kCrossesOtherLine = (kFirst.counterclockwise & kLast.clockwise)
+                                            | (kFirst.clockwise & kLast.counterclockwise);
+
+    std::uint64_t result = kCrossesLine & kCrossesOtherLine & kCertain;
+    if (const std::uint64_t kUndecided = ~kCertain & kLanes; kUndecided != 0) {
+      result |= scalarLanes<V>(
+          kUndecided,
+          [this](F first_x, F first_y, F last_x, F last_y) {
+            return scalar(first_x, first_y, last_x, last_y);
+          },
+          first_xs,
+          first_ys,
+          last_xs,
+          last_ys);
+    }
+    return result;
+  }
+};
+
+// Kernels -----------------------------------------------------------------------------------------
+
+template <class Isa, std::floating_point F>
+void onSegmentKernel(Point2D<F> first,
+                     Point2D<F> last,
+                     std::span<const F> xs,
+                     std::span<const F> ys,
+                     F epsilon,
+                     std::span<std::uint64_t> mask) {
+  simd::mask<Isa>(OnSegment<F>{first, last, epsilon}, xs, ys, mask);
+}
+
+template <class Isa, std::floating_point F>
+void intersectionsKernel(Point2D<F> first,
+                         Point2D<F> last,
+                         std::span<const F> first_xs,
+                         std::span<const F> first_ys,
+                         std::span<const F> last_xs,
+                         std::span<const F> last_ys,
+                         F epsilon,
+                         std::span<std::uint64_t> mask) {
+  assert(first_xs.size() == first_ys.size() and first_xs.size() == last_xs.size()
+         and first_xs.size() == last_ys.size());
+  assert(mask.size() >= simd::maskWords(first_xs.size()));
+
+  const IntersectsSegment<F> kOp{first, last, epsilon};
+  for (std::size_t word = 0; word < simd::maskWords(first_xs.size()); ++word) {
+    const std::size_t kFirst = word * simd::kMaskWordBits;
+    const std::size_t kLast = std::min(kFirst + simd::kMaskWordBits, first_xs.size());
+
+    mask[word] =
+        simd::maskWord<Isa, F>(kOp, kFirst, kLast, first_xs, first_ys, last_xs, last_ys);
+  }
+}
+
+template <class Isa, std::floating_point F>
+constexpr GeometricPredicatesKernels<F> geometricPredicatesKernels() {
+  return {
+      .on_segment_mask = &onSegmentKernel<Isa, F>,
+      .intersections_mask = &intersectionsKernel<Isa, F>,
+  };
+}
+
+// The kernels of 'Isa', which must be either 'simd::None' or one whose vectors are available in the
+// file including this one.
+template <class Isa>
+constexpr GeometricPredicatesKernelSet geometricPredicatesKernelSet() {
+  return {.for_float = geometricPredicatesKernels<Isa, float>(),
+          .for_double = geometricPredicatesKernels<Isa, double>()};
+}
+
+} // namespace
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_GEOMETRIC_PREDICATES_KERNELS_H
@@ -0,0 +1,53 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file declares the kernels of the batch overloads of 'point2d.h', per instruction set (see
+// 'cpu_dispatch.h'). It should be included in the library source files, but not in the public
+// headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_POINT2D_DISPATCH_H
+#define ROBOCIN_UTILITY_INTERNAL_POINT2D_DISPATCH_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/point2d.h"
+
+namespace robocin::internal {
+
+template <std::floating_point F>
+struct Point2DKernels {
+  using Distances = void (*)(std::span<const F>, std::span<const F>, Point2D<F>, std::span<F>);
+  using Nearest = std::size_t (*)(std::span<const F>, std::span<const F>, Point2D<F>);
+  using InRadiusMask =
+      void (*)(std::span<const F>, std::span<const F>, Point2D<F>, F, F, std::span<std::uint64_t>);
+
+  Distances distances;
+  Nearest nearest;
+  InRadiusMask in_radius_mask;
+};
+
+// The kernels of an instruction set, for each type it vectorizes.
+struct Point2DKernelSet {
+  Point2DKernels<float> for_float;
+  Point2DKernels<double> for_double;
+};
+
+// The kernels of each instruction set, defined by the source file which compiles them.
+extern const Point2DKernelSet kScalarPoint2DKernels;
+#if defined(__SSE2__)
+extern const Point2DKernelSet kSse2Point2DKernels;
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+extern const Point2DKernelSet kAvx2Point2DKernels;
+extern const Point2DKernelSet kAvx512Point2DKernels;
+#endif
+
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_POINT2D_DISPATCH_H
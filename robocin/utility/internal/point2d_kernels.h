@@ -0,0 +1,186 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file defines the kernels of the batch overloads of 'point2d.h', and is included by each
+// source file which compiles them for an instruction set (see 'point2d_dispatch.h'), after the
+// '#pragma GCC target' of that instruction set, if any. As 'angular_kernels.h', everything it
+// defines is local to the file including it.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_POINT2D_KERNELS_H
+#define ROBOCIN_UTILITY_INTERNAL_POINT2D_KERNELS_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "robocin/utility/internal/point2d_dispatch.h"
+#include "robocin/utility/internal/simd_algorithm.h"
+#include "robocin/utility/point2d.h"
+
+namespace robocin::internal {
+namespace { // NOLINT(*-anonymous-namespace-in-header)
+
+// The squared distances are computed as 'Point2D::distance' computes them, so that both round
+// alike (but for the multiply-adds the instruction sets with FMA may fuse).
+
+template <std::floating_point F>
+F squaredDistance(F x, F y, Point2D<F> point) {
+  const F kDx = x - point.x;
+  const F kDy = y - point.y;
+  return kDx * kDx + kDy * kDy;
+}
+
+template <class V>
+typename V::vector squaredDistances(typename V::vector xs,
+                                    typename V::vector ys,
+                                    typename V::vector point_x,
+                                    typename V::vector point_y) {
+  const auto kDx = V::sub(xs, point_x);
+  const auto kDy = V::sub(ys, point_y);
+  return V::add(V::mul(kDx, kDx), V::mul(kDy, kDy));
+}
+
+template <class Isa, std::floating_point F>
+void distancesKernel(std::span<const F> xs,
+                     std::span<const F> ys,
+                     Point2D<F> point,
+                     std::span<F> distances) {
+  assert(xs.size() == ys.size() and xs.size() == distances.size());
+
+  std::size_t index = 0;
+  if constexpr (simd::kHasVector<Isa, F>) {
+    using V = simd::Vector<Isa, F>;
+
+    const auto kPointX = V::broadcast(point.x);
+    const auto kPointY = V::broadcast(point.y);
+    for (; index + V::kLanes <= xs.size(); index += V::kLanes) {
+      V::store(&distances[index],
+               V::sqrt(squaredDistances<V>(V::load(&xs[index]),
+                                           V::load(&ys[index]),
+                                           kPointX,
+                                           kPointY)));
+    }
+  }
+  for (; index < xs.size(); ++index) {
+    distances[index] = std::sqrt(squaredDistance(xs[index], ys[index], point));
+  }
+}
+
+// Two passes: the smallest squared distance is found first, without tracking its index, and then
+// the first point at it, so that the vectors only take their minimum ('V::min' keeps the running
+// minimum when a distance is NaN).
+template <class Isa, std::floating_point F>
+std::size_t nearestKernel(std::span<const F> xs, std::span<const F> ys, Point2D<F> point) {
+  assert(xs.size() == ys.size());
+
+  F nearest = std::numeric_limits<F>::infinity();
+
+  std::size_t index = 0;
+  if constexpr (simd::kHasVector<Isa, F>) {
+    using V = simd::Vector<Isa, F>;
+
+    const auto kPointX = V::broadcast(point.x);
+    const auto kPointY = V::broadcast(point.y);
+
+    auto minimums = V::broadcast(nearest);
+    for (; index + V::kLanes <= xs.size(); index += V::kLanes) {
+      minimums = V::min(
+          squaredDistances<V>(V::load(&xs[index]), V::load(&ys[index]), kPointX, kPointY),
+          minimums);
+    }
+
+    F lanes[V::kLanes]; // NOLINT(*-avoid-c-arrays)
+    V::store(lanes, minimums);
+    for (const F kLane : lanes) {
+      nearest = std::min(nearest, kLane);
+    }
+  }
+  for (; index < xs.size(); ++index) {
+    nearest = std::min(nearest, squaredDistance(xs[index], ys[index], point));
+  }
+
+  index = 0;
+  if constexpr (simd::kHasVector<Isa, F>) {
+    using V = simd::Vector<Isa, F>;
+
+    const auto kPointX = V::broadcast(point.x);
+    const auto kPointY = V::broadcast(point.y);
+    const auto kNearest = V::broadcast(nearest);
+    for (; index + V::kLanes <= xs.size(); index += V::kLanes) {
+      const auto kDistances =
+          squaredDistances<V>(V::load(&xs[index]), V::load(&ys[index]), kPointX, kPointY);
+      if (const std::uint64_t kBits = V::bits(V::lessEqual(kDistances, kNearest)); kBits != 0) {
+        return index + static_cast<std::size_t>(std::countr_zero(kBits));
+      }
+    }
+  }
+  for (; index < xs.size(); ++index) {
+    if (squaredDistance(xs[index], ys[index], point) <= nearest) {
+      return index;
+    }
+  }
+  return xs.size();
+}
+
+// 'fuzzyCmpLessEqual' is 'distance < radius', or both equal.
+template <std::floating_point F>
+struct InRadius {
+  Point2D<F> point;
+  F radius;
+  F epsilon;
+
+  [[nodiscard]] bool scalar(F x, F y) const {
+    return robocin::fuzzyCmpLessEqual(std::sqrt(squaredDistance(x, y, point)), radius, epsilon);
+  }
+
+  template <class V>
+  [[nodiscard]] std::uint64_t vectorized(typename V::vector xs, typename V::vector ys) const {
+    const auto kDistances =
+        V::sqrt(squaredDistances<V>(xs, ys, V::broadcast(point.x), V::broadcast(point.y)));
+    const auto kRadius = V::broadcast(radius);
+
+    return V::bits(V::less(kDistances, kRadius))
+           | V::bits(V::lessEqual(V::abs(V::sub(kDistances, kRadius)), V::broadcast(epsilon)));
+  }
+};
+
+template <class Isa, std::floating_point F>
+void inRadiusKernel(std::span<const F> xs,
+                    std::span<const F> ys,
+                    Point2D<F> point,
+                    F radius,
+                    F epsilon,
+                    std::span<std::uint64_t> mask) {
+  simd::mask<Isa>(InRadius<F>{point, radius, epsilon}, xs, ys, mask);
+}
+
+// Kernels -----------------------------------------------------------------------------------------
+
+template <class Isa, std::floating_point F>
+constexpr Point2DKernels<F> point2DKernels() {
+  return {
+      .distances = &distancesKernel<Isa, F>,
+      .nearest = &nearestKernel<Isa, F>,
+      .in_radius_mask = &inRadiusKernel<Isa, F>,
+  };
+}
+
+// The kernels of 'Isa', which must be either 'simd::None' or one whose vectors are available in the
+// file including this one.
+template <class Isa>
+constexpr Point2DKernelSet point2DKernelSet() {
+  return {.for_float = point2DKernels<Isa, float>(), .for_double = point2DKernels<Isa, double>()};
+}
+
+} // namespace
+} // namespace robocin::internal
+
+#endif // ROBOCIN_UTILITY_INTERNAL_POINT2D_KERNELS_H
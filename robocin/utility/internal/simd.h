@@ -0,0 +1,296 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file provides thin wrappers over the x86 SIMD intrinsics, so that vectorized kernels can be
+// written once and instantiated for each instruction set. It should be included in the library
+// source files, but not in the public headers.
+//
+// A source file may also compile it for a wider instruction set than the target's, after a
+// '#pragma GCC target' (see 'cpu_dispatch.h'), by defining 'ROBOCIN_SIMD_TARGET_AVX2' or
+// 'ROBOCIN_SIMD_TARGET_AVX512' first (the pragma does not define the macros of the instruction set
+// in C++, such as '__AVX2__'), in which case 'Native' is the wider one. Hence the wrappers live in
+// an inline namespace named after 'Native', so that the linker never merges their inline functions
+// with the ones compiled for another instruction set.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_SIMD_H
+#define ROBOCIN_UTILITY_INTERNAL_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(ROBOCIN_SIMD_TARGET_AVX512) || (defined(__AVX512F__) && defined(__AVX512DQ__))
+#define ROBOCIN_SIMD_HAS_AVX512
+#endif
+#if defined(ROBOCIN_SIMD_HAS_AVX512) || defined(ROBOCIN_SIMD_TARGET_AVX2) || defined(__AVX2__)
+#define ROBOCIN_SIMD_HAS_AVX2
+#endif
+
+namespace robocin::internal::simd {
+
+// Instruction sets --------------------------------------------------------------------------------
+struct None {};
+struct Sse2 {};
+struct Avx2 {};
+struct Avx512 {};
+
+#if defined(ROBOCIN_SIMD_HAS_AVX512)
+#define ROBOCIN_SIMD_NATIVE_NAMESPACE avx512
+using Native = Avx512;
+#elif defined(ROBOCIN_SIMD_HAS_AVX2)
+#define ROBOCIN_SIMD_NATIVE_NAMESPACE avx2
+using Native = Avx2;
+#elif defined(__SSE2__)
+#define ROBOCIN_SIMD_NATIVE_NAMESPACE sse2
+using Native = Sse2;
+#else
+#define ROBOCIN_SIMD_NATIVE_NAMESPACE none
+using Native = None;
+#endif
+
+inline namespace ROBOCIN_SIMD_NATIVE_NAMESPACE {
+
+// Vector wrappers ---------------------------------------------------------------------------------
+// Each specialization exposes the same static interface: 'vector' and 'mask' types, 'kLanes',
+// memory operations, arithmetic, comparisons returning a 'mask', 'select' and 'bits', which packs
+// a 'mask' into the lowest 'kLanes' bits of an integer (lane 'i' into bit 'i').
+template <class Isa, class F>
+struct Vector;
+
+#if defined(__SSE2__)
+template <>
+struct Vector<Sse2, float> {
+  using value_type = float;
+  using vector = __m128;
+  using mask = __m128;
+
+  static constexpr std::size_t kLanes = 4;
+
+  static vector load(const float* ptr) { return _mm_loadu_ps(ptr); }
+  static void store(float* ptr, vector v) { _mm_storeu_ps(ptr, v); }
+  static vector broadcast(float value) { return _mm_set1_ps(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm_add_ps(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm_sub_ps(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm_mul_ps(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm_div_ps(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm_min_ps(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm_max_ps(lhs, rhs); }
+  static vector abs(vector v) { return _mm_andnot_ps(_mm_set1_ps(-0.0F), v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm_set1_ps(-0.0F);
+    return _mm_or_ps(_mm_andnot_ps(kSignBit, magnitude), _mm_and_ps(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm_sqrt_ps(v); }
+  // truncates towards zero, lanes must fit in a 32-bit integer.
+  static vector trunc(vector v) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(v)); }
+
+  static mask less(vector lhs, vector rhs) { return _mm_cmplt_ps(lhs, rhs); }
+  static mask lessEqual(vector lhs, vector rhs) { return _mm_cmple_ps(lhs, rhs); }
+  static mask greater(vector lhs, vector rhs) { return _mm_cmpgt_ps(lhs, rhs); }
+
+  static vector select(mask m, vector lhs, vector rhs) {
+    return _mm_or_ps(_mm_and_ps(m, lhs), _mm_andnot_ps(m, rhs));
+  }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(_mm_movemask_ps(m)); }
+};
+
+template <>
+struct Vector<Sse2, double> {
+  using value_type = double;
+  using vector = __m128d;
+  using mask = __m128d;
+
+  static constexpr std::size_t kLanes = 2;
+
+  static vector load(const double* ptr) { return _mm_loadu_pd(ptr); }
+  static void store(double* ptr, vector v) { _mm_storeu_pd(ptr, v); }
+  static vector broadcast(double value) { return _mm_set1_pd(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm_add_pd(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm_sub_pd(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm_mul_pd(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm_div_pd(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm_min_pd(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm_max_pd(lhs, rhs); }
+  static vector abs(vector v) { return _mm_andnot_pd(_mm_set1_pd(-0.0), v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm_set1_pd(-0.0);
+    return _mm_or_pd(_mm_andnot_pd(kSignBit, magnitude), _mm_and_pd(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm_sqrt_pd(v); }
+  // truncates towards zero, lanes must fit in a 32-bit integer.
+  static vector trunc(vector v) { return _mm_cvtepi32_pd(_mm_cvttpd_epi32(v)); }
+
+  static mask less(vector lhs, vector rhs) { return _mm_cmplt_pd(lhs, rhs); }
+  static mask lessEqual(vector lhs, vector rhs) { return _mm_cmple_pd(lhs, rhs); }
+  static mask greater(vector lhs, vector rhs) { return _mm_cmpgt_pd(lhs, rhs); }
+
+  static vector select(mask m, vector lhs, vector rhs) {
+    return _mm_or_pd(_mm_and_pd(m, lhs), _mm_andnot_pd(m, rhs));
+  }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(_mm_movemask_pd(m)); }
+};
+#endif
+
+#if defined(ROBOCIN_SIMD_HAS_AVX2)
+template <>
+struct Vector<Avx2, float> {
+  using value_type = float;
+  using vector = __m256;
+  using mask = __m256;
+
+  static constexpr std::size_t kLanes = 8;
+
+  static vector load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+  static void store(float* ptr, vector v) { _mm256_storeu_ps(ptr, v); }
+  static vector broadcast(float value) { return _mm256_set1_ps(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm256_add_ps(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm256_sub_ps(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm256_mul_ps(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm256_div_ps(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm256_min_ps(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm256_max_ps(lhs, rhs); }
+  static vector abs(vector v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0F), v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm256_set1_ps(-0.0F);
+    return _mm256_or_ps(_mm256_andnot_ps(kSignBit, magnitude), _mm256_and_ps(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm256_sqrt_ps(v); }
+  static vector trunc(vector v) {
+    return _mm256_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+
+  static mask less(vector lhs, vector rhs) { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+  static mask lessEqual(vector lhs, vector rhs) { return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ); }
+  static mask greater(vector lhs, vector rhs) { return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ); }
+
+  static vector select(mask m, vector lhs, vector rhs) { return _mm256_blendv_ps(rhs, lhs, m); }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(_mm256_movemask_ps(m)); }
+};
+
+template <>
+struct Vector<Avx2, double> {
+  using value_type = double;
+  using vector = __m256d;
+  using mask = __m256d;
+
+  static constexpr std::size_t kLanes = 4;
+
+  static vector load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+  static void store(double* ptr, vector v) { _mm256_storeu_pd(ptr, v); }
+  static vector broadcast(double value) { return _mm256_set1_pd(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm256_add_pd(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm256_sub_pd(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm256_mul_pd(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm256_div_pd(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm256_min_pd(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm256_max_pd(lhs, rhs); }
+  static vector abs(vector v) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm256_set1_pd(-0.0);
+    return _mm256_or_pd(_mm256_andnot_pd(kSignBit, magnitude), _mm256_and_pd(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm256_sqrt_pd(v); }
+  static vector trunc(vector v) {
+    return _mm256_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+
+  static mask less(vector lhs, vector rhs) { return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ); }
+  static mask lessEqual(vector lhs, vector rhs) { return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ); }
+  static mask greater(vector lhs, vector rhs) { return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ); }
+
+  static vector select(mask m, vector lhs, vector rhs) { return _mm256_blendv_pd(rhs, lhs, m); }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(_mm256_movemask_pd(m)); }
+};
+#endif
+
+#if defined(ROBOCIN_SIMD_HAS_AVX512)
+template <>
+struct Vector<Avx512, float> {
+  using value_type = float;
+  using vector = __m512;
+  using mask = __mmask16;
+
+  static constexpr std::size_t kLanes = 16;
+
+  static vector load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+  static void store(float* ptr, vector v) { _mm512_storeu_ps(ptr, v); }
+  static vector broadcast(float value) { return _mm512_set1_ps(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm512_add_ps(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm512_sub_ps(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm512_mul_ps(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm512_div_ps(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm512_min_ps(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm512_max_ps(lhs, rhs); }
+  static vector abs(vector v) { return _mm512_abs_ps(v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm512_set1_ps(-0.0F);
+    return _mm512_or_ps(_mm512_andnot_ps(kSignBit, magnitude), _mm512_and_ps(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm512_sqrt_ps(v); }
+  static vector trunc(vector v) {
+    return _mm512_roundscale_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+
+  static mask less(vector lhs, vector rhs) { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ); }
+  static mask lessEqual(vector lhs, vector rhs) {
+    return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ);
+  }
+  static mask greater(vector lhs, vector rhs) { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ); }
+
+  static vector select(mask m, vector lhs, vector rhs) { return _mm512_mask_blend_ps(m, rhs, lhs); }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(m); }
+};
+
+template <>
+struct Vector<Avx512, double> {
+  using value_type = double;
+  using vector = __m512d;
+  using mask = __mmask8;
+
+  static constexpr std::size_t kLanes = 8;
+
+  static vector load(const double* ptr) { return _mm512_loadu_pd(ptr); }
+  static void store(double* ptr, vector v) { _mm512_storeu_pd(ptr, v); }
+  static vector broadcast(double value) { return _mm512_set1_pd(value); }
+
+  static vector add(vector lhs, vector rhs) { return _mm512_add_pd(lhs, rhs); }
+  static vector sub(vector lhs, vector rhs) { return _mm512_sub_pd(lhs, rhs); }
+  static vector mul(vector lhs, vector rhs) { return _mm512_mul_pd(lhs, rhs); }
+  static vector div(vector lhs, vector rhs) { return _mm512_div_pd(lhs, rhs); }
+  static vector min(vector lhs, vector rhs) { return _mm512_min_pd(lhs, rhs); }
+  static vector max(vector lhs, vector rhs) { return _mm512_max_pd(lhs, rhs); }
+  static vector abs(vector v) { return _mm512_abs_pd(v); }
+  static vector copySign(vector magnitude, vector sign) {
+    const vector kSignBit = _mm512_set1_pd(-0.0);
+    return _mm512_or_pd(_mm512_andnot_pd(kSignBit, magnitude), _mm512_and_pd(kSignBit, sign));
+  }
+  static vector sqrt(vector v) { return _mm512_sqrt_pd(v); }
+  static vector trunc(vector v) {
+    return _mm512_roundscale_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+
+  static mask less(vector lhs, vector rhs) { return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OQ); }
+  static mask lessEqual(vector lhs, vector rhs) {
+    return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OQ);
+  }
+  static mask greater(vector lhs, vector rhs) { return _mm512_cmp_pd_mask(lhs, rhs, _CMP_GT_OQ); }
+
+  static vector select(mask m, vector lhs, vector rhs) { return _mm512_mask_blend_pd(m, rhs, lhs); }
+  static std::uint64_t bits(mask m) { return static_cast<std::uint64_t>(m); }
+};
+#endif
+
+} // namespace ROBOCIN_SIMD_NATIVE_NAMESPACE
+} // namespace robocin::internal::simd
+
+#endif // ROBOCIN_UTILITY_INTERNAL_SIMD_H
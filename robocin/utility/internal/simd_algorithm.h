@@ -0,0 +1,154 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file provides the loops shared by the vectorized kernels: the given operation is applied to
+// 'kLanes' elements at a time and to the remaining ones through its scalar reference. It should be
+// included in the library source files, but not in the public headers.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_SIMD_ALGORITHM_H
+#define ROBOCIN_UTILITY_INTERNAL_SIMD_ALGORITHM_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/internal/simd.h"
+#include "robocin/utility/type_traits.h"
+
+namespace robocin::internal::simd {
+inline namespace ROBOCIN_SIMD_NATIVE_NAMESPACE {
+
+// Whether the kernels of the instruction set 'Isa' vectorize 'F'. Those of 'None' run the scalar
+// references only.
+template <class Isa, class F>
+inline constexpr bool kHasVector = not std::same_as<Isa, None>
+                                   and (std::same_as<F, float> or std::same_as<F, double>);
+
+template <class F>
+inline constexpr bool kHasNativeVector = kHasVector<Native, F>;
+
+// The following functions are instantiated for a given instruction set, 'Isa', which must be either
+// 'None' or one whose vectors are available in the calling file (usually 'Native').
+
+// 'Op' must provide a 'scalar' reference and its 'vectorized' counterpart, templated on the
+// simd::Vector.
+template <class Isa, class Op, std::floating_point F>
+void transform(std::span<const F> input, std::span<F> output) {
+  assert(input.size() == output.size());
+
+  std::size_t index = 0;
+  if constexpr (kHasVector<Isa, F>) {
+    using V = Vector<Isa, F>;
+
+    for (; index + V::kLanes <= input.size(); index += V::kLanes) {
+      V::store(&output[index], Op::template vectorized<V>(V::load(&input[index])));
+    }
+  }
+  for (; index < input.size(); ++index) {
+    output[index] = Op::scalar(input[index]);
+  }
+}
+
+// As above, but for binary operations.
+template <class Isa, class Op, std::floating_point F>
+void transform(std::span<const F> lhs, std::span<const F> rhs, std::span<F> output) {
+  assert(lhs.size() == rhs.size() and lhs.size() == output.size());
+
+  std::size_t index = 0;
+  if constexpr (kHasVector<Isa, F>) {
+    using V = Vector<Isa, F>;
+
+    for (; index + V::kLanes <= lhs.size(); index += V::kLanes) {
+      V::store(&output[index],
+               Op::template vectorized<V>(V::load(&lhs[index]), V::load(&rhs[index])));
+    }
+  }
+  for (; index < lhs.size(); ++index) {
+    output[index] = Op::scalar(lhs[index], rhs[index]);
+  }
+}
+
+// Predicates --------------------------------------------------------------------------------------
+// The following functions evaluate a predicate on every element, where 'Op' must provide a 'scalar'
+// reference, returning a bool, and its 'vectorized' counterpart, returning the 'V::bits' of its
+// result (so that masks may be combined as integers). Results are packed into 64-bit words: bit
+// 'i % 64' of 'output[i / 64]' holds the result for the i-th element, and the unused bits of the
+// last word are cleared.
+
+inline constexpr std::size_t kMaskWordBits = 64;
+
+constexpr std::size_t maskWords(std::size_t size) {
+  return (size + kMaskWordBits - 1) / kMaskWordBits;
+}
+
+// The packed results for the elements in [first, last), where 'last - first <= kMaskWordBits'. The
+// word is built in a register, rather than in memory, so that consecutive vectors do not wait on
+// each other's stores.
+template <class Isa, std::floating_point F, class Op, class... Spans>
+std::uint64_t maskWord(const Op& op, std::size_t first, std::size_t last, Spans... inputs) {
+  std::uint64_t result = 0;
+
+  std::size_t index = first;
+  if constexpr (kHasVector<Isa, F>) {
+    using V = Vector<Isa, F>;
+
+    for (; index + V::kLanes <= last; index += V::kLanes) {
+      result |= op.template vectorized<V>(V::load(&inputs[index])...) << (index - first);
+    }
+  }
+  for (; index < last; ++index) {
+    result |= std::uint64_t{op.scalar(inputs[index]...)} << (index - first);
+  }
+  return result;
+}
+
+template <class Isa, class Op, std::floating_point F>
+void mask(const Op& op, std::span<const F> input, std::span<std::uint64_t> output) {
+  assert(output.size() >= maskWords(input.size()));
+
+  for (std::size_t word = 0; word < maskWords(input.size()); ++word) {
+    const std::size_t kFirst = word * kMaskWordBits;
+    const std::size_t kLast = std::min(kFirst + kMaskWordBits, input.size());
+
+    output[word] = maskWord<Isa, F>(op, kFirst, kLast, input);
+  }
+}
+
+// As above, but for binary predicates.
+template <class Isa, class Op, std::floating_point F>
+void mask(const Op& op,
+          std::span<const F> lhs,
+          std::span<const F> rhs,
+          std::span<std::uint64_t> output) {
+  assert(lhs.size() == rhs.size() and output.size() >= maskWords(lhs.size()));
+
+  for (std::size_t word = 0; word < maskWords(lhs.size()); ++word) {
+    const std::size_t kFirst = word * kMaskWordBits;
+    const std::size_t kLast = std::min(kFirst + kMaskWordBits, lhs.size());
+
+    output[word] = maskWord<Isa, F>(op, kFirst, kLast, lhs, rhs);
+  }
+}
+
+// Number of elements for which the predicate holds.
+template <class Isa, class Op, std::floating_point F>
+std::size_t count(const Op& op, std::span<const F> input) {
+  std::size_t result = 0;
+  for (std::size_t first = 0; first < input.size(); first += kMaskWordBits) {
+    const std::size_t kLast = std::min(first + kMaskWordBits, input.size());
+
+    result += static_cast<std::size_t>(std::popcount(maskWord<Isa, F>(op, first, kLast, input)));
+  }
+  return result;
+}
+
+} // namespace ROBOCIN_SIMD_NATIVE_NAMESPACE
+} // namespace robocin::internal::simd
+
+#endif // ROBOCIN_UTILITY_INTERNAL_SIMD_ALGORITHM_H
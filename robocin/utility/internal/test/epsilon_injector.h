@@ -34,6 +34,20 @@ struct has_epsilon<long double> : std::true_type {
 };
 #endif
 
+#if not defined(ROBOCIN_FLOAT16_EPSILON) && defined(ROBOCIN_HAS_FLOAT16)
+template <>
+struct has_epsilon<float16_t> : std::true_type {
+  static constexpr float16_t epsilon = 1e-2F; // NOLINT(readability-identifier-naming)
+};
+#endif
+
+#if not defined(ROBOCIN_BFLOAT16_EPSILON) && defined(ROBOCIN_HAS_BFLOAT16)
+template <>
+struct has_epsilon<bfloat16_t> : std::true_type {
+  static constexpr bfloat16_t epsilon = 5e-2F; // NOLINT(readability-identifier-naming)
+};
+#endif
+
 } // namespace robocin
 
 #endif // ROBOCIN_UTILITY_INTERNAL_EPSILON_INJECTOR_H
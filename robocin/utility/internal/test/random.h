@@ -0,0 +1,35 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// This file provides the random inputs shared by the tests and benchmarks, which are seeded, so
+// that their failures and timings are reproducible. It should be included in the test and
+// benchmark files, but not in the library files.
+
+#ifndef ROBOCIN_UTILITY_INTERNAL_TEST_RANDOM_H
+#define ROBOCIN_UTILITY_INTERNAL_TEST_RANDOM_H
+
+#include <concepts>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace robocin {
+
+// 'size' values drawn uniformly from [min, max).
+template <std::floating_point T>
+std::vector<T> randomValues(T min, T max, std::size_t size, unsigned seed = 42) {
+  std::mt19937 generator{seed}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{min, max};
+
+  std::vector<T> result(size);
+  for (T& value : result) {
+    value = distribution(generator);
+  }
+  return result;
+}
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_INTERNAL_TEST_RANDOM_H
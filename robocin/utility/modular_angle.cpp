@@ -0,0 +1,14 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/modular_angle.h"
+
+namespace robocin {
+
+template class ModularAngle<std::uint8_t>;
+template class ModularAngle<std::uint16_t>;
+template class ModularAngle<std::uint32_t>;
+
+} // namespace robocin
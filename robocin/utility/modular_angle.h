@@ -0,0 +1,186 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_MODULAR_ANGLE_H
+#define ROBOCIN_UTILITY_MODULAR_ANGLE_H
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/concepts.h"
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+namespace robocin {
+
+template <class Int>
+concept modular_angle_storage = std::unsigned_integral<Int> and not std::same_as<Int, bool>
+                                and sizeof(Int) <= sizeof(std::uint32_t);
+
+// Fixed-point angle, stored as a tick count in [0, TicksPerRevolution). When the number of ticks is
+// a power of two, wraparound is free (unsigned overflow or a bit mask); otherwise, it is a single
+// compare-and-subtract against the compile-time modulus.
+template <modular_angle_storage Int,
+          std::uint64_t TicksPerRevolution = std::uint64_t{std::numeric_limits<Int>::max()} + 1>
+  requires(1 < TicksPerRevolution
+           and TicksPerRevolution <= std::uint64_t{std::numeric_limits<Int>::max()} + 1)
+class ModularAngle {
+  static constexpr bool kIsPowerOfTwo = std::has_single_bit(TicksPerRevolution);
+  static constexpr std::uint64_t kMask = TicksPerRevolution - 1;
+
+  // conversions are made in double (or long double), so that every tick count is representable.
+  template <class T>
+  using conversion_t = std::conditional_t<std::same_as<T, long double>, long double, double>;
+
+ public:
+  using value_type = Int;
+  using difference_type = std::int64_t;
+
+  static constexpr std::uint64_t kTicksPerRevolution = TicksPerRevolution;
+
+  template <std::floating_point F = double>
+  static constexpr F kRadiansPerTick =
+      2 * std::numbers::pi_v<F> / static_cast<F>(TicksPerRevolution);
+
+  constexpr ModularAngle() = default;
+
+  // Tick counts out of [0, TicksPerRevolution) are wrapped around.
+  template <std::integral T>
+  static constexpr ModularAngle fromTicks(T ticks) {
+    if constexpr (kIsPowerOfTwo) {
+      return ModularAngle{static_cast<value_type>(static_cast<std::uint64_t>(ticks) & kMask)};
+    } else if constexpr (std::is_signed_v<T>) {
+      const auto kRemainder = static_cast<difference_type>(ticks)
+                              % static_cast<difference_type>(TicksPerRevolution);
+      return ModularAngle{static_cast<value_type>(
+          kRemainder < 0 ? kRemainder + static_cast<difference_type>(TicksPerRevolution) :
+                           kRemainder)};
+    } else {
+      return ModularAngle{static_cast<value_type>(static_cast<std::uint64_t>(ticks)
+                                                  % TicksPerRevolution)};
+    }
+  }
+
+  // Rounds the given angle, in radians, to the nearest tick.
+  template <arithmetic T>
+  static constexpr ModularAngle fromRadians(T radians) {
+    using F = conversion_t<T>;
+
+    const F kNormalized = normalizeAngleFast(static_cast<F>(radians));
+    const F kTicks = kNormalized / kRadiansPerTick<F>;
+
+    return fromTicks(static_cast<difference_type>(kTicks < 0 ? kTicks - F{0.5} : kTicks + F{0.5}));
+  }
+
+  // Rounds the given angle, in degrees, to the nearest tick.
+  template <arithmetic T>
+  static constexpr ModularAngle fromDegrees(T degrees) {
+    return fromRadians(degreesToRadians(static_cast<conversion_t<T>>(degrees)));
+  }
+
+  [[nodiscard]] constexpr value_type ticks() const { return ticks_; }
+
+  // The angle in radians, in the range [-pi, pi] (as 'normalizeAngle').
+  template <std::floating_point F = double>
+  [[nodiscard]] constexpr F radians() const {
+    return static_cast<F>(signedTicks()) * kRadiansPerTick<F>;
+  }
+
+  // The angle in degrees, in the range [-180, 180].
+  template <std::floating_point F = double>
+  [[nodiscard]] constexpr F degrees() const {
+    return radiansToDegrees(radians<F>());
+  }
+
+  // The tick count in [-TicksPerRevolution / 2, TicksPerRevolution / 2].
+  [[nodiscard]] constexpr difference_type signedTicks() const {
+    const auto kTicks = static_cast<difference_type>(ticks_);
+
+    return ticks_ > TicksPerRevolution / 2 ?
+               kTicks - static_cast<difference_type>(TicksPerRevolution) :
+               kTicks;
+  }
+
+  constexpr ModularAngle& operator+=(ModularAngle other) {
+    if constexpr (kIsPowerOfTwo) {
+      ticks_ = static_cast<value_type>((std::uint64_t{ticks_} + other.ticks_) & kMask);
+    } else {
+      const std::uint64_t kSum = std::uint64_t{ticks_} + other.ticks_;
+      ticks_ =
+          static_cast<value_type>(kSum >= TicksPerRevolution ? kSum - TicksPerRevolution : kSum);
+    }
+    return *this;
+  }
+
+  constexpr ModularAngle& operator-=(ModularAngle other) {
+    if constexpr (kIsPowerOfTwo) {
+      ticks_ = static_cast<value_type>((std::uint64_t{ticks_} - other.ticks_) & kMask);
+    } else {
+      const std::uint64_t kDiff = std::uint64_t{ticks_} - other.ticks_;
+      ticks_ = static_cast<value_type>(ticks_ >= other.ticks_ ? kDiff : kDiff + TicksPerRevolution);
+    }
+    return *this;
+  }
+
+  friend constexpr ModularAngle operator+(ModularAngle lhs, ModularAngle rhs) { return lhs += rhs; }
+  friend constexpr ModularAngle operator-(ModularAngle lhs, ModularAngle rhs) { return lhs -= rhs; }
+  friend constexpr ModularAngle operator-(ModularAngle angle) { return ModularAngle{} - angle; }
+
+  // Compares the tick counts, i.e. the angles in [0, 2 * pi).
+  friend constexpr bool operator==(ModularAngle lhs, ModularAngle rhs) = default;
+  friend constexpr std::strong_ordering operator<=>(ModularAngle lhs, ModularAngle rhs) = default;
+
+ private:
+  constexpr explicit ModularAngle(value_type ticks) : ticks_{ticks} {}
+
+  value_type ticks_{};
+};
+
+// Smallest signed difference, in ticks, from 'lhs' to 'rhs' (as 'smallestAngleDiff').
+template <class Int, std::uint64_t Ticks>
+constexpr auto smallestAngleDiff(ModularAngle<Int, Ticks> lhs, ModularAngle<Int, Ticks> rhs) {
+  return (rhs - lhs).signedTicks();
+}
+
+// Absolute value of the smallest difference, in ticks, between 'lhs' and 'rhs' (as
+// 'absSmallestAngleDiff').
+template <class Int, std::uint64_t Ticks>
+constexpr auto absSmallestAngleDiff(ModularAngle<Int, Ticks> lhs, ModularAngle<Int, Ticks> rhs) {
+  const auto kDiff = smallestAngleDiff(lhs, rhs);
+  return kDiff < 0 ? -kDiff : kDiff;
+}
+
+// Compare if two given angles are equal, using a given epsilon, in radians ------------------------
+template <class Int, std::uint64_t Ticks, std::floating_point F>
+constexpr bool fuzzyCmpEqual(ModularAngle<Int, Ticks> lhs,
+                             ModularAngle<Int, Ticks> rhs,
+                             F epsilon,
+                             FuzzyCallSite site = {}) {
+  constexpr F kRadiansPerTick = ModularAngle<Int, Ticks>::template kRadiansPerTick<F>;
+
+  return fuzzyIsZero(static_cast<F>(absSmallestAngleDiff(lhs, rhs)) * kRadiansPerTick,
+                     epsilon,
+                     site);
+}
+
+// Compare if two given angles are equal, using the injected epsilon, in radians -------------------
+template <class Int, std::uint64_t Ticks, std::floating_point F = double>
+constexpr bool fuzzyCmpEqual(ModularAngle<Int, Ticks> lhs,
+                             ModularAngle<Int, Ticks> rhs,
+                             FuzzyCallSite site = {})
+  requires(has_epsilon_v<F>)
+{
+  return fuzzyCmpEqual(lhs, rhs, epsilon_v<F>, site);
+}
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_MODULAR_ANGLE_H
@@ -0,0 +1,127 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/modular_angle.h"
+
+#include <cstdint>
+#include <numbers>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using ModularAngleTestTypes = Types<ModularAngle<std::uint8_t>,        // full range, 256 ticks
+                                    ModularAngle<std::uint16_t>,       // full range, 65'536 ticks
+                                    ModularAngle<std::uint16_t, 4096>, // 12-bit encoder
+                                    ModularAngle<std::uint16_t, 3600>, // tenths of degree
+                                    ModularAngle<std::uint32_t, 1'000'000>>;
+
+template <class>
+class ModularAngleTest : public Test {};
+TYPED_TEST_SUITE(ModularAngleTest, ModularAngleTestTypes);
+
+TYPED_TEST(ModularAngleTest, HasTheSizeOfItsStorage) {
+  using Angle = TypeParam;
+
+  static_assert(sizeof(Angle) == sizeof(typename Angle::value_type));
+}
+
+TYPED_TEST(ModularAngleTest, FromTicksWrapsAround) {
+  using Angle = TypeParam;
+
+  static constexpr auto kTicks = static_cast<std::int64_t>(Angle::kTicksPerRevolution);
+
+  EXPECT_EQ(Angle::fromTicks(0).ticks(), 0);
+  EXPECT_EQ(Angle::fromTicks(kTicks).ticks(), 0);
+  EXPECT_EQ(Angle::fromTicks(kTicks + 1).ticks(), 1);
+  EXPECT_EQ(Angle::fromTicks(-1).ticks(), kTicks - 1);
+  EXPECT_EQ(Angle::fromTicks(-kTicks - 1).ticks(), kTicks - 1);
+  EXPECT_EQ(Angle::fromTicks(std::uint64_t{3} * kTicks + 2).ticks(), 2);
+}
+
+TYPED_TEST(ModularAngleTest, AddAndSubtractWrapAround) {
+  using Angle = TypeParam;
+
+  static constexpr auto kTicks = static_cast<std::int64_t>(Angle::kTicksPerRevolution);
+  static constexpr Angle kLast = Angle::fromTicks(kTicks - 1);
+  static constexpr Angle kOne = Angle::fromTicks(1);
+
+  static_assert((kLast + kOne).ticks() == 0);
+  static_assert((Angle{} - kOne).ticks() == kTicks - 1);
+  static_assert((-kOne) == kLast);
+  static_assert((kLast + kLast).ticks() == kTicks - 2);
+  static_assert((kOne - kLast).ticks() == 2);
+  static_assert(kOne < kLast);
+}
+
+TYPED_TEST(ModularAngleTest, FromRadiansAndFromDegreesGivenPiFractions) {
+  using Angle = TypeParam;
+
+  static constexpr double kPi = std::numbers::pi;
+  static constexpr double kHalfTick = Angle::template kRadiansPerTick<double> / 2;
+
+  for (const double kAngle : {0.0, kPi / 3, -kPi / 2, 3 * kPi / 4, kPi, 5 * kPi / 2, -kPi / 6}) {
+    EXPECT_LE(absSmallestAngleDiff(Angle::fromRadians(kAngle).radians(), kAngle), kHalfTick);
+    EXPECT_EQ(Angle::fromDegrees(radiansToDegrees(kAngle)), Angle::fromRadians(kAngle));
+  }
+  EXPECT_NEAR(Angle::fromDegrees(90).degrees(), 90.0, radiansToDegrees(kHalfTick));
+}
+
+TYPED_TEST(ModularAngleTest, RadiansAreInMinusPiAndPi) {
+  using Angle = TypeParam;
+
+  static constexpr double kPi = std::numbers::pi;
+  static constexpr auto kTicks = static_cast<std::int64_t>(Angle::kTicksPerRevolution);
+
+  EXPECT_DOUBLE_EQ(Angle::fromTicks(kTicks / 2).radians(), kPi);
+  EXPECT_LT(Angle::fromTicks(kTicks / 2 + 1).radians(), 0.0);
+  EXPECT_GT(Angle::fromTicks(kTicks / 2 + 1).radians(), -kPi);
+}
+
+TYPED_TEST(ModularAngleTest, SmallestAngleDiffMatchesTheFloatingPointOne) {
+  using Angle = TypeParam;
+
+  static constexpr double kRadiansPerTick = Angle::template kRadiansPerTick<double>;
+  static constexpr auto kTicks = static_cast<std::int64_t>(Angle::kTicksPerRevolution);
+
+  for (const std::int64_t kLhs : {std::int64_t{0}, kTicks / 7, kTicks / 2, kTicks - 1}) {
+    for (const std::int64_t kRhs : {std::int64_t{0}, kTicks / 3, kTicks / 2 + 1, kTicks - 2}) {
+      const Angle kLhsAngle = Angle::fromTicks(kLhs);
+      const Angle kRhsAngle = Angle::fromTicks(kRhs);
+
+      const double kExpected = smallestAngleDiff(kLhsAngle.radians(), kRhsAngle.radians());
+      const double kDiff = smallestAngleDiff(kLhsAngle, kRhsAngle) * kRadiansPerTick;
+      const double kAbsDiff = absSmallestAngleDiff(kLhsAngle, kRhsAngle) * kRadiansPerTick;
+
+      // pi and -pi are the same difference.
+      EXPECT_NEAR(absSmallestAngleDiff(kDiff, kExpected), 0.0, 1e-9);
+      EXPECT_NEAR(kAbsDiff, std::abs(kExpected), 1e-9);
+    }
+  }
+}
+
+TYPED_TEST(ModularAngleTest, FuzzyCmpEqualAcrossTheSeam) {
+  using Angle = TypeParam;
+
+  static constexpr double kEpsilon = epsilon_v<double>;
+  static constexpr double kPi = std::numbers::pi;
+  static constexpr auto kTicks = static_cast<std::int64_t>(Angle::kTicksPerRevolution);
+
+  EXPECT_TRUE(fuzzyCmpEqual(Angle::fromTicks(0), Angle::fromTicks(kTicks)));
+  EXPECT_TRUE(fuzzyCmpEqual(Angle::fromRadians(kPi), Angle::fromRadians(-kPi)));
+  // two ticks apart, i.e. 4 * pi / kTicks radians.
+  EXPECT_TRUE(fuzzyCmpEqual(Angle::fromTicks(-1), Angle::fromTicks(1), 5 * kPi / kTicks));
+  EXPECT_FALSE(fuzzyCmpEqual(Angle::fromTicks(-1), Angle::fromTicks(1), 3 * kPi / kTicks));
+  EXPECT_FALSE(fuzzyCmpEqual(Angle::fromRadians(0), Angle::fromRadians(kPi / 2), kEpsilon));
+}
+
+} // namespace
+} // namespace robocin
@@ -0,0 +1,134 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/point2d.h"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "robocin/utility/internal/point2d_dispatch.h"
+#include "robocin/utility/internal/point2d_kernels.h"
+
+namespace robocin {
+
+template struct Point2D<float>;
+template struct Point2D<double>;
+template struct Point2D<long double>;
+
+template class Point2DArray<float>;
+template class Point2DArray<double>;
+template class Point2DArray<long double>;
+
+constinit const internal::Point2DKernelSet internal::kScalarPoint2DKernels =
+    internal::point2DKernelSet<internal::simd::None>();
+#if defined(__SSE2__)
+constinit const internal::Point2DKernelSet internal::kSse2Point2DKernels =
+    internal::point2DKernelSet<internal::simd::Sse2>();
+#endif
+
+namespace {
+
+namespace simd = internal::simd;
+
+using internal::Point2DKernels;
+
+constexpr internal::SimdKernelTable<internal::Point2DKernelSet> kKernelTable{
+    &internal::kScalarPoint2DKernels,
+#if defined(__SSE2__)
+    &internal::kSse2Point2DKernels,
+#else
+    nullptr,
+#endif
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+    &internal::kAvx2Point2DKernels,
+    &internal::kAvx512Point2DKernels,
+#else
+    nullptr,
+    nullptr,
+#endif
+};
+
+// The kernels of the active instruction set, for 'F'.
+template <std::floating_point F>
+const Point2DKernels<F>& kernels() {
+  const internal::Point2DKernelSet& kSet = internal::dispatchSimdKernels(kKernelTable);
+  if constexpr (std::same_as<F, float>) {
+    return kSet.for_float;
+  } else {
+    return kSet.for_double;
+  }
+}
+
+} // namespace
+
+void pointDistances(std::span<const float> xs,
+                    std::span<const float> ys,
+                    Point2D<float> point,
+                    std::span<float> distances) {
+  kernels<float>().distances(xs, ys, point, distances);
+}
+
+void pointDistances(std::span<const double> xs,
+                    std::span<const double> ys,
+                    Point2D<double> point,
+                    std::span<double> distances) {
+  kernels<double>().distances(xs, ys, point, distances);
+}
+
+void pointDistances(std::span<const long double> xs,
+                    std::span<const long double> ys,
+                    Point2D<long double> point,
+                    std::span<long double> distances) {
+  internal::distancesKernel<simd::None>(xs, ys, point, distances);
+}
+
+std::size_t nearestPointIndex(std::span<const float> xs,
+                              std::span<const float> ys,
+                              Point2D<float> point) {
+  return kernels<float>().nearest(xs, ys, point);
+}
+
+std::size_t nearestPointIndex(std::span<const double> xs,
+                              std::span<const double> ys,
+                              Point2D<double> point) {
+  return kernels<double>().nearest(xs, ys, point);
+}
+
+std::size_t nearestPointIndex(std::span<const long double> xs,
+                              std::span<const long double> ys,
+                              Point2D<long double> point) {
+  return internal::nearestKernel<simd::None>(xs, ys, point);
+}
+
+void pointsInRadiusMask(std::span<const float> xs,
+                        std::span<const float> ys,
+                        Point2D<float> point,
+                        float radius,
+                        float epsilon,
+                        std::span<std::uint64_t> mask) {
+  kernels<float>().in_radius_mask(xs, ys, point, radius, epsilon, mask);
+}
+
+void pointsInRadiusMask(std::span<const double> xs,
+                        std::span<const double> ys,
+                        Point2D<double> point,
+                        double radius,
+                        double epsilon,
+                        std::span<std::uint64_t> mask) {
+  kernels<double>().in_radius_mask(xs, ys, point, radius, epsilon, mask);
+}
+
+void pointsInRadiusMask(std::span<const long double> xs,
+                        std::span<const long double> ys,
+                        Point2D<long double> point,
+                        long double radius,
+                        long double epsilon,
+                        std::span<std::uint64_t> mask) {
+  internal::inRadiusKernel<simd::None>(xs, ys, point, radius, epsilon, mask);
+}
+
+} // namespace robocin
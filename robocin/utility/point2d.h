@@ -0,0 +1,405 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_POINT2D_H
+#define ROBOCIN_UTILITY_POINT2D_H
+
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "robocin/utility/concepts.h"
+#include "robocin/utility/epsilon.h"
+#include "robocin/utility/fuzzy_compare.h"
+#include "robocin/utility/type_traits.h"
+
+namespace robocin {
+
+// Point (or vector) in the plane, whose equality and ordering are fuzzy: two points are equal when
+// both of their coordinates are 'fuzzyCmpEqual', and are ordered by their x coordinates, and then
+// by their y coordinates, as 'fuzzyCmpThreeWay' orders them. As every fuzzy equality, it is not
+// transitive, hence points should not be the keys of ordered containers.
+//
+// The results that are not coordinates (e.g. 'norm' or 'angle') are given in the floating point
+// type in which the coordinates are compared (e.g. 'double' for integers), and computed in its
+// widened type (e.g. 'float' for the half precision types).
+template <arithmetic T>
+struct Point2D {
+  using value_type = T;
+  using floating_point_type = common_floating_point_for_comparison_t<T>;
+
+  T x{};
+  T y{};
+
+  template <arithmetic U>
+  constexpr explicit operator Point2D<U>() const {
+    return {static_cast<U>(x), static_cast<U>(y)};
+  }
+
+  constexpr Point2D& operator+=(Point2D other) {
+    x += other.x;
+    y += other.y;
+    return *this;
+  }
+
+  constexpr Point2D& operator-=(Point2D other) {
+    x -= other.x;
+    y -= other.y;
+    return *this;
+  }
+
+  constexpr Point2D& operator*=(T factor) {
+    x *= factor;
+    y *= factor;
+    return *this;
+  }
+
+  constexpr Point2D& operator/=(T divisor) {
+    x /= divisor;
+    y /= divisor;
+    return *this;
+  }
+
+  friend constexpr Point2D operator+(Point2D lhs, Point2D rhs) { return lhs += rhs; }
+  friend constexpr Point2D operator-(Point2D lhs, Point2D rhs) { return lhs -= rhs; }
+  friend constexpr Point2D operator-(Point2D point) {
+    return {static_cast<T>(-point.x), static_cast<T>(-point.y)};
+  }
+  friend constexpr Point2D operator*(Point2D point, T factor) { return point *= factor; }
+  friend constexpr Point2D operator*(T factor, Point2D point) { return point *= factor; }
+  friend constexpr Point2D operator/(Point2D point, T divisor) { return point /= divisor; }
+
+  // Equal within the injected epsilon.
+  friend constexpr bool operator==(Point2D lhs, Point2D rhs)
+    requires(has_epsilon_v<floating_point_type>)
+  {
+    return fuzzyCmpEqual(lhs, rhs);
+  }
+
+  friend constexpr std::strong_ordering operator<=>(Point2D lhs, Point2D rhs)
+    requires(has_epsilon_v<floating_point_type>)
+  {
+    return fuzzyCmpThreeWay(lhs, rhs);
+  }
+
+  [[nodiscard]] constexpr T dot(Point2D other) const {
+    return static_cast<T>(x * other.x + y * other.y);
+  }
+
+  // The z coordinate of the cross product: positive if 'other' is counterclockwise from this point.
+  [[nodiscard]] constexpr T cross(Point2D other) const {
+    return static_cast<T>(x * other.y - y * other.x);
+  }
+
+  [[nodiscard]] constexpr T squaredNorm() const { return dot(*this); }
+
+  [[nodiscard]] constexpr floating_point_type norm() const {
+    const W kX = static_cast<W>(x);
+    const W kY = static_cast<W>(y);
+
+    return static_cast<floating_point_type>(std::sqrt(kX * kX + kY * kY));
+  }
+
+  [[nodiscard]] constexpr T squaredDistance(Point2D other) const {
+    return (*this - other).squaredNorm();
+  }
+
+  [[nodiscard]] constexpr floating_point_type distance(Point2D other) const {
+    const W kDx = static_cast<W>(x) - static_cast<W>(other.x);
+    const W kDy = static_cast<W>(y) - static_cast<W>(other.y);
+
+    return static_cast<floating_point_type>(std::sqrt(kDx * kDx + kDy * kDy));
+  }
+
+  // The angle of this point (from the positive x axis, counterclockwise), in radians, in [-pi, pi],
+  // as 'normalizeAngle' gives it. 0 at the origin.
+  [[nodiscard]] constexpr floating_point_type angle() const {
+    return static_cast<floating_point_type>(std::atan2(static_cast<W>(y), static_cast<W>(x)));
+  }
+
+  // The angle from this point to 'other', in [-pi, pi], i.e. 'smallestAngleDiff(angle(),
+  // other.angle())', computed from their dot and cross products, without any normalization.
+  [[nodiscard]] constexpr floating_point_type angleTo(Point2D other) const {
+    const W kX = static_cast<W>(x);
+    const W kY = static_cast<W>(y);
+    const W kOtherX = static_cast<W>(other.x);
+    const W kOtherY = static_cast<W>(other.y);
+
+    return static_cast<floating_point_type>(
+        std::atan2(kX * kOtherY - kY * kOtherX, kX * kOtherX + kY * kOtherY));
+  }
+
+  // This point rotated counterclockwise around the origin by 'angle', in radians, in any range, so
+  // that the angle of the result is 'normalizeAngle(angle() + angle)'.
+  [[nodiscard]] constexpr Point2D<floating_point_type> rotate(floating_point_type angle) const {
+    const W kX = static_cast<W>(x);
+    const W kY = static_cast<W>(y);
+    const W kCos = std::cos(static_cast<W>(angle));
+    const W kSin = std::sin(static_cast<W>(angle));
+
+    return {static_cast<floating_point_type>(kX * kCos - kY * kSin),
+            static_cast<floating_point_type>(kX * kSin + kY * kCos)};
+  }
+
+  // As above, but around 'pivot'.
+  [[nodiscard]] constexpr Point2D<floating_point_type> rotate(floating_point_type angle,
+                                                              Point2D pivot) const {
+    using P = Point2D<floating_point_type>;
+
+    return (static_cast<P>(*this) - static_cast<P>(pivot)).rotate(angle) + static_cast<P>(pivot);
+  }
+
+ private:
+  using W = widened_floating_point_t<floating_point_type>;
+};
+
+// Fuzzy comparisons -------------------------------------------------------------------------------
+// The following overloads compare both coordinates of two points, as the scalar functions of
+// 'fuzzy_compare.h' compare two values, with the same policies and tolerances: points are equal if
+// both of their coordinates are, and are ordered lexicographically.
+
+// Compare if two given points are equal, using a policy and a given tolerance ---------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(Point2D<T> lhs, Point2D<U> rhs, V tolerance, FuzzyCallSite site = {}) {
+  return fuzzyCmpEqual<Policy>(lhs.x, rhs.x, tolerance, site)
+         and fuzzyCmpEqual<Policy>(lhs.y, rhs.y, tolerance, site);
+}
+
+// Compare if two given points are equal, using a policy and its tolerance -------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(Point2D<T> lhs, Point2D<U> rhs, FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpEqual<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
+}
+
+// Compare if two given points are equal, using a given epsilon ------------------------------------
+template <arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(Point2D<T> lhs, Point2D<U> rhs, V epsilon, FuzzyCallSite site = {}) {
+  return fuzzyCmpEqual<AbsoluteComparison>(lhs, rhs, epsilon, site);
+}
+
+// Compare if two given points are equal, using the injected epsilon -------------------------------
+template <arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr bool fuzzyCmpEqual(Point2D<T> lhs, Point2D<U> rhs, FuzzyCallSite site = {})
+  requires(has_epsilon_v<V>)
+{
+  return fuzzyCmpEqual(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Three-way compare two given points, using a policy and a given tolerance ------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(Point2D<T> lhs,
+                                                Point2D<U> rhs,
+                                                V tolerance,
+                                                FuzzyCallSite site = {}) {
+  if (const std::strong_ordering kOrder = fuzzyCmpThreeWay<Policy>(lhs.x, rhs.x, tolerance, site);
+      kOrder != std::strong_ordering::equal) {
+    return kOrder;
+  }
+  return fuzzyCmpThreeWay<Policy>(lhs.y, rhs.y, tolerance, site);
+}
+
+// Three-way compare two given points, using a policy and its tolerance ----------------------------
+template <fuzzy_comparison_policy Policy,
+          arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(Point2D<T> lhs,
+                                                Point2D<U> rhs,
+                                                FuzzyCallSite site = {})
+  requires(has_default_tolerance_v<Policy, V>)
+{
+  return fuzzyCmpThreeWay<Policy>(lhs, rhs, Policy::template tolerance<V>(), site);
+}
+
+// Three-way compare two given points, using a given epsilon ---------------------------------------
+template <arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(Point2D<T> lhs,
+                                                Point2D<U> rhs,
+                                                V epsilon,
+                                                FuzzyCallSite site = {}) {
+  return fuzzyCmpThreeWay<AbsoluteComparison>(lhs, rhs, epsilon, site);
+}
+
+// Three-way compare two given points, using the injected epsilon ----------------------------------
+template <arithmetic T,
+          arithmetic U,
+          floating_point V = common_floating_point_for_comparison_t<T, U>>
+constexpr std::strong_ordering fuzzyCmpThreeWay(Point2D<T> lhs,
+                                                Point2D<U> rhs,
+                                                FuzzyCallSite site = {})
+  requires(has_epsilon_v<V>)
+{
+  return fuzzyCmpThreeWay(lhs, rhs, epsilon_v<V>, site);
+}
+
+// Batch overloads ---------------------------------------------------------------------------------
+// The following functions apply the functions of 'Point2D' to every point given by its coordinates,
+// 'xs' and 'ys' (a structure of arrays, as 'Point2DArray' stores them), using vectorized kernels
+// for 'float' and 'double' whenever the target supports them. 'xs' and 'ys' must have the same
+// size.
+
+// The distance from every point to 'point', as 'Point2D::distance' gives it. 'distances' must have
+// the size of 'xs'.
+void pointDistances(std::span<const float> xs,
+                    std::span<const float> ys,
+                    Point2D<float> point,
+                    std::span<float> distances);
+void pointDistances(std::span<const double> xs,
+                    std::span<const double> ys,
+                    Point2D<double> point,
+                    std::span<double> distances);
+void pointDistances(std::span<const long double> xs,
+                    std::span<const long double> ys,
+                    Point2D<long double> point,
+                    std::span<long double> distances);
+
+// The index of the point closest to 'point' (the first one, on ties), or the number of points when
+// there is none. Points with a NaN coordinate are skipped.
+std::size_t nearestPointIndex(std::span<const float> xs,
+                              std::span<const float> ys,
+                              Point2D<float> point);
+std::size_t nearestPointIndex(std::span<const double> xs,
+                              std::span<const double> ys,
+                              Point2D<double> point);
+std::size_t nearestPointIndex(std::span<const long double> xs,
+                              std::span<const long double> ys,
+                              Point2D<long double> point);
+
+// Whether every point lies within 'radius' of 'point', i.e. 'fuzzyCmpLessEqual(distance, radius,
+// epsilon)', written as the packed bitmasks of 'fuzzyCmpEqualMask': 'mask' must have at least
+// 'fuzzyMaskSize(xs.size())' words.
+void pointsInRadiusMask(std::span<const float> xs,
+                        std::span<const float> ys,
+                        Point2D<float> point,
+                        float radius,
+                        float epsilon,
+                        std::span<std::uint64_t> mask);
+void pointsInRadiusMask(std::span<const double> xs,
+                        std::span<const double> ys,
+                        Point2D<double> point,
+                        double radius,
+                        double epsilon,
+                        std::span<std::uint64_t> mask);
+void pointsInRadiusMask(std::span<const long double> xs,
+                        std::span<const long double> ys,
+                        Point2D<long double> point,
+                        long double radius,
+                        long double epsilon,
+                        std::span<std::uint64_t> mask);
+
+// Points in a structure of arrays: their x and y coordinates are stored in two separate arrays, so
+// that the batch overloads above process the coordinates of several points at once, e.g. to find
+// the robot closest to the ball, or the candidate points within reach of a robot, every frame.
+//
+// 'clear' keeps the allocated memory, so that an array refilled every frame stops allocating once
+// it has seen its largest frame.
+template <std::floating_point F>
+class Point2DArray {
+ public:
+  using value_type = Point2D<F>;
+  using size_type = std::size_t;
+
+  Point2DArray() = default;
+
+  explicit Point2DArray(std::span<const value_type> points) {
+    reserve(points.size());
+    for (const value_type& point : points) {
+      push_back(point);
+    }
+  }
+
+  [[nodiscard]] size_type size() const { return xs_.size(); }
+  [[nodiscard]] bool empty() const { return xs_.empty(); }
+
+  void reserve(size_type size) {
+    xs_.reserve(size);
+    ys_.reserve(size);
+  }
+
+  // Removes every point, but keeps the allocated memory.
+  void clear() {
+    xs_.clear();
+    ys_.clear();
+  }
+
+  void push_back(value_type point) {
+    xs_.push_back(point.x);
+    ys_.push_back(point.y);
+  }
+
+  [[nodiscard]] value_type operator[](size_type index) const {
+    assert(index < size());
+
+    return {xs_[index], ys_[index]};
+  }
+
+  void set(size_type index, value_type point) {
+    assert(index < size());
+
+    xs_[index] = point.x;
+    ys_[index] = point.y;
+  }
+
+  // The coordinates of the points, which may be updated in place.
+  [[nodiscard]] std::span<F> xs() { return xs_; }
+  [[nodiscard]] std::span<const F> xs() const { return xs_; }
+  [[nodiscard]] std::span<F> ys() { return ys_; }
+  [[nodiscard]] std::span<const F> ys() const { return ys_; }
+
+  // The distance from every point to 'point'. 'distances' must have 'size()' elements.
+  void distances(value_type point, std::span<F> distances) const {
+    pointDistances(xs(), ys(), point, distances);
+  }
+
+  // The index of the point closest to 'point' (the first one, on ties), if any.
+  [[nodiscard]] std::optional<size_type> nearest(value_type point) const {
+    const size_type kIndex = nearestPointIndex(xs(), ys(), point);
+    return kIndex < size() ? std::optional{kIndex} : std::nullopt;
+  }
+
+  // Whether every point lies within 'radius' of 'point', using a given epsilon (see
+  // 'pointsInRadiusMask'). 'mask' must have at least 'fuzzyMaskSize(size())' words.
+  void inRadiusMask(value_type point, F radius, F epsilon, std::span<std::uint64_t> mask) const {
+    pointsInRadiusMask(xs(), ys(), point, radius, epsilon, mask);
+  }
+
+  // As above, but using the injected epsilon.
+  void inRadiusMask(value_type point, F radius, std::span<std::uint64_t> mask) const
+    requires(has_epsilon_v<F>)
+  {
+    inRadiusMask(point, radius, epsilon_v<F>, mask);
+  }
+
+ private:
+  std::vector<F> xs_;
+  std::vector<F> ys_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_POINT2D_H
@@ -0,0 +1,39 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+// The kernels of the batch overloads of 'point2d.h', compiled for AVX2 (see 'cpu_dispatch.h').
+
+#include "robocin/utility/internal/point2d_dispatch.h"
+
+#if defined(ROBOCIN_HAS_SIMD_DISPATCH)
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include <immintrin.h>
+
+#include "robocin/utility/type_traits.h"
+
+// As in 'angular_avx2.cpp', every header the kernels depend on is included before the target
+// changes, so that only the kernels themselves are compiled for AVX2.
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define ROBOCIN_SIMD_TARGET_AVX2
+#include "robocin/utility/internal/point2d_kernels.h"
+#pragma GCC pop_options
+
+namespace robocin {
+
+constinit const internal::Point2DKernelSet internal::kAvx2Point2DKernels =
+    internal::point2DKernelSet<internal::simd::Avx2>();
+
+} // namespace robocin
+#endif
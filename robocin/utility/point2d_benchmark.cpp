@@ -0,0 +1,135 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/point2d.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+template <class T>
+std::vector<Point2D<T>> randomPoints(std::size_t size) {
+  std::mt19937 generator{42}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{-4'500, 4'500};
+
+  std::vector<Point2D<T>> result(size);
+  for (Point2D<T>& point : result) {
+    point = {distribution(generator), distribution(generator)};
+  }
+  return result;
+}
+
+// The loops the array replaces: the functions of 'Point2D', over an array of structures.
+
+template <class T>
+void BM_PointDistances(benchmark::State& state) {
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(static_cast<std::size_t>(state.range(0)));
+  std::vector<T> distances(kPoints.size());
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+      distances[i] = kPoints[i].distance({100, -200});
+    }
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kPoints.size()));
+}
+
+template <class T>
+void BM_Point2DArrayDistances(benchmark::State& state) {
+  const Point2DArray<T> kArray{randomPoints<T>(static_cast<std::size_t>(state.range(0)))};
+  std::vector<T> distances(kArray.size());
+
+  for (auto _ : state) {
+    kArray.distances({100, -200}, distances);
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kArray.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_PointDistances, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_PointDistances, double)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayDistances, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayDistances, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_PointNearest(benchmark::State& state) {
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    std::size_t nearest = 0;
+    for (std::size_t i = 1; i < kPoints.size(); ++i) {
+      if (kPoints[i].squaredDistance({100, -200}) < kPoints[nearest].squaredDistance({100, -200})) {
+        nearest = i;
+      }
+    }
+    benchmark::DoNotOptimize(nearest);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kPoints.size()));
+}
+
+template <class T>
+void BM_Point2DArrayNearest(benchmark::State& state) {
+  const Point2DArray<T> kArray{randomPoints<T>(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kArray.nearest({100, -200}));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kArray.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_PointNearest, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_PointNearest, double)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayNearest, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayNearest, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_PointInRadius(benchmark::State& state) {
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(static_cast<std::size_t>(state.range(0)));
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kPoints.size()));
+
+  for (auto _ : state) {
+    std::ranges::fill(mask, 0);
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+      mask[i / 64] |= std::uint64_t{fuzzyCmpLessEqual(kPoints[i].distance({100, -200}), T{1'000})}
+                      << (i % 64);
+    }
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kPoints.size()));
+}
+
+template <class T>
+void BM_Point2DArrayInRadius(benchmark::State& state) {
+  const Point2DArray<T> kArray{randomPoints<T>(static_cast<std::size_t>(state.range(0)))};
+  std::vector<std::uint64_t> mask(fuzzyMaskSize(kArray.size()));
+
+  for (auto _ : state) {
+    kArray.inRadiusMask({100, -200}, T{1'000}, mask);
+    benchmark::DoNotOptimize(mask.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kArray.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_PointInRadius, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_PointInRadius, double)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayInRadius, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_Point2DArrayInRadius, double)->Arg(16)->Arg(4'096);
+
+} // namespace
+} // namespace robocin
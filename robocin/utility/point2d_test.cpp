@@ -0,0 +1,269 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/point2d.h"
+
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/cpu_dispatch.h"
+#include "robocin/utility/internal/test/epsilon_injector.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+template <class T>
+std::vector<Point2D<T>> randomPoints(std::size_t size, T min, T max, unsigned seed = 42) {
+  std::mt19937 generator{seed}; // NOLINT(cert-msc*-cpp)
+  std::uniform_real_distribution<T> distribution{min, max};
+
+  std::vector<Point2D<T>> result(size);
+  for (Point2D<T>& point : result) {
+    point = {distribution(generator), distribution(generator)};
+  }
+  return result;
+}
+
+// Point2D -----------------------------------------------------------------------------------------
+
+TEST(Point2DTest, IsConstexpr) {
+  static constexpr Point2D<int> kLhs{3, 4};
+  static constexpr Point2D<int> kRhs{-1, 2};
+
+  static_assert((kLhs + kRhs).x == 2 and (kLhs + kRhs).y == 6);
+  static_assert((kLhs - kRhs).x == 4 and (kLhs - kRhs).y == 2);
+  static_assert((-kLhs).x == -3 and (2 * kLhs).y == 8 and (kLhs / 2).x == 1);
+  static_assert(kLhs.dot(kRhs) == 5);
+  static_assert(kLhs.cross(kRhs) == 10);
+  static_assert(kLhs.squaredNorm() == 25);
+  static_assert(kLhs.squaredDistance(kRhs) == 20);
+  static_assert(fuzzyCmpEqual(kLhs, Point2D<double>{3.00001, 4}));
+  static_assert(kLhs != kRhs);
+  static_assert(kRhs < kLhs);
+}
+
+TEST(Point2DTest, IntegersAreComputedInDouble) {
+  const Point2D<int> kPoint{3, 4};
+
+  static_assert(std::same_as<decltype(kPoint.norm()), double>);
+  static_assert(std::same_as<decltype(kPoint.rotate(1.0)), Point2D<double>>);
+
+  EXPECT_DOUBLE_EQ(kPoint.norm(), 5);
+  EXPECT_DOUBLE_EQ(kPoint.distance({0, 0}), 5);
+  EXPECT_DOUBLE_EQ(kPoint.angle(), std::atan2(4.0, 3.0));
+  EXPECT_TRUE(fuzzyCmpEqual(kPoint.rotate(std::numbers::pi / 2), Point2D<double>{-4, 3}));
+  EXPECT_TRUE(fuzzyCmpEqual(static_cast<Point2D<double>>(kPoint), Point2D<double>{3, 4}));
+}
+
+TYPED_TEST(FloatingPointTest, Arithmetic) {
+  using T = TypeParam;
+
+  Point2D<T> point{1, 2};
+  point += {3, 4};
+  EXPECT_EQ(point.x, 4);
+  EXPECT_EQ(point.y, 6);
+
+  point -= {1, 1};
+  point *= 2;
+  point /= 4;
+  EXPECT_EQ(point.x, T{1.5});
+  EXPECT_EQ(point.y, T{2.5});
+
+  EXPECT_EQ((Point2D<T>{1, 0}.cross({0, 1})), 1);
+  EXPECT_EQ((Point2D<T>{0, 1}.cross({1, 0})), -1);
+  EXPECT_EQ((Point2D<T>{1, 2}.dot({3, 4})), 11);
+  EXPECT_EQ((Point2D<T>{3, 4}.norm()), 5);
+  EXPECT_EQ((Point2D<T>{4, 6}.distance({1, 2})), 5);
+}
+
+TYPED_TEST(FloatingPointTest, FuzzyEqualityAndOrdering) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const Point2D<T> kPoint{1, 2};
+
+  EXPECT_EQ(kPoint, (Point2D<T>{1 + kEpsilon / 2, 2 - kEpsilon / 2}));
+  EXPECT_NE(kPoint, (Point2D<T>{1 + 2 * kEpsilon, 2}));
+  EXPECT_NE(kPoint, (Point2D<T>{1, 2 + 2 * kEpsilon}));
+
+  // ordered by x, and then by y, within epsilon.
+  EXPECT_EQ(kPoint <=> (Point2D<T>{1 + kEpsilon / 2, 2}), std::strong_ordering::equal);
+  EXPECT_LT(kPoint, (Point2D<T>{1 + 2 * kEpsilon, 0}));
+  EXPECT_LT(kPoint, (Point2D<T>{1 + kEpsilon / 2, 3}));
+  EXPECT_GT(kPoint, (Point2D<T>{1 - kEpsilon / 2, 1}));
+  EXPECT_GE(kPoint, (Point2D<T>{1 - kEpsilon / 2, 2 + kEpsilon / 2}));
+
+  // given tolerances and policies.
+  EXPECT_TRUE(fuzzyCmpEqual(kPoint, Point2D<T>{1.5, 2.5}, T{0.5}));
+  EXPECT_FALSE(fuzzyCmpEqual(kPoint, Point2D<T>{1.5, 2.5}, T{0.25}));
+  EXPECT_TRUE(fuzzyCmpEqual<RelativeComparison>(Point2D<T>{1'000, 2'000},
+                                                Point2D<T>{1'001, 2'001},
+                                                T{1e-2}));
+  EXPECT_EQ(fuzzyCmpThreeWay(kPoint, Point2D<T>{1.5, 0}, T{0.25}), std::strong_ordering::less);
+  EXPECT_EQ(fuzzyCmpThreeWay<AbsoluteComparison>(kPoint, Point2D<T>{1.5, 0}, T{0.5}),
+            std::strong_ordering::greater);
+}
+
+TYPED_TEST(FloatingPointTest, AnglesAreConsistentWithAngular) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  EXPECT_EQ((Point2D<T>{}.angle()), 0);
+  EXPECT_EQ((Point2D<T>{-1, 0}.angle()), std::numbers::pi_v<T>);
+
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(100, -10, 10);
+  for (std::size_t i = 1; i < kPoints.size(); ++i) {
+    const Point2D<T> kLhs = kPoints[i - 1];
+    const Point2D<T> kRhs = kPoints[i];
+
+    EXPECT_EQ(normalizeAngle(kLhs.angle()), kLhs.angle());
+    const T kDiff = smallestAngleDiff(kLhs.angle(), kRhs.angle());
+    EXPECT_LE(absSmallestAngleDiff(kLhs.angleTo(kRhs), kDiff), kEpsilon);
+
+    const T kAngle = kRhs.x;
+    const Point2D<T> kRotated = kLhs.rotate(kAngle);
+    EXPECT_LE(absSmallestAngleDiff(kRotated.angle(), normalizeAngle(kLhs.angle() + kAngle)),
+              kEpsilon);
+    EXPECT_LE(std::abs(kRotated.norm() - kLhs.norm()), kEpsilon);
+
+    // around a pivot, the distance to the pivot is kept.
+    const Point2D<T> kAround = kLhs.rotate(kAngle, kRhs);
+    EXPECT_LE(std::abs(kAround.distance(kRhs) - kLhs.distance(kRhs)), kEpsilon);
+    EXPECT_LE(absSmallestAngleDiff((kAround - kRhs).angle(), (kLhs - kRhs).angle() + kAngle),
+              kEpsilon);
+  }
+}
+
+// Point2DArray ------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointTest, ArrayStoresTheCoordinatesApart) {
+  using T = TypeParam;
+
+  const std::vector<Point2D<T>> kPoints = randomPoints<T>(10, -10, 10);
+
+  Point2DArray<T> array{kPoints};
+  ASSERT_EQ(array.size(), kPoints.size());
+  for (std::size_t i = 0; i < kPoints.size(); ++i) {
+    EXPECT_EQ(array.xs()[i], kPoints[i].x);
+    EXPECT_EQ(array.ys()[i], kPoints[i].y);
+    EXPECT_EQ(array[i].x, kPoints[i].x);
+  }
+
+  array.set(3, {1, 2});
+  array.xs()[4] = 5;
+  EXPECT_EQ(array[3].y, 2);
+  EXPECT_EQ(array[4].x, 5);
+
+  array.clear();
+  EXPECT_TRUE(array.empty());
+  EXPECT_FALSE(array.nearest({}).has_value());
+}
+
+TYPED_TEST(FloatingPointTest, ArrayKernelsMatchThePointFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kRadius = 5;
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  // the kernels of every instruction set, which the long double overloads ignore.
+  for (const SimdIsa kIsa : kSimdIsas) {
+    if (not isSimdIsaSupported(kIsa)) {
+      continue;
+    }
+    const ScopedSimdIsa kScope{kIsa};
+
+    // sizes around the widest vectors, so that both the vectorized and the remaining points run.
+    for (const std::size_t kSize : {1, 7, 15, 16, 17, 33, 1'000}) {
+      const Point2DArray<T> kArray{randomPoints<T>(kSize, -10, 10, static_cast<unsigned>(kSize))};
+      const Point2D<T> kPoint{T{0.5}, T{-1.5}};
+
+      std::vector<T> distances(kSize);
+      kArray.distances(kPoint, distances);
+
+      std::vector<std::uint64_t> mask(fuzzyMaskSize(kSize), ~std::uint64_t{0});
+      kArray.inRadiusMask(kPoint, kRadius, mask);
+
+      std::size_t nearest = 0;
+      for (std::size_t i = 0; i < kSize; ++i) {
+        const T kDistance = kArray[i].distance(kPoint);
+
+        EXPECT_LE(std::abs(distances[i] - kDistance), kEpsilon)
+            << simdIsaName(kIsa) << ' ' << kSize << ' ' << i;
+        EXPECT_EQ((mask[i / 64] >> (i % 64)) & 1, fuzzyCmpLessEqual(kDistance, kRadius, kEpsilon))
+            << simdIsaName(kIsa) << ' ' << kSize << ' ' << i;
+
+        if (kArray[i].squaredDistance(kPoint) < kArray[nearest].squaredDistance(kPoint)) {
+          nearest = i;
+        }
+      }
+      EXPECT_EQ(kArray.nearest(kPoint), nearest) << simdIsaName(kIsa) << ' ' << kSize;
+
+      // the unused bits of the last word are cleared.
+      if (kSize % 64 != 0) {
+        EXPECT_EQ(mask.back() >> (kSize % 64), 0) << simdIsaName(kIsa) << ' ' << kSize;
+      }
+    }
+  }
+}
+
+TYPED_TEST(FloatingPointTest, InRadiusIsFuzzy) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const Point2DArray<T> kArray{std::vector<Point2D<T>>{
+      {1, 0},
+      {1 + kEpsilon / 2, 0},
+      {1 + 2 * kEpsilon, 0},
+      {0, -1 + kEpsilon / 2},
+  }};
+
+  std::vector<std::uint64_t> mask(1);
+  kArray.inRadiusMask({}, 1, mask);
+  EXPECT_EQ(mask[0], 0b1011);
+
+  kArray.inRadiusMask({}, 1, 0, mask);
+  EXPECT_EQ(mask[0], 0b1001);
+}
+
+TYPED_TEST(FloatingPointTest, NearestTakesTheFirstOnTiesAndSkipsNaN) {
+  using T = TypeParam;
+
+  static constexpr T kNaN = std::numeric_limits<T>::quiet_NaN();
+
+  std::vector<Point2D<T>> points(40, Point2D<T>{10, 10});
+  points[0] = {kNaN, 0};
+  points[21] = {1, 1};
+  points[25] = {-1, -1};
+  points[39] = {0, kNaN};
+
+  EXPECT_EQ(Point2DArray<T>{points}.nearest({}), 21);
+
+  const Point2DArray<T> kAllNaN{std::vector<Point2D<T>>(20, Point2D<T>{kNaN, 0})};
+  EXPECT_FALSE(kAllNaN.nearest({}).has_value());
+}
+
+} // namespace
+} // namespace robocin
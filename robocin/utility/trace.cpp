@@ -0,0 +1,279 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/trace.h"
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace robocin {
+namespace {
+
+// The buffer of a thread, kept by the registry until the session drains it after the thread exits.
+struct ThreadState {
+  internal::TraceBuffer buffer;
+  std::uint32_t tid = 0;
+  std::atomic<bool> exited{false};
+  std::string name;          // guarded by the mutex of the registry.
+  bool name_written = false; // idem.
+};
+
+class Registry {
+ public:
+  std::shared_ptr<ThreadState> attach() {
+    auto state = std::make_shared<ThreadState>();
+
+    const std::lock_guard kLock{mutex_};
+    state->tid = next_tid_++;
+    states_.push_back(state);
+    return state;
+  }
+
+  void setName(ThreadState& state, std::string_view name) {
+    const std::lock_guard kLock{mutex_};
+    state.name = name;
+    state.name_written = false;
+  }
+
+  // the name of the thread, if it has not been written since it was set.
+  std::optional<std::string> takeName(ThreadState& state) {
+    const std::lock_guard kLock{mutex_};
+    if (state.name_written or state.name.empty()) {
+      return std::nullopt;
+    }
+    state.name_written = true;
+    return state.name;
+  }
+
+  std::vector<std::shared_ptr<ThreadState>> states() {
+    const std::lock_guard kLock{mutex_};
+    return states_;
+  }
+
+  // forgets the given states, whose threads have exited and whose buffers have been drained since.
+  void forget(const std::vector<const ThreadState*>& drained) {
+    const std::lock_guard kLock{mutex_};
+    std::erase_if(states_, [&](const std::shared_ptr<ThreadState>& state) {
+      if (std::ranges::find(drained, state.get()) == drained.end()) {
+        return false;
+      }
+      forgotten_dropped_ += state->buffer.dropped();
+      return true;
+    });
+  }
+
+  std::uint64_t dropped() {
+    const std::lock_guard kLock{mutex_};
+    std::uint64_t result = forgotten_dropped_;
+    for (const auto& state : states_) {
+      result += state->buffer.dropped();
+    }
+    return result;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadState>> states_;
+  std::uint32_t next_tid_ = 1;
+  std::uint64_t forgotten_dropped_ = 0;
+};
+
+// leaked, so that the threads which exit after the static objects are destroyed may detach.
+Registry& registry() {
+  static auto* const kRegistry = new Registry;
+  return *kRegistry;
+}
+
+// the state of the calling thread, which is marked as exited when the thread exits.
+class ThreadHandle {
+ public:
+  ThreadHandle() : state_{registry().attach()} { internal::trace_buffer = &state_->buffer; }
+
+  ThreadHandle(const ThreadHandle&) = delete;
+  ThreadHandle& operator=(const ThreadHandle&) = delete;
+
+  ~ThreadHandle() {
+    internal::trace_buffer = nullptr;
+    state_->exited.store(true, std::memory_order_release);
+  }
+
+  ThreadState& state() { return *state_; }
+
+ private:
+  std::shared_ptr<ThreadState> state_;
+};
+
+ThreadState& threadState() {
+  thread_local ThreadHandle handle;
+  return handle.state();
+}
+
+constexpr int kPid = 1;
+
+void writeJsonString(std::ostream& os, std::string_view text) {
+  os << '"';
+  for (const char kChar : text) {
+    if (kChar == '"' or kChar == '\\') {
+      os << '\\' << kChar;
+    } else if (static_cast<unsigned char>(kChar) < 0x20) {
+      os << ' ';
+    } else {
+      os << kChar;
+    }
+  }
+  os << '"';
+}
+
+// writes nanoseconds as microseconds, with 3 decimal places, as Chrome traces expect.
+void writeMicroseconds(std::ostream& os, std::uint64_t nanoseconds) {
+  const std::uint64_t kFraction = nanoseconds % 1000;
+  os << nanoseconds / 1000 << '.' << kFraction / 100 << kFraction / 10 % 10 << kFraction % 10;
+}
+
+void writeNumber(std::ostream& os, double value) {
+  if (not std::isfinite(value)) {
+    os << "null";
+    return;
+  }
+  std::array<char, 32> buffer{};
+  const auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  os << std::string_view{buffer.data(), end};
+}
+
+} // namespace
+
+internal::TraceBuffer& internal::registerTraceThread() { return threadState().buffer; }
+
+void setTraceThreadName(std::string_view name) { registry().setName(threadState(), name); }
+
+TraceSession::TraceSession(std::ostream& os, std::chrono::milliseconds period) :
+    os_{os},
+    begin_ticks_{internal::traceTicks()},
+    begin_time_{std::chrono::steady_clock::now()} {
+  os_ << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+#if defined(ROBOCIN_ENABLE_TRACE)
+  // the events of a previous session, recorded while it was being destroyed, are discarded.
+  for (const auto& state : registry().states()) {
+    state->buffer.drain([](const internal::TraceEvent&) {});
+  }
+  dropped_before_ = registry().dropped();
+
+  [[maybe_unused]] const bool kWasRecording = internal::trace_recording.exchange(true);
+  assert(not kWasRecording && "only one TraceSession may exist at a time");
+
+  flusher_ = std::jthread{[this, period](const std::stop_token& stop) {
+    std::unique_lock lock{mutex_};
+    while (not stop.stop_requested()) {
+      wakeup_.wait_for(lock, stop, period, [] { return false; });
+      drain();
+    }
+  }};
+#else
+  static_cast<void>(period);
+#endif
+}
+
+TraceSession::~TraceSession() {
+#if defined(ROBOCIN_ENABLE_TRACE)
+  internal::trace_recording.store(false);
+
+  flusher_.request_stop();
+  flusher_.join();
+  flush();
+#endif
+
+  os_ << "\n]}\n";
+  os_.flush();
+}
+
+void TraceSession::flush() {
+  const std::lock_guard kLock{mutex_};
+  drain();
+}
+
+std::uint64_t TraceSession::dropped() const {
+#if defined(ROBOCIN_ENABLE_TRACE)
+  return registry().dropped() - dropped_before_;
+#else
+  return 0;
+#endif
+}
+
+void TraceSession::drain() {
+#if defined(ROBOCIN_ENABLE_TRACE)
+  // the ticks are converted to nanoseconds by the rate measured since the session began.
+  const std::uint64_t kNowTicks = internal::traceTicks();
+  const auto kElapsed = std::chrono::steady_clock::now() - begin_time_;
+  const long double kNanosecondsPerTick =
+      kNowTicks > begin_ticks_ ?
+          static_cast<long double>(std::chrono::nanoseconds{kElapsed}.count())
+              / static_cast<long double>(kNowTicks - begin_ticks_) :
+          1.0L;
+
+  const auto kToNanoseconds = [&](std::uint64_t ticks) -> std::uint64_t {
+    return ticks <= begin_ticks_ ?
+               0 :
+               std::llround(static_cast<long double>(ticks - begin_ticks_) * kNanosecondsPerTick);
+  };
+
+  const auto kWriteSeparator = [this] {
+    os_ << (first_event_ ? "\n" : ",\n");
+    first_event_ = false;
+  };
+
+  std::vector<const ThreadState*> drained;
+  for (const auto& state : registry().states()) {
+    const bool kExited = state->exited.load(std::memory_order_acquire);
+
+    if (const auto kName = registry().takeName(*state)) {
+      kWriteSeparator();
+      os_ << R"({"name":"thread_name","ph":"M","pid":)" << kPid << R"(,"tid":)" << state->tid
+          << R"(,"args":{"name":)";
+      writeJsonString(os_, *kName);
+      os_ << "}}";
+    }
+
+    state->buffer.drain([&](const internal::TraceEvent& event) {
+      kWriteSeparator();
+      os_ << R"({"name":)";
+      writeJsonString(os_, event.name);
+      const std::uint64_t kBegin = kToNanoseconds(event.begin);
+
+      if (event.kind == internal::TraceEventKind::kSpan) {
+        os_ << R"(,"ph":"X","ts":)";
+        writeMicroseconds(os_, kBegin);
+        os_ << R"(,"dur":)";
+        writeMicroseconds(os_, std::max(kToNanoseconds(event.end), kBegin) - kBegin);
+        os_ << R"(,"pid":)" << kPid << R"(,"tid":)" << state->tid << '}';
+      } else {
+        os_ << R"(,"ph":"C","ts":)";
+        writeMicroseconds(os_, kBegin);
+        os_ << R"(,"pid":)" << kPid << R"(,"tid":)" << state->tid << R"(,"args":{"value":)";
+        writeNumber(os_, std::bit_cast<double>(event.end));
+        os_ << "}}";
+      }
+    });
+
+    // the thread had exited before its buffer was drained, hence it is empty from now on.
+    if (kExited) {
+      drained.push_back(state.get());
+    }
+  }
+
+  if (not drained.empty()) {
+    registry().forget(drained);
+  }
+#endif
+}
+
+} // namespace robocin
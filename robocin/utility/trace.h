@@ -0,0 +1,214 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_TRACE_H
+#define ROBOCIN_UTILITY_TRACE_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+// A scoped tracer, whose spans and counters are written as Chrome trace events (the JSON read by
+// 'chrome://tracing' and 'ui.perfetto.dev'), to see where the time of a frame goes:
+//
+//   TraceSession session{file};       // records until destroyed, flushing every 100 ms.
+//   ...
+//   void Pipeline::run() {
+//     TraceSpan span{"Pipeline::run"}; // from here to the end of the scope.
+//     traceCounter("tracked_robots", robots.size());
+//   }
+//
+// Spans and counters are recorded only while a session exists, into a ring buffer of the calling
+// thread, which only that thread writes and only the session reads, hence without locks nor atomic
+// read-modify-write instructions; they are dropped while it is full. A span costs two reads of the
+// time stamp counter (of the steady clock, on targets without one) and a write to the buffer, which
+// the session converts to nanoseconds, in its own thread.
+//
+// The tracer is compiled out when the 'ROBOCIN_TRACE' CMake option is OFF (which undefines
+// 'ROBOCIN_ENABLE_TRACE'): spans and counters are then empty, and sessions write empty traces.
+
+namespace robocin {
+
+#if defined(ROBOCIN_ENABLE_TRACE)
+inline constexpr bool kTraceEnabled = true;
+#else
+inline constexpr bool kTraceEnabled = false;
+#endif
+
+namespace internal {
+
+enum class TraceEventKind : std::uint8_t { kSpan, kCounter };
+
+// A span, from 'begin' to 'end' (in ticks of 'traceTicks'), or a counter value, as the bits of a
+// double in 'end', measured at 'begin'.
+struct TraceEvent {
+  const char* name;
+  std::uint64_t begin;
+  std::uint64_t end;
+  TraceEventKind kind;
+};
+
+// The time stamp counter, on x86 (which is invariant on the targets this tracer is used on), or the
+// steady clock, in nanoseconds, otherwise.
+inline std::uint64_t traceTicks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+#endif
+}
+
+// A single-producer single-consumer ring of events: the thread it belongs to pushes, and the
+// session pops. 'head_' and 'tail_' count the events pushed and popped since its creation.
+class TraceBuffer {
+ public:
+  static constexpr std::size_t kCapacity = std::size_t{1} << 13;
+
+  void push(const TraceEvent& event) noexcept {
+    const std::uint64_t kHead = head_.load(std::memory_order_relaxed);
+    if (kHead - cached_tail_ == kCapacity) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (kHead - cached_tail_ == kCapacity) {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    events_[kHead % kCapacity] = event;
+    head_.store(kHead + 1, std::memory_order_release);
+  }
+
+  // Calls 'consume(event)' for every event pushed so far, in order, then frees their slots.
+  template <class Consume>
+  void drain(Consume consume) {
+    const std::uint64_t kTail = tail_.load(std::memory_order_relaxed);
+    const std::uint64_t kHead = head_.load(std::memory_order_acquire);
+    for (std::uint64_t i = kTail; i < kHead; ++i) {
+      consume(events_[i % kCapacity]);
+    }
+    tail_.store(kHead, std::memory_order_release);
+  }
+
+  [[nodiscard]] std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  alignas(64) std::atomic<std::uint64_t> head_{0};
+  std::uint64_t cached_tail_ = 0;
+  std::atomic<std::uint64_t> dropped_{0};
+  alignas(64) std::atomic<std::uint64_t> tail_{0};
+  std::array<TraceEvent, kCapacity> events_{};
+};
+
+// Whether a session is recording, read by every span and counter.
+inline constinit std::atomic<bool> trace_recording{false}; // NOLINT(readability-identifier-naming)
+
+// The buffer of the calling thread, or null before its first event. 'constinit', so that it is read
+// by a single load, without the guard of a dynamically initialized thread_local.
+inline constinit thread_local TraceBuffer* trace_buffer = nullptr; // NOLINT(*-identifier-naming)
+
+// Creates the buffer of the calling thread, which is kept until the session drains it after the
+// thread exits.
+TraceBuffer& registerTraceThread();
+
+inline void pushTraceEvent(const TraceEvent& event) noexcept {
+  TraceBuffer* buffer = trace_buffer;
+  (buffer != nullptr ? *buffer : registerTraceThread()).push(event);
+}
+
+} // namespace internal
+
+// Records the time from its construction to its destruction as a span named 'name', which must be
+// a string whose lifetime is the one of the program (e.g. a literal), when a session is recording.
+class TraceSpan {
+ public:
+#if defined(ROBOCIN_ENABLE_TRACE)
+  explicit TraceSpan(const char* name) noexcept :
+      name_{internal::trace_recording.load(std::memory_order_relaxed) ? name : nullptr},
+      begin_{name_ != nullptr ? internal::traceTicks() : 0} {}
+
+  ~TraceSpan() {
+    if (name_ != nullptr) {
+      internal::pushTraceEvent(
+          {name_, begin_, internal::traceTicks(), internal::TraceEventKind::kSpan});
+    }
+  }
+#else
+  explicit constexpr TraceSpan(const char* /*name*/) noexcept {}
+#endif
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+#if defined(ROBOCIN_ENABLE_TRACE)
+ private:
+  const char* name_;
+  std::uint64_t begin_;
+#endif
+};
+
+// Records the value of the counter named 'name' (as 'TraceSpan'), when a session is recording.
+inline void traceCounter([[maybe_unused]] const char* name,
+                         [[maybe_unused]] double value) noexcept {
+#if defined(ROBOCIN_ENABLE_TRACE)
+  if (internal::trace_recording.load(std::memory_order_relaxed)) {
+    internal::pushTraceEvent({name,
+                              internal::traceTicks(),
+                              std::bit_cast<std::uint64_t>(value),
+                              internal::TraceEventKind::kCounter});
+  }
+#endif
+}
+
+// Names the calling thread in the traces (e.g. "vision"), instead of its number.
+void setTraceThreadName(std::string_view name);
+
+// Records the spans and counters of every thread while it exists, writing them to 'os' as a Chrome
+// trace (a JSON object, whose 'traceEvents' are complete events, 'X', and counter events, 'C', with
+// timestamps in microseconds since its construction, with nanosecond precision). A background
+// thread writes the events every 'period', and the remaining ones on destruction, which completes
+// the JSON. Only one session may exist at a time, and 'os' must outlive it.
+class TraceSession {
+ public:
+  static constexpr std::chrono::milliseconds kDefaultPeriod{100};
+
+  explicit TraceSession(std::ostream& os, std::chrono::milliseconds period = kDefaultPeriod);
+
+  TraceSession(const TraceSession&) = delete;
+  TraceSession& operator=(const TraceSession&) = delete;
+
+  ~TraceSession();
+
+  // Writes the events recorded so far, as the background thread does.
+  void flush();
+
+  // The number of events dropped, since their buffers were full, during the session.
+  [[nodiscard]] std::uint64_t dropped() const;
+
+ private:
+  // writes the events recorded so far; 'mutex_' must be held.
+  void drain();
+
+  std::ostream& os_;
+  std::mutex mutex_;
+  bool first_event_ = true;
+  std::uint64_t dropped_before_ = 0;
+  std::uint64_t begin_ticks_;
+  std::chrono::steady_clock::time_point begin_time_;
+  std::condition_variable_any wakeup_;
+  std::jthread flusher_;
+};
+
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_TRACE_H
@@ -0,0 +1,78 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/trace.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include <benchmark/benchmark.h>
+
+namespace robocin {
+namespace {
+
+// fewer spans than the capacity of a buffer, so that none is dropped between two flushes.
+constexpr std::size_t kSpansPerFlush = internal::TraceBuffer::kCapacity / 2;
+
+// a stream without a buffer, which discards what is written to it.
+std::ostream& nullStream() {
+  static std::ostream os{nullptr};
+  return os;
+}
+
+// a read of the time stamp counter, of which a span takes two: the lower bound of its cost.
+void BM_TraceTicks(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(internal::traceTicks());
+  }
+}
+
+BENCHMARK(BM_TraceTicks);
+
+void BM_TraceSpanWithoutSession(benchmark::State& state) {
+  for (auto _ : state) {
+    const TraceSpan kSpan{"span"};
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_TraceSpanWithoutSession);
+
+void BM_TraceSpan(benchmark::State& state) {
+  TraceSession session{nullStream(), std::chrono::hours{1}};
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSpansPerFlush; ++i) {
+      const TraceSpan kSpan{"span"};
+      benchmark::ClobberMemory();
+    }
+    state.PauseTiming();
+    session.flush();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSpansPerFlush));
+}
+
+BENCHMARK(BM_TraceSpan);
+
+void BM_TraceCounter(benchmark::State& state) {
+  TraceSession session{nullStream(), std::chrono::hours{1}};
+  double value = 0;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSpansPerFlush; ++i) {
+      traceCounter("counter", value += 1);
+    }
+    state.PauseTiming();
+    session.flush();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSpansPerFlush));
+}
+
+BENCHMARK(BM_TraceCounter);
+
+} // namespace
+} // namespace robocin
@@ -0,0 +1,217 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace robocin {
+namespace {
+
+using std::chrono_literals::operator""ms;
+
+// The fields of a trace event, parsed from a line of the trace.
+struct Event {
+  std::string name;
+  std::string phase;
+  double timestamp = 0;
+  double duration = 0;
+  int tid = 0;
+  std::string args;
+};
+
+std::vector<Event> parseEvents(const std::string& trace) {
+  static const std::regex kEventRegex{
+      R"re(\{"name":"([^"]*)","ph":"(\w)"(?:,"ts":([0-9.]+))?(?:,"dur":([0-9.]+))?)re"
+      R"re(,"pid":1,"tid":(\d+)(?:,"args":\{(.*)\})?\})re"};
+
+  std::vector<Event> events;
+  std::istringstream lines{trace};
+  for (std::string line; std::getline(lines, line);) {
+    std::smatch match;
+    if (std::regex_search(line, match, kEventRegex)) {
+      events.push_back({match[1],
+                        match[2],
+                        match[3].matched ? std::stod(match[3]) : 0,
+                        match[4].matched ? std::stod(match[4]) : 0,
+                        std::stoi(match[5]),
+                        match[6]});
+    }
+  }
+  return events;
+}
+
+std::vector<Event> eventsNamed(const std::vector<Event>& events, const std::string& name) {
+  std::vector<Event> result;
+  std::ranges::copy_if(events, std::back_inserter(result), [&](const Event& event) {
+    return event.name == name;
+  });
+  return result;
+}
+
+TEST(TraceTest, SessionWritesAChromeTrace) {
+  std::ostringstream os;
+  { const TraceSession kSession{os}; }
+
+  const std::string kTrace = os.str();
+  EXPECT_TRUE(kTrace.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[)"));
+  EXPECT_TRUE(kTrace.ends_with("]}\n"));
+}
+
+#if defined(ROBOCIN_ENABLE_TRACE)
+
+TEST(TraceTest, RecordsNestedSpans) {
+  std::ostringstream os;
+  {
+    const TraceSession kSession{os};
+    const TraceSpan kOuter{"outer"};
+    {
+      const TraceSpan kInner{"inner"};
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  const std::vector<Event> kEvents = parseEvents(os.str());
+  const auto kOuter = eventsNamed(kEvents, "outer");
+  const auto kInner = eventsNamed(kEvents, "inner");
+  ASSERT_EQ(kOuter.size(), 1U);
+  ASSERT_EQ(kInner.size(), 1U);
+
+  EXPECT_EQ(kOuter[0].phase, "X");
+  EXPECT_EQ(kInner[0].tid, kOuter[0].tid);
+  EXPECT_GE(kInner[0].timestamp, kOuter[0].timestamp);
+  EXPECT_LE(kInner[0].timestamp + kInner[0].duration, kOuter[0].timestamp + kOuter[0].duration);
+  // at least 1 ms, in microseconds, give or take the calibration of the time stamp counter.
+  EXPECT_GE(kInner[0].duration, 900);
+}
+
+TEST(TraceTest, RecordsCounters) {
+  std::ostringstream os;
+  {
+    const TraceSession kSession{os};
+    traceCounter("robots", 3);
+    traceCounter("robots", 2.5);
+  }
+
+  const auto kCounters = eventsNamed(parseEvents(os.str()), "robots");
+  ASSERT_EQ(kCounters.size(), 2U);
+  EXPECT_EQ(kCounters[0].phase, "C");
+  EXPECT_EQ(kCounters[0].args, R"("value":3)");
+  EXPECT_EQ(kCounters[1].args, R"("value":2.5)");
+  EXPECT_LE(kCounters[0].timestamp, kCounters[1].timestamp);
+}
+
+TEST(TraceTest, DoesNotRecordOutsideSessions) {
+  {
+    const TraceSpan kSpan{"outside"};
+    traceCounter("outside", 1);
+  }
+
+  std::ostringstream os;
+  { const TraceSession kSession{os}; }
+
+  EXPECT_TRUE(eventsNamed(parseEvents(os.str()), "outside").empty());
+}
+
+TEST(TraceTest, RecordsEveryThreadWithItsName) {
+  static constexpr int kThreads = 4;
+
+  std::ostringstream os;
+  {
+    const TraceSession kSession{os};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([] {
+        setTraceThreadName("worker");
+        const TraceSpan kSpan{"work"};
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  const std::vector<Event> kEvents = parseEvents(os.str());
+  const auto kWork = eventsNamed(kEvents, "work");
+  ASSERT_EQ(kWork.size(), std::size_t{kThreads});
+
+  std::set<int> tids;
+  for (const Event& event : kWork) {
+    tids.insert(event.tid);
+  }
+  EXPECT_EQ(tids.size(), std::size_t{kThreads});
+
+  const auto kNames = eventsNamed(kEvents, "thread_name");
+  ASSERT_EQ(kNames.size(), std::size_t{kThreads});
+  EXPECT_EQ(kNames[0].phase, "M");
+  EXPECT_EQ(kNames[0].args, R"("name":"worker")");
+}
+
+TEST(TraceTest, DropsEventsWhileTheBufferIsFull) {
+  static constexpr std::size_t kExtra = 10;
+
+  std::ostringstream os;
+  {
+    // long enough for the background thread not to drain the buffer during the test.
+    const TraceSession kSession{os, std::chrono::hours{1}};
+    for (std::size_t i = 0; i < internal::TraceBuffer::kCapacity + kExtra; ++i) {
+      const TraceSpan kSpan{"full"};
+    }
+    EXPECT_EQ(kSession.dropped(), kExtra);
+  }
+
+  EXPECT_EQ(eventsNamed(parseEvents(os.str()), "full").size(), internal::TraceBuffer::kCapacity);
+}
+
+TEST(TraceTest, BackgroundThreadDrainsTheBuffers) {
+  static constexpr std::size_t kChunks = 4;
+
+  std::ostringstream os;
+  {
+    const TraceSession kSession{os, 1ms};
+    for (std::size_t chunk = 0; chunk < kChunks; ++chunk) {
+      for (std::size_t i = 0; i < internal::TraceBuffer::kCapacity / 2; ++i) {
+        const TraceSpan kSpan{"chunk"};
+      }
+      std::this_thread::sleep_for(50ms);
+    }
+    EXPECT_EQ(kSession.dropped(), 0U);
+  }
+
+  EXPECT_EQ(eventsNamed(parseEvents(os.str()), "chunk").size(),
+            kChunks * internal::TraceBuffer::kCapacity / 2);
+}
+
+#else
+
+TEST(TraceTest, SpansAreEmptyAndNothingIsRecordedWhenCompiledOut) {
+  static_assert(std::is_empty_v<TraceSpan>);
+
+  std::ostringstream os;
+  {
+    const TraceSession kSession{os};
+    const TraceSpan kSpan{"span"};
+    traceCounter("counter", 1);
+  }
+
+  EXPECT_TRUE(parseEvents(os.str()).empty());
+}
+
+#endif
+
+} // namespace
+} // namespace robocin
@@ -6,30 +6,130 @@
 #ifndef ROBOCIN_UTILITY_TYPE_TRAITS_H
 #define ROBOCIN_UTILITY_TYPE_TRAITS_H
 
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ranges>
 #include <type_traits>
 
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
+// Half precision floating point types -------------------------------------------------------------
+// 'robocin::float16_t' (IEEE-754 binary16) and 'robocin::bfloat16_t' (bfloat16) are the types of
+// <stdfloat> when the standard library provides them, or the equivalent compiler extensions
+// otherwise (e.g. '_Float16', since GCC 12 on x86-64). They are storage types: their values are
+// widened to 'float' to be computed (see 'widened_floating_point'), and rounded back when stored.
+//
+// They are enabled by 'ROBOCIN_ENABLE_HALF_PRECISION' (the 'ROBOCIN_HALF_PRECISION' CMake option),
+// since their conversions may call the compiler runtime (e.g. '__extendhfsf2', of libgcc_s since
+// GCC 12), and 'ROBOCIN_HAS_FLOAT16' and 'ROBOCIN_HAS_BFLOAT16' are defined when available.
+
+#if defined(ROBOCIN_ENABLE_HALF_PRECISION)
+#if defined(__STDCPP_FLOAT16_T__) || defined(__FLT16_MAX__)
+#define ROBOCIN_HAS_FLOAT16 1
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__) || defined(__BFLT16_MAX__)
+#define ROBOCIN_HAS_BFLOAT16 1
+#endif
+#endif
+
 namespace robocin {
 
+#if defined(ROBOCIN_HAS_FLOAT16) && defined(__STDCPP_FLOAT16_T__)
+using float16_t = std::float16_t;
+#elif defined(ROBOCIN_HAS_FLOAT16)
+using float16_t = _Float16;
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16) && defined(__STDCPP_BFLOAT16_T__)
+using bfloat16_t = std::bfloat16_t;
+#elif defined(ROBOCIN_HAS_BFLOAT16)
+using bfloat16_t = __bf16;
+#endif
+
+// Whether 'T' is one of the half precision types above.
+template <class T>
+struct is_narrow_floating_point : std::false_type {};
+
+#if defined(ROBOCIN_HAS_FLOAT16)
+template <>
+struct is_narrow_floating_point<float16_t> : std::true_type {};
+#endif
+
+#if defined(ROBOCIN_HAS_BFLOAT16)
+template <>
+struct is_narrow_floating_point<bfloat16_t> : std::true_type {};
+#endif
+
+template <class T>
+inline constexpr bool is_narrow_floating_point_v = is_narrow_floating_point<T>::value;
+
+// The type in which values of 'T' are computed: 'float' for the half precision types, which have
+// neither 'std::numeric_limits' nor <cmath> overloads before C++23, and 'T' itself otherwise.
+template <class T>
+struct widened_floating_point {
+  using type = std::conditional_t<is_narrow_floating_point_v<T>, float, T>;
+};
+
+template <class T>
+using widened_floating_point_t = typename widened_floating_point<T>::type;
+
+namespace internal {
+
+// the number of significand bits of a floating point type, including the half precision ones.
+template <class F>
+inline constexpr int kFloatingPointDigits = [] {
+#if defined(ROBOCIN_HAS_FLOAT16)
+  if constexpr (std::same_as<F, float16_t>) {
+    return 11;
+  }
+#endif
+#if defined(ROBOCIN_HAS_BFLOAT16)
+  if constexpr (std::same_as<F, bfloat16_t>) {
+    return 8;
+  }
+#endif
+  return std::numeric_limits<widened_floating_point_t<F>>::digits;
+}();
+
+template <class T>
+inline constexpr bool kIsComparable = std::is_arithmetic_v<T> or is_narrow_floating_point_v<T>;
+
+template <class T>
+inline constexpr bool kIsFloatingPoint =
+    std::is_floating_point_v<T> or is_narrow_floating_point_v<T>;
+
+} // namespace internal
+
 template <class... Args>
 struct common_floating_point_for_comparison;
 
+// the specializations are constrained, instead of failing when instantiated, so that non-arithmetic
+// types are rejected in a SFINAE-friendly way (e.g. in default template arguments).
 template <class T>
+  requires(internal::kIsComparable<T>)
 class common_floating_point_for_comparison<T> {
-  using A = std::enable_if_t<std::is_arithmetic_v<T>, T>;
-
  public:
-  using type = std::conditional_t<std::is_floating_point_v<A>, A, double>;
+  using type = std::conditional_t<internal::kIsFloatingPoint<T>, T, double>;
 };
 
+// the half precision types take part as any other floating point type: the one of lowest precision
+// is chosen (e.g. 'bfloat16_t' over 'float16_t', both of 2 bytes), hence its tolerance.
 template <class T, class U, class... Args>
+  requires(internal::kIsComparable<T> and internal::kIsComparable<U>)
 class common_floating_point_for_comparison<T, U, Args...> {
-  using A = std::enable_if_t<std::is_arithmetic_v<T>, T>;
-  using B = std::enable_if_t<std::is_arithmetic_v<U>, U>;
+  using F = std::conditional_t<internal::kIsFloatingPoint<T>, T, double>;
+  using G = std::conditional_t<internal::kIsFloatingPoint<U>, U, double>;
 
-  using F = std::conditional_t<std::is_floating_point_v<A>, A, double>;
-  using G = std::conditional_t<std::is_floating_point_v<B>, B, double>;
-
-  using H = std::conditional_t<sizeof(F) < sizeof(G), F, G>;
+  using H = std::conditional_t<sizeof(F) < sizeof(G)
+                                   or (sizeof(F) == sizeof(G)
+                                       and internal::kFloatingPointDigits<F>
+                                               < internal::kFloatingPointDigits<G>),
+                               F,
+                               G>;
 
  public:
   using type = typename common_floating_point_for_comparison<H, Args...>::type;
@@ -39,6 +139,51 @@ template <class... Args>
 using common_floating_point_for_comparison_t =
     typename common_floating_point_for_comparison<Args...>::type;
 
+// The value type of a range, or the type itself otherwise, so that the traits of scalars apply to
+// ranges element-wise (e.g. 'common_floating_point_for_comparison_t<range_scalar_t<R>, U>').
+template <class T>
+struct range_scalar {
+  using type = T;
+};
+
+template <std::ranges::range R>
+struct range_scalar<R> {
+  using type = std::ranges::range_value_t<R>;
+};
+
+template <class T>
+using range_scalar_t = typename range_scalar<std::remove_cvref_t<T>>::type;
+
+namespace internal {
+
+// the width, in bytes, of the native vectors used by the vectorized kernels, as chosen by
+// 'internal::simd::Native', or 0 when the target has none.
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+inline constexpr std::size_t kSimdVectorBytes = 64;
+#elif defined(__AVX2__)
+inline constexpr std::size_t kSimdVectorBytes = 32;
+#elif defined(__SSE2__)
+inline constexpr std::size_t kSimdVectorBytes = 16;
+#else
+inline constexpr std::size_t kSimdVectorBytes = 0;
+#endif
+
+} // namespace internal
+
+// The number of values of 'T' processed at once by the vectorized kernels of the batch overloads
+// for the target (e.g. 4 floats with SSE2, 8 with AVX2 and 16 with AVX-512), or 1 when they do not
+// vectorize 'T' (e.g. 'long double' or integers, or targets without SIMD), i.e. run a scalar loop.
+template <class T>
+struct simd_lanes
+    : std::integral_constant<std::size_t,
+                             ((std::same_as<T, float> or std::same_as<T, double>)
+                              and internal::kSimdVectorBytes != 0) ?
+                                 internal::kSimdVectorBytes / sizeof(T) :
+                                 1> {};
+
+template <class T>
+inline constexpr std::size_t simd_lanes_v = simd_lanes<T>::value;
+
 } // namespace robocin
 
 #endif // ROBOCIN_UTILITY_TYPE_TRAITS_H
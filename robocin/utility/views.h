@@ -0,0 +1,162 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#ifndef ROBOCIN_UTILITY_VIEWS_H
+#define ROBOCIN_UTILITY_VIEWS_H
+
+#include <concepts>
+#include <ranges>
+
+#include "robocin/utility/angular.h"
+#include "robocin/utility/concepts.h"
+#include "robocin/utility/fuzzy_compare.h"
+
+// Lazy range adaptors over the functions of 'angular.h' and 'fuzzy_compare.h', so that a pipeline
+// (e.g. normalize, diff against a target, then keep the values close to zero) is a single pass over
+// its input, without temporary containers:
+//
+//   for (const double kDiff : angles | views::angle_diff_to(target) | views::fuzzy_filter_zero) {
+//     ...
+//   }
+//
+// Each adaptor is a 'std::views::transform' or a 'std::views::filter' of the scalar function, hence
+// they compose with each other and with the standard adaptors, and their views model the same
+// concepts as the standard ones (e.g. transforms of random access ranges are random access), so
+// that they can be given to any C++20 ranges algorithm. Elements are computed on every access, as
+// the scalar functions would compute them (hence, a filter after a transform computes the elements
+// it keeps twice).
+//
+// Views neither allocate nor go past the elements they need (e.g. 'std::ranges::find_if' stops at
+// the first match), but they are computed one element at a time: whole pipelines over contiguous
+// floating point ranges are usually faster through the range overloads of 'angular.h', which are
+// vectorized, when every element is needed and the temporary ranges fit in cache.
+
+namespace robocin {
+namespace internal {
+
+struct DegreesToRadiansFn {
+  template <arithmetic T>
+  constexpr auto operator()(T degrees) const {
+    return degreesToRadians(degrees);
+  }
+};
+
+struct RadiansToDegreesFn {
+  template <arithmetic T>
+  constexpr auto operator()(T radians) const {
+    return radiansToDegrees(radians);
+  }
+};
+
+struct NormalizeAngleFn {
+  template <arithmetic T>
+  constexpr auto operator()(T angle) const {
+    return normalizeAngle(angle);
+  }
+};
+
+struct FuzzyIsZeroFn {
+  template <arithmetic T>
+  constexpr bool operator()(T value) const {
+    return fuzzyIsZero(value);
+  }
+};
+
+struct FuzzyIsNotZeroFn {
+  template <arithmetic T>
+  constexpr bool operator()(T value) const {
+    return not fuzzyIsZero(value);
+  }
+};
+
+} // namespace internal
+
+namespace views {
+
+// Angular transforms ------------------------------------------------------------------------------
+
+inline constexpr auto to_radians = std::views::transform(internal::DegreesToRadiansFn{});
+inline constexpr auto to_degrees = std::views::transform(internal::RadiansToDegreesFn{});
+
+// Normalizes every angle to [-pi, pi], as 'normalizeAngle' does.
+inline constexpr auto normalized_angles = std::views::transform(internal::NormalizeAngleFn{});
+
+// The smallest angle difference from every angle to 'target', i.e. 'smallestAngleDiff(x, target)',
+// in [-pi, pi].
+template <arithmetic T>
+constexpr auto angle_diff_to(T target) {
+  return std::views::transform([target]<arithmetic U>(U angle) {
+    return smallestAngleDiff(angle, target);
+  });
+}
+
+// As 'angle_diff_to', but the absolute difference, i.e. 'absSmallestAngleDiff(x, target)'.
+template <arithmetic T>
+constexpr auto abs_angle_diff_to(T target) {
+  return std::views::transform([target]<arithmetic U>(U angle) {
+    return absSmallestAngleDiff(angle, target);
+  });
+}
+
+// Fuzzy filters -----------------------------------------------------------------------------------
+// The following adaptors keep the values for which the fuzzy comparison holds, using the injected
+// epsilon, or a given one (the '_within' forms of the zero filters). The comparisons of the
+// adaptors that take arguments are recorded, by the instrumentation, at their call site.
+
+// Keeps the values close to zero, as 'fuzzyIsZero' does.
+inline constexpr auto fuzzy_filter_zero = std::views::filter(internal::FuzzyIsZeroFn{});
+
+template <std::floating_point V>
+constexpr auto fuzzy_filter_zero_within(V epsilon, FuzzyCallSite site = {}) {
+  return std::views::filter([epsilon, site]<arithmetic U>(U element) {
+    return fuzzyIsZero(element, epsilon, site);
+  });
+}
+
+// Keeps the values that are not close to zero.
+inline constexpr auto fuzzy_filter_nonzero = std::views::filter(internal::FuzzyIsNotZeroFn{});
+
+template <std::floating_point V>
+constexpr auto fuzzy_filter_nonzero_within(V epsilon, FuzzyCallSite site = {}) {
+  return std::views::filter([epsilon, site]<arithmetic U>(U element) {
+    return not fuzzyIsZero(element, epsilon, site);
+  });
+}
+
+// Keeps the values close to 'value', as 'fuzzyCmpEqual' does.
+template <arithmetic T>
+constexpr auto fuzzy_equal_to(T value, FuzzyCallSite site = {}) {
+  return std::views::filter([value, site]<arithmetic U>(U element) {
+    return fuzzyCmpEqual(element, value, site);
+  });
+}
+
+template <arithmetic T, std::floating_point V>
+constexpr auto fuzzy_equal_to(T value, V epsilon, FuzzyCallSite site = {}) {
+  return std::views::filter([value, epsilon, site]<arithmetic U>(U element) {
+    return fuzzyCmpEqual(element, value, epsilon, site);
+  });
+}
+
+// Keeps the values fuzzy less than 'value', as 'fuzzyCmpLess' does (e.g. the angles within a
+// threshold of a target, given 'abs_angle_diff_to(target)').
+template <arithmetic T>
+constexpr auto fuzzy_less_than(T value, FuzzyCallSite site = {}) {
+  return std::views::filter([value, site]<arithmetic U>(U element) {
+    return fuzzyCmpLess(element, value, site);
+  });
+}
+
+template <arithmetic T, std::floating_point V>
+constexpr auto fuzzy_less_than(T value, V epsilon, FuzzyCallSite site = {}) {
+  return std::views::filter([value, epsilon, site]<arithmetic U>(U element) {
+    return fuzzyCmpLess(element, value, epsilon, site);
+  });
+}
+
+} // namespace views
+} // namespace robocin
+
+#endif // ROBOCIN_UTILITY_VIEWS_H
@@ -0,0 +1,125 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/views.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+template <class T>
+std::vector<T> randomAngles(std::size_t size) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  return randomValues<T>(-4 * kPi, 4 * kPi, size);
+}
+
+// The sum of the angles within a threshold of a target, computed by eager steps, each of which
+// stores its results into a temporary container, as the range overloads would.
+template <class T>
+void BM_EagerPipeline(benchmark::State& state) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    std::vector<T> normalized(kAngles.size());
+    normalizeAngle(kAngles, normalized);
+
+    std::vector<T> diffs(kAngles.size());
+    absSmallestAngleDiff(normalized, std::vector<T>(kAngles.size(), kPi / 2), diffs);
+
+    std::vector<T> filtered;
+    for (const T kDiff : diffs) {
+      if (fuzzyCmpLess(kDiff, kPi / 8)) {
+        filtered.push_back(kDiff);
+      }
+    }
+
+    T sum = 0;
+    for (const T kDiff : filtered) {
+      sum += kDiff;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_EagerPipeline, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_EagerPipeline, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_LazyPipeline(benchmark::State& state) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    T sum = 0;
+    for (const T kDiff : kAngles | views::normalized_angles | views::abs_angle_diff_to(kPi / 2)
+                             | views::fuzzy_less_than(kPi / 8)) {
+      sum += kDiff;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_LazyPipeline, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_LazyPipeline, double)->Arg(16)->Arg(4'096);
+
+// The first angle within a threshold of a target, for which the eager steps still process every
+// angle, whereas the lazy pipeline stops at it.
+template <class T>
+void BM_EagerFind(benchmark::State& state) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    std::vector<T> normalized(kAngles.size());
+    normalizeAngle(kAngles, normalized);
+
+    std::vector<T> diffs(kAngles.size());
+    absSmallestAngleDiff(normalized, std::vector<T>(kAngles.size(), kPi / 2), diffs);
+
+    benchmark::DoNotOptimize(
+        *std::ranges::find_if(diffs, [](T diff) { return fuzzyCmpLess(diff, kPi / 8); }));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_EagerFind, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_EagerFind, double)->Arg(16)->Arg(4'096);
+
+template <class T>
+void BM_LazyFind(benchmark::State& state) {
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomAngles<T>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    auto pipeline = kAngles | views::normalized_angles | views::abs_angle_diff_to(kPi / 2)
+                    | views::fuzzy_less_than(kPi / 8);
+    benchmark::DoNotOptimize(*pipeline.begin());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kAngles.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_LazyFind, float)->Arg(16)->Arg(4'096);
+BENCHMARK_TEMPLATE(BM_LazyFind, double)->Arg(16)->Arg(4'096);
+
+} // namespace
+} // namespace robocin
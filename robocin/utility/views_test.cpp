@@ -0,0 +1,138 @@
+//
+// Created by José Cruz <joseviccruz> on 16/10/26.
+// Copyright (c) 2026 RobôCIn.
+//
+
+#include "robocin/utility/views.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <numbers>
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "robocin/utility/internal/test/epsilon_injector.h"
+#include "robocin/utility/internal/test/random.h"
+
+namespace robocin {
+namespace {
+
+using ::testing::Test;
+using ::testing::Types;
+
+using FloatingPointTestTypes = Types<float, double, long double>;
+
+template <class>
+class FloatingPointTest : public Test {};
+TYPED_TEST_SUITE(FloatingPointTest, FloatingPointTestTypes);
+
+constexpr std::size_t kNumValues = 1'003;
+
+// the transforms keep the category of their input, and the filters are bidirectional.
+static_assert(std::ranges::random_access_range<decltype(std::vector<double>{}
+                                                        | views::normalized_angles
+                                                        | views::angle_diff_to(1.0))>);
+static_assert(std::ranges::sized_range<decltype(std::vector<float>{} | views::to_radians)>);
+static_assert(std::ranges::bidirectional_range<decltype(std::vector<float>{}
+                                                        | views::fuzzy_filter_zero)>);
+
+TYPED_TEST(FloatingPointTest, TransformsMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+
+  const std::vector<T> kAngles = randomValues<T>(-4 * kPi, 4 * kPi, kNumValues);
+  const T kTarget = kPi * 7 / 8;
+
+  const auto kNormalized = kAngles | views::normalized_angles;
+  const auto kDiffs = kAngles | views::angle_diff_to(kTarget);
+  const auto kAbsDiffs = kAngles | views::abs_angle_diff_to(kTarget);
+  const auto kRadians = kAngles | views::to_radians;
+  const auto kDegrees = kAngles | views::to_degrees;
+
+  ASSERT_EQ(std::ranges::size(kNormalized), kAngles.size());
+  for (std::size_t i = 0; i < kAngles.size(); ++i) {
+    EXPECT_EQ(kNormalized[i], normalizeAngle(kAngles[i]));
+    EXPECT_EQ(kDiffs[i], smallestAngleDiff(kAngles[i], kTarget));
+    EXPECT_EQ(kAbsDiffs[i], absSmallestAngleDiff(kAngles[i], kTarget));
+    EXPECT_EQ(kRadians[i], degreesToRadians(kAngles[i]));
+    EXPECT_EQ(kDegrees[i], radiansToDegrees(kAngles[i]));
+  }
+}
+
+TYPED_TEST(FloatingPointTest, FiltersMatchTheScalarFunctions) {
+  using T = TypeParam;
+
+  static constexpr T kEpsilon = epsilon_v<T>;
+
+  const std::vector<T> kValues = randomValues<T>(-4 * kEpsilon, 4 * kEpsilon, kNumValues);
+
+  const auto kExpectFiltered = [&](auto&& view, auto predicate) {
+    std::vector<T> expected;
+    std::ranges::copy_if(kValues, std::back_inserter(expected), predicate);
+    EXPECT_TRUE(std::ranges::equal(view, expected));
+    EXPECT_FALSE(expected.empty());
+  };
+
+  kExpectFiltered(kValues | views::fuzzy_filter_zero, [](T value) { return fuzzyIsZero(value); });
+  kExpectFiltered(kValues | views::fuzzy_filter_nonzero,
+                  [](T value) { return not fuzzyIsZero(value); });
+  kExpectFiltered(kValues | views::fuzzy_filter_zero_within(2 * kEpsilon),
+                  [](T value) { return fuzzyIsZero(value, 2 * kEpsilon); });
+  kExpectFiltered(kValues | views::fuzzy_filter_nonzero_within(2 * kEpsilon),
+                  [](T value) { return not fuzzyIsZero(value, 2 * kEpsilon); });
+  kExpectFiltered(kValues | views::fuzzy_equal_to(2 * kEpsilon),
+                  [](T value) { return fuzzyCmpEqual(value, 2 * kEpsilon); });
+  kExpectFiltered(kValues | views::fuzzy_equal_to(2 * kEpsilon, kEpsilon / 2),
+                  [](T value) { return fuzzyCmpEqual(value, 2 * kEpsilon, kEpsilon / 2); });
+  kExpectFiltered(kValues | views::fuzzy_less_than(T{0}),
+                  [](T value) { return fuzzyCmpLess(value, T{0}); });
+  kExpectFiltered(kValues | views::fuzzy_less_than(T{0}, kEpsilon / 2),
+                  [](T value) { return fuzzyCmpLess(value, T{0}, kEpsilon / 2); });
+}
+
+TYPED_TEST(FloatingPointTest, PipelineMatchesTheEagerSteps) {
+  using T = TypeParam;
+
+  static constexpr T kPi = std::numbers::pi_v<T>;
+  static constexpr T kThreshold = kPi / 8;
+
+  const std::vector<T> kAngles = randomValues<T>(-4 * kPi, 4 * kPi, kNumValues);
+  const T kTarget = -kPi * 15 / 16;
+
+  // the angles within a threshold of the target, across the seam, step by step.
+  std::vector<T> expected;
+  for (const T kAngle : kAngles) {
+    const T kDiff = absSmallestAngleDiff(normalizeAngle(kAngle), kTarget);
+    if (fuzzyCmpLess(kDiff, kThreshold)) {
+      expected.push_back(kDiff);
+    }
+  }
+  ASSERT_FALSE(expected.empty());
+
+  auto pipeline = kAngles | views::normalized_angles | views::abs_angle_diff_to(kTarget)
+                  | views::fuzzy_less_than(kThreshold);
+  EXPECT_TRUE(std::ranges::equal(pipeline, expected));
+
+  // and with the standard algorithms and adaptors.
+  EXPECT_EQ(std::ranges::distance(pipeline), static_cast<std::ptrdiff_t>(expected.size()));
+  EXPECT_EQ(*std::ranges::max_element(pipeline), *std::ranges::max_element(expected));
+  EXPECT_TRUE(std::ranges::equal(pipeline | std::views::take(3), expected | std::views::take(3)));
+}
+
+TEST(ViewsTest, GivenIntegers) {
+  const std::array<int, 4> kDegrees{-180, 0, 90, 540};
+
+  const auto kRadians = kDegrees | views::to_radians | views::normalized_angles;
+  for (std::size_t i = 0; i < kDegrees.size(); ++i) {
+    EXPECT_EQ(kRadians[i], normalizeAngle(degreesToRadians(kDegrees[i])));
+  }
+  EXPECT_EQ(std::ranges::distance(kDegrees | views::to_radians | views::fuzzy_filter_zero), 1);
+}
+
+} // namespace
+} // namespace robocin